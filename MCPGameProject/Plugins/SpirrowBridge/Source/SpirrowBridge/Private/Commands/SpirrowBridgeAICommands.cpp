@@ -97,6 +97,15 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleCommand(
 	{
 		return HandleListBlackboardKeys(Params);
 	}
+	// Blackboard batch commands
+	else if (CommandType == TEXT("set_blackboard_keys"))
+	{
+		return HandleSetBlackboardKeys(Params);
+	}
+	else if (CommandType == TEXT("find_blackboard_key_usages"))
+	{
+		return HandleFindBlackboardKeyUsages(Params);
+	}
 	// BehaviorTree commands
 	else if (CommandType == TEXT("create_behavior_tree"))
 	{
@@ -140,6 +149,10 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleCommand(
 	{
 		return HandleSetBTNodeProperty(Params);
 	}
+	else if (CommandType == TEXT("set_bt_node_properties"))
+	{
+		return HandleSetBTNodeProperties(Params);
+	}
 	else if (CommandType == TEXT("delete_bt_node"))
 	{
 		return HandleDeleteBTNode(Params);
@@ -174,6 +187,24 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleCommand(
 	{
 		return HandleRepairBrokenBTNodes(Params);
 	}
+	else if (CommandType == TEXT("audit_behavior_trees"))
+	{
+		return HandleAuditBehaviorTrees(Params);
+	}
+	// BT Batch commands
+	else if (CommandType == TEXT("apply_behavior_tree"))
+	{
+		return HandleApplyBehaviorTree(Params);
+	}
+	// BT Snapshot commands
+	else if (CommandType == TEXT("get_bt_snapshot"))
+	{
+		return HandleGetBTSnapshot(Params);
+	}
+	else if (CommandType == TEXT("diff_behavior_tree"))
+	{
+		return HandleDiffBehaviorTree(Params);
+	}
 
 	return FSpirrowBridgeCommonUtils::CreateErrorResponse(
 		ESpirrowErrorCode::UnknownCommand,
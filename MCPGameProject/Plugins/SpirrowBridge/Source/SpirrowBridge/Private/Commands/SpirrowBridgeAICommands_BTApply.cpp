@@ -0,0 +1,719 @@
+#include "Commands/SpirrowBridgeAICommands.h"
+#include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeBTNodeIndex.h"
+
+// BehaviorTree runtime includes
+#include "BehaviorTree/BehaviorTree.h"
+#include "BehaviorTree/BlackboardData.h"
+#include "BehaviorTree/BTCompositeNode.h"
+#include "BehaviorTree/BTTaskNode.h"
+#include "BehaviorTree/BTDecorator.h"
+#include "BehaviorTree/BTService.h"
+#include "BehaviorTree/Composites/BTComposite_SimpleParallel.h"
+#include "BehaviorTree/Tasks/BTTask_RunBehavior.h"
+
+// Graph-based includes
+#include "EdGraph/EdGraph.h"
+#include "AIGraphTypes.h"
+#include "BehaviorTreeGraph.h"
+#include "BehaviorTreeGraphNode.h"
+#include "BehaviorTreeGraphNode_Root.h"
+#include "BehaviorTreeGraphNode_Composite.h"
+#include "BehaviorTreeGraphNode_SimpleParallel.h"
+#include "BehaviorTreeGraphNode_Task.h"
+#include "BehaviorTreeGraphNode_SubtreeTask.h"
+#include "BehaviorTreeGraphNode_Decorator.h"
+#include "BehaviorTreeGraphNode_Service.h"
+#include "EdGraphSchema_BehaviorTree.h"
+
+// Asset management includes
+#include "UObject/SavePackage.h"
+#include "Misc/PackageName.h"
+
+// ===== apply_behavior_tree =====
+//
+// add_bt_* / connect_bt_nodes はコマンドごとに UpdateAsset() と保存を行うため、
+// 大きなツリーを組むと全体再構築がノード数分走る。
+// ここではネストした spec を先に全て検証し、グラフノードとリンクを作ってから
+// UpdateAsset() と保存を一度だけ行う。
+
+namespace
+{
+enum class EBTApplyKind : uint8
+{
+	Composite,
+	Task,
+	Decorator,
+	Service
+};
+
+struct FBTApplySpec
+{
+	EBTApplyKind Kind = EBTApplyKind::Task;
+	UClass* NodeClass = nullptr;
+	FString Type;
+	FString Alias;
+	FString NodeName;
+	FString SpecPath;
+	bool bHasPosition = false;
+	FIntPoint Position = FIntPoint::ZeroValue;
+	TSharedPtr<FJsonObject> Properties;
+	TArray<FBTApplySpec> Decorators;
+	TArray<FBTApplySpec> Services;
+	TArray<FBTApplySpec> Children;
+
+	// 構築後に設定
+	UBehaviorTreeGraphNode* GraphNode = nullptr;
+	UBTNode* RuntimeNode = nullptr;
+};
+
+// レイアウト定数（ノード位置の固定間隔。詳細な配置は auto_layout_bt で行う）
+constexpr int32 BTApplyHorizontalSpacing = 300;
+constexpr int32 BTApplyVerticalSpacing = 150;
+
+const TCHAR* BTApplyKindToString(EBTApplyKind Kind)
+{
+	switch (Kind)
+	{
+	case EBTApplyKind::Composite: return TEXT("composite");
+	case EBTApplyKind::Task: return TEXT("task");
+	case EBTApplyKind::Decorator: return TEXT("decorator");
+	case EBTApplyKind::Service: return TEXT("service");
+	}
+	return TEXT("");
+}
+
+/**
+ * Runtime node names double as node IDs, so they must be unique across the whole graph
+ * (decorators and services included, which are not in BTGraph->Nodes).
+ */
+struct FBTApplyNameAllocator
+{
+	TSet<FString> UsedIds;
+	TMap<UClass*, int32> NextIndex;
+
+	void Seed(UBehaviorTreeGraph* BTGraph)
+	{
+		auto AddInstance = [this](UBehaviorTreeGraphNode* Node)
+		{
+			if (Node && Node->NodeInstance)
+			{
+				UsedIds.Add(Node->NodeInstance->GetName());
+			}
+		};
+
+		for (UEdGraphNode* Node : BTGraph->Nodes)
+		{
+			UBehaviorTreeGraphNode* BTGraphNode = Cast<UBehaviorTreeGraphNode>(Node);
+			if (!BTGraphNode)
+			{
+				continue;
+			}
+			AddInstance(BTGraphNode);
+			for (UBehaviorTreeGraphNode* Decorator : BTGraphNode->Decorators)
+			{
+				AddInstance(Decorator);
+			}
+			if (UBehaviorTreeGraphNode_Composite* Composite = Cast<UBehaviorTreeGraphNode_Composite>(BTGraphNode))
+			{
+				for (UBehaviorTreeGraphNode* Service : Composite->Services)
+				{
+					AddInstance(Service);
+				}
+			}
+		}
+	}
+
+	FName Allocate(UClass* NodeClass, UObject* Outer)
+	{
+		int32& Index = NextIndex.FindOrAdd(NodeClass);
+		for (;; ++Index)
+		{
+			const FString Candidate = FString::Printf(TEXT("%s_%d"), *NodeClass->GetName(), Index);
+			if (!UsedIds.Contains(Candidate) && !StaticFindObjectFast(UObject::StaticClass(), Outer, FName(*Candidate)))
+			{
+				UsedIds.Add(Candidate);
+				++Index;
+				return FName(*Candidate);
+			}
+		}
+	}
+};
+
+UBehaviorTreeGraph* GetOrCreateApplyBTGraph(UBehaviorTree* BehaviorTree)
+{
+	UBehaviorTreeGraph* BTGraph = Cast<UBehaviorTreeGraph>(BehaviorTree->BTGraph);
+	if (!BTGraph)
+	{
+		BTGraph = NewObject<UBehaviorTreeGraph>(BehaviorTree, TEXT("BTGraph"), RF_Transactional);
+		BehaviorTree->BTGraph = BTGraph;
+		BTGraph->Schema = UEdGraphSchema_BehaviorTree::StaticClass();
+		BTGraph->GetSchema()->CreateDefaultNodesForGraph(*BTGraph);
+	}
+	return BTGraph;
+}
+
+UEdGraphPin* FindApplyPin(UEdGraphNode* Node, EEdGraphPinDirection Direction)
+{
+	for (UEdGraphPin* Pin : Node->Pins)
+	{
+		if (Pin && Pin->Direction == Direction)
+		{
+			return Pin;
+		}
+	}
+	return nullptr;
+}
+
+bool LinkApplyGraphNodes(UBehaviorTreeGraphNode* Parent, UBehaviorTreeGraphNode* Child)
+{
+	UEdGraphPin* OutputPin = FindApplyPin(Parent, EGPD_Output);
+	UEdGraphPin* InputPin = FindApplyPin(Child, EGPD_Input);
+	if (!OutputPin || !InputPin)
+	{
+		return false;
+	}
+	OutputPin->MakeLinkTo(InputPin);
+	return true;
+}
+
+/**
+ * Composite/Task graph node with its runtime instance outered to the graph node,
+ * the same way add_bt_composite_node / add_bt_task_node create them.
+ */
+template <typename TGraphNode, typename TRuntimeNode>
+TGraphNode* CreateApplyTreeNode(UBehaviorTreeGraph* BTGraph, UClass* NodeClass, FBTApplyNameAllocator& Names, UBTNode*& OutRuntimeNode)
+{
+	FGraphNodeCreator<TGraphNode> NodeCreator(*BTGraph);
+	TGraphNode* GraphNode = NodeCreator.CreateNode();
+
+	TRuntimeNode* RuntimeNode = NewObject<TRuntimeNode>(GraphNode, NodeClass, Names.Allocate(NodeClass, GraphNode), RF_Transactional);
+	GraphNode->NodeInstance = RuntimeNode;
+	GraphNode->ClassData = FGraphNodeClassData(NodeClass, TEXT(""));
+	NodeCreator.Finalize();
+
+	OutRuntimeNode = RuntimeNode;
+	return GraphNode;
+}
+
+/**
+ * Decorator/Service graph node. These live only in the owner's Decorators/Services array
+ * (not in BTGraph->Nodes) and their runtime instance is outered to the BehaviorTree.
+ */
+template <typename TGraphNode, typename TRuntimeNode>
+TGraphNode* CreateApplySubNode(UBehaviorTreeGraph* BTGraph, UBehaviorTree* BehaviorTree, UClass* NodeClass, FBTApplyNameAllocator& Names, UBTNode*& OutRuntimeNode)
+{
+	TGraphNode* GraphNode = NewObject<TGraphNode>(BTGraph, TGraphNode::StaticClass(), NAME_None, RF_Transactional);
+	TRuntimeNode* RuntimeNode = NewObject<TRuntimeNode>(BehaviorTree, NodeClass, Names.Allocate(NodeClass, BehaviorTree), RF_Transactional);
+	GraphNode->NodeInstance = RuntimeNode;
+	GraphNode->ClassData = FGraphNodeClassData(NodeClass, TEXT(""));
+
+	GraphNode->CreateNewGuid();
+	GraphNode->PostPlacedNewNode();
+	GraphNode->AllocateDefaultPins();
+
+	// PostPlacedNewNode() が NodeInstance を上書きする場合があるため復元
+	if (!GraphNode->NodeInstance)
+	{
+		GraphNode->NodeInstance = RuntimeNode;
+	}
+
+	OutRuntimeNode = RuntimeNode;
+	return GraphNode;
+}
+
+/**
+ * Place nodes without an explicit position: leaves left to right, composites centered over their children.
+ * Returns the X of the node.
+ */
+int32 PlaceApplySpec(FBTApplySpec& Spec, int32 Depth, int32 BaseY, int32& NextLeafX)
+{
+	int32 X = NextLeafX;
+	if (Spec.Children.Num() == 0)
+	{
+		NextLeafX += BTApplyHorizontalSpacing;
+	}
+	else
+	{
+		const int32 FirstX = PlaceApplySpec(Spec.Children[0], Depth + 1, BaseY, NextLeafX);
+		int32 LastX = FirstX;
+		for (int32 i = 1; i < Spec.Children.Num(); ++i)
+		{
+			LastX = PlaceApplySpec(Spec.Children[i], Depth + 1, BaseY, NextLeafX);
+		}
+		X = (FirstX + LastX) / 2;
+	}
+
+	if (Spec.GraphNode)
+	{
+		if (Spec.bHasPosition)
+		{
+			Spec.GraphNode->NodePosX = Spec.Position.X;
+			Spec.GraphNode->NodePosY = Spec.Position.Y;
+		}
+		else
+		{
+			Spec.GraphNode->NodePosX = X;
+			Spec.GraphNode->NodePosY = BaseY + Depth * BTApplyVerticalSpacing;
+		}
+	}
+	return Spec.bHasPosition ? Spec.Position.X : X;
+}
+} // namespace
+
+TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleApplyBehaviorTree(
+	const TSharedPtr<FJsonObject>& Params)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	// パラメータ取得
+	FString BehaviorTreeName;
+	TSharedPtr<FJsonObject> NameError = FSpirrowBridgeCommonUtils::ValidateRequiredString(
+		Params, TEXT("behavior_tree_name"), BehaviorTreeName);
+	if (NameError) return NameError;
+
+	const TSharedPtr<FJsonObject>* RootSpecJson = nullptr;
+	if (!Params->TryGetObjectField(TEXT("tree"), RootSpecJson) || !RootSpecJson || !(*RootSpecJson).IsValid())
+	{
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::MissingRequiredParam,
+			TEXT("Missing required parameter: tree (nested node spec)"));
+	}
+
+	FString Path;
+	FSpirrowBridgeCommonUtils::GetOptionalString(
+		Params, TEXT("path"), Path, TEXT("/Game/AI/BehaviorTrees"));
+
+	FString ParentNodeId;
+	FSpirrowBridgeCommonUtils::GetOptionalString(
+		Params, TEXT("parent_node_id"), ParentNodeId, TEXT("Root"));
+
+	bool bClearExisting = false;
+	FSpirrowBridgeCommonUtils::GetOptionalBool(
+		Params, TEXT("clear_existing"), bClearExisting, false);
+
+	FString BlackboardName;
+	FSpirrowBridgeCommonUtils::GetOptionalString(
+		Params, TEXT("blackboard_name"), BlackboardName, TEXT(""));
+
+	FString BlackboardPath;
+	FSpirrowBridgeCommonUtils::GetOptionalString(
+		Params, TEXT("blackboard_path"), BlackboardPath, TEXT("/Game/AI/Blackboards"));
+
+	// BehaviorTree取得
+	UBehaviorTree* BehaviorTree = FindBehaviorTreeAsset(BehaviorTreeName, Path);
+	if (!BehaviorTree)
+	{
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::AssetNotFound,
+			FString::Printf(TEXT("BehaviorTree not found: %s at %s"), *BehaviorTreeName, *Path));
+	}
+
+	UBlackboardData* Blackboard = nullptr;
+	if (!BlackboardName.IsEmpty())
+	{
+		Blackboard = FindBlackboardAsset(BlackboardName, BlackboardPath);
+		if (!Blackboard)
+		{
+			return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+				ESpirrowErrorCode::AssetNotFound,
+				FString::Printf(TEXT("Blackboard not found: %s at %s"), *BlackboardName, *BlackboardPath));
+		}
+	}
+
+	// ★ Phase 1: spec を全て検証してからグラフに触る ★
+	TArray<TSharedPtr<FJsonValue>> SpecErrors;
+	auto AddSpecError = [&SpecErrors](const FString& SpecPath, const FString& Message)
+	{
+		TSharedPtr<FJsonObject> ErrorObj = MakeShareable(new FJsonObject());
+		ErrorObj->SetStringField(TEXT("spec_path"), SpecPath);
+		ErrorObj->SetStringField(TEXT("error"), Message);
+		SpecErrors.Add(MakeShareable(new FJsonValueObject(ErrorObj)));
+	};
+
+	TSet<FString> Aliases;
+	TFunction<void(const TSharedPtr<FJsonObject>&, const FString&, EBTApplyKind, FBTApplySpec&)> ParseSpec =
+		[&](const TSharedPtr<FJsonObject>& Json, const FString& SpecPath, EBTApplyKind SubNodeKind, FBTApplySpec& OutSpec)
+	{
+		OutSpec.SpecPath = SpecPath;
+
+		if (!Json->TryGetStringField(TEXT("type"), OutSpec.Type) || OutSpec.Type.IsEmpty())
+		{
+			AddSpecError(SpecPath, TEXT("Missing 'type'"));
+			return;
+		}
+
+		Json->TryGetStringField(TEXT("name"), OutSpec.NodeName);
+		if (Json->TryGetStringField(TEXT("id"), OutSpec.Alias) && !OutSpec.Alias.IsEmpty())
+		{
+			bool bDuplicate = false;
+			Aliases.Add(OutSpec.Alias, &bDuplicate);
+			if (bDuplicate)
+			{
+				AddSpecError(SpecPath, FString::Printf(TEXT("Duplicate id: %s"), *OutSpec.Alias));
+			}
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* PositionArray = nullptr;
+		if (Json->TryGetArrayField(TEXT("position"), PositionArray) && PositionArray && PositionArray->Num() >= 2)
+		{
+			OutSpec.Position = FIntPoint(
+				static_cast<int32>((*PositionArray)[0]->AsNumber()),
+				static_cast<int32>((*PositionArray)[1]->AsNumber()));
+			OutSpec.bHasPosition = true;
+		}
+
+		const TSharedPtr<FJsonObject>* PropertiesJson = nullptr;
+		if (Json->TryGetObjectField(TEXT("properties"), PropertiesJson) && PropertiesJson)
+		{
+			OutSpec.Properties = *PropertiesJson;
+		}
+
+		// ノード種別とクラスの解決
+		if (SubNodeKind == EBTApplyKind::Decorator)
+		{
+			OutSpec.Kind = EBTApplyKind::Decorator;
+			OutSpec.NodeClass = GetBTDecoratorClass(OutSpec.Type);
+		}
+		else if (SubNodeKind == EBTApplyKind::Service)
+		{
+			OutSpec.Kind = EBTApplyKind::Service;
+			OutSpec.NodeClass = GetBTServiceClass(OutSpec.Type);
+		}
+		else
+		{
+			FString KindString;
+			Json->TryGetStringField(TEXT("kind"), KindString);
+			if (KindString.IsEmpty())
+			{
+				OutSpec.NodeClass = GetBTCompositeNodeClass(OutSpec.Type);
+				OutSpec.Kind = OutSpec.NodeClass ? EBTApplyKind::Composite : EBTApplyKind::Task;
+				if (!OutSpec.NodeClass)
+				{
+					OutSpec.NodeClass = GetBTTaskNodeClass(OutSpec.Type);
+				}
+			}
+			else if (KindString.Equals(TEXT("composite"), ESearchCase::IgnoreCase))
+			{
+				OutSpec.Kind = EBTApplyKind::Composite;
+				OutSpec.NodeClass = GetBTCompositeNodeClass(OutSpec.Type);
+			}
+			else if (KindString.Equals(TEXT("task"), ESearchCase::IgnoreCase))
+			{
+				OutSpec.Kind = EBTApplyKind::Task;
+				OutSpec.NodeClass = GetBTTaskNodeClass(OutSpec.Type);
+			}
+			else
+			{
+				AddSpecError(SpecPath, FString::Printf(TEXT("Invalid kind '%s' (expected composite or task)"), *KindString));
+				return;
+			}
+		}
+
+		if (!OutSpec.NodeClass)
+		{
+			AddSpecError(SpecPath, FString::Printf(TEXT("Unknown %s type: %s"), BTApplyKindToString(OutSpec.Kind), *OutSpec.Type));
+		}
+
+		auto ParseList = [&](const TCHAR* Field, EBTApplyKind ListKind, TArray<FBTApplySpec>& OutList)
+		{
+			const TArray<TSharedPtr<FJsonValue>>* ListJson = nullptr;
+			if (!Json->TryGetArrayField(Field, ListJson) || !ListJson)
+			{
+				return;
+			}
+			for (int32 i = 0; i < ListJson->Num(); ++i)
+			{
+				const FString ItemPath = FString::Printf(TEXT("%s.%s[%d]"), *SpecPath, Field, i);
+				const TSharedPtr<FJsonObject>* ItemJson = nullptr;
+				if (!(*ListJson)[i]->TryGetObject(ItemJson) || !ItemJson)
+				{
+					AddSpecError(ItemPath, TEXT("Expected an object"));
+					continue;
+				}
+				ParseSpec(*ItemJson, ItemPath, ListKind, OutList.AddDefaulted_GetRef());
+			}
+		};
+
+		if (OutSpec.Kind == EBTApplyKind::Composite || OutSpec.Kind == EBTApplyKind::Task)
+		{
+			ParseList(TEXT("decorators"), EBTApplyKind::Decorator, OutSpec.Decorators);
+		}
+		if (OutSpec.Kind == EBTApplyKind::Composite)
+		{
+			ParseList(TEXT("services"), EBTApplyKind::Service, OutSpec.Services);
+			ParseList(TEXT("children"), EBTApplyKind::Task, OutSpec.Children);
+		}
+		else if (Json->HasField(TEXT("children")) || Json->HasField(TEXT("services")))
+		{
+			AddSpecError(SpecPath, TEXT("Only composite nodes can have children or services"));
+		}
+	};
+
+	// ツリーノード（Composite/Task）は SubNodeKind に Task を渡す
+	FBTApplySpec RootSpec;
+	ParseSpec(*RootSpecJson, TEXT("tree"), EBTApplyKind::Task, RootSpec);
+	if (SpecErrors.Num() == 0 && RootSpec.Kind != EBTApplyKind::Composite && ParentNodeId.Equals(TEXT("Root"), ESearchCase::IgnoreCase))
+	{
+		AddSpecError(RootSpec.SpecPath, TEXT("The node attached to Root must be a composite"));
+	}
+
+	if (SpecErrors.Num() > 0)
+	{
+		// 検証エラーでも success は true（false だとラッパーが errors を捨てる）。applied で判定
+		TSharedPtr<FJsonObject> Rejected = MakeShareable(new FJsonObject());
+		Rejected->SetBoolField(TEXT("success"), true);
+		Rejected->SetBoolField(TEXT("applied"), false);
+		Rejected->SetStringField(TEXT("behavior_tree_name"), BehaviorTreeName);
+		Rejected->SetNumberField(TEXT("failed_count"), SpecErrors.Num());
+		Rejected->SetArrayField(TEXT("errors"), SpecErrors);
+		return Rejected;
+	}
+
+	// ★ Graph取得と親ノード解決 ★
+	UBehaviorTreeGraph* BTGraph = GetOrCreateApplyBTGraph(BehaviorTree);
+	if (!BTGraph)
+	{
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::NodeCreationFailed,
+			TEXT("Failed to get or create BehaviorTree graph"));
+	}
+
+	UBehaviorTreeGraphNode_Root* RootGraphNode = nullptr;
+	for (UEdGraphNode* Node : BTGraph->Nodes)
+	{
+		if (UBehaviorTreeGraphNode_Root* Candidate = Cast<UBehaviorTreeGraphNode_Root>(Node))
+		{
+			RootGraphNode = Candidate;
+			break;
+		}
+	}
+	if (!RootGraphNode)
+	{
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::NodeNotFound,
+			TEXT("Root node not found in graph"));
+	}
+
+	const bool bAttachToRoot = ParentNodeId.Equals(TEXT("Root"), ESearchCase::IgnoreCase);
+	if (bClearExisting && !bAttachToRoot)
+	{
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::InvalidParamValue,
+			TEXT("clear_existing can only be used when attaching to Root"));
+	}
+
+	UBehaviorTreeGraphNode* ParentGraphNode = nullptr;
+	if (bAttachToRoot)
+	{
+		UEdGraphPin* RootOutput = FindApplyPin(RootGraphNode, EGPD_Output);
+		if (RootOutput && RootOutput->LinkedTo.Num() > 0 && !bClearExisting)
+		{
+			return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+				ESpirrowErrorCode::InvalidOperation,
+				TEXT("Root already has a child. Pass clear_existing=true to replace the tree, or parent_node_id to attach under a composite."));
+		}
+		ParentGraphNode = RootGraphNode;
+	}
+	else
+	{
+		FSpirrowBridgeBTNodeIndex::FEntry ParentEntry;
+		if (TSharedPtr<FJsonObject> ParentError = FSpirrowBridgeBTNodeIndex::Get().ResolveNode(BehaviorTree, ParentNodeId, ParentEntry, TEXT("Parent node")))
+		{
+			return ParentError;
+		}
+		ParentGraphNode = Cast<UBehaviorTreeGraphNode_Composite>(ParentEntry.GraphNode);
+		if (!ParentGraphNode)
+		{
+			return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+				ESpirrowErrorCode::InvalidOperation,
+				FString::Printf(TEXT("Parent node must be a composite node: %s"), *ParentNodeId));
+		}
+	}
+
+	// ★ 既存ツリーの削除（Root以外）★
+	int32 RemovedCount = 0;
+	if (bClearExisting)
+	{
+		TArray<UEdGraphNode*> NodesToRemove;
+		for (UEdGraphNode* Node : BTGraph->Nodes)
+		{
+			if (Node && Node != RootGraphNode)
+			{
+				NodesToRemove.Add(Node);
+			}
+		}
+		for (UEdGraphNode* Node : NodesToRemove)
+		{
+			BTGraph->RemoveNode(Node);
+		}
+		RootGraphNode->BreakAllNodeLinks();
+		RemovedCount = NodesToRemove.Num();
+	}
+
+	if (Blackboard)
+	{
+		BehaviorTree->BlackboardAsset = Blackboard;
+	}
+
+	// ★ Phase 2: グラフノードとリンクの構築（UpdateAssetはまだ呼ばない）★
+	FBTApplyNameAllocator Names;
+	Names.Seed(BTGraph);
+
+	TArray<FBTApplySpec*> CreatedSpecs;
+	TFunction<void(FBTApplySpec&, UBehaviorTreeGraphNode*)> BuildSpec =
+		[&](FBTApplySpec& Spec, UBehaviorTreeGraphNode* Parent)
+	{
+		if (Spec.Kind == EBTApplyKind::Composite)
+		{
+			if (Spec.NodeClass->IsChildOf(UBTComposite_SimpleParallel::StaticClass()))
+			{
+				Spec.GraphNode = CreateApplyTreeNode<UBehaviorTreeGraphNode_SimpleParallel, UBTCompositeNode>(BTGraph, Spec.NodeClass, Names, Spec.RuntimeNode);
+			}
+			else
+			{
+				Spec.GraphNode = CreateApplyTreeNode<UBehaviorTreeGraphNode_Composite, UBTCompositeNode>(BTGraph, Spec.NodeClass, Names, Spec.RuntimeNode);
+			}
+		}
+		else if (Spec.NodeClass->IsChildOf(UBTTask_RunBehavior::StaticClass()))
+		{
+			Spec.GraphNode = CreateApplyTreeNode<UBehaviorTreeGraphNode_SubtreeTask, UBTTaskNode>(BTGraph, Spec.NodeClass, Names, Spec.RuntimeNode);
+		}
+		else
+		{
+			Spec.GraphNode = CreateApplyTreeNode<UBehaviorTreeGraphNode_Task, UBTTaskNode>(BTGraph, Spec.NodeClass, Names, Spec.RuntimeNode);
+		}
+		CreatedSpecs.Add(&Spec);
+
+		LinkApplyGraphNodes(Parent, Spec.GraphNode);
+
+		for (FBTApplySpec& DecoratorSpec : Spec.Decorators)
+		{
+			UBehaviorTreeGraphNode_Decorator* DecoratorNode = CreateApplySubNode<UBehaviorTreeGraphNode_Decorator, UBTDecorator>(
+				BTGraph, BehaviorTree, DecoratorSpec.NodeClass, Names, DecoratorSpec.RuntimeNode);
+			Spec.GraphNode->Decorators.Add(DecoratorNode);
+			DecoratorNode->ParentNode = Cast<UAIGraphNode>(Spec.GraphNode);
+			DecoratorSpec.GraphNode = DecoratorNode;
+			CreatedSpecs.Add(&DecoratorSpec);
+		}
+
+		if (UBehaviorTreeGraphNode_Composite* CompositeNode = Cast<UBehaviorTreeGraphNode_Composite>(Spec.GraphNode))
+		{
+			for (FBTApplySpec& ServiceSpec : Spec.Services)
+			{
+				UBehaviorTreeGraphNode_Service* ServiceNode = CreateApplySubNode<UBehaviorTreeGraphNode_Service, UBTService>(
+					BTGraph, BehaviorTree, ServiceSpec.NodeClass, Names, ServiceSpec.RuntimeNode);
+				CompositeNode->Services.Add(ServiceNode);
+				ServiceNode->ParentNode = Cast<UAIGraphNode>(CompositeNode);
+				ServiceSpec.GraphNode = ServiceNode;
+				CreatedSpecs.Add(&ServiceSpec);
+			}
+		}
+
+		// 子は配列順にリンクされる（UpdateAsset は X 座標で子を並べ替えるため位置も順番通りに付ける）
+		for (FBTApplySpec& ChildSpec : Spec.Children)
+		{
+			BuildSpec(ChildSpec, Spec.GraphNode);
+		}
+	};
+	BuildSpec(RootSpec, ParentGraphNode);
+
+	// 位置の指定がないノードを親の下に配置
+	int32 NextLeafX = ParentGraphNode->NodePosX;
+	if (!bAttachToRoot)
+	{
+		// 既存の兄弟の右側に置く
+		UEdGraphPin* ParentOutput = FindApplyPin(ParentGraphNode, EGPD_Output);
+		if (ParentOutput)
+		{
+			for (UEdGraphPin* Linked : ParentOutput->LinkedTo)
+			{
+				if (Linked && Linked->GetOwningNode() != RootSpec.GraphNode)
+				{
+					NextLeafX = FMath::Max(NextLeafX, Linked->GetOwningNode()->NodePosX + BTApplyHorizontalSpacing);
+				}
+			}
+		}
+	}
+	PlaceApplySpec(RootSpec, 1, ParentGraphNode->NodePosY, NextLeafX);
+
+	// ★ プロパティ設定（Blackboard キーは上で設定した Blackboard に対して解決）★
+	TArray<TSharedPtr<FJsonValue>> PropertyErrors;
+	int32 PropertiesSet = 0;
+	for (FBTApplySpec* Spec : CreatedSpecs)
+	{
+		if (Spec->NodeName.Len() > 0)
+		{
+			Spec->RuntimeNode->NodeName = Spec->NodeName;
+		}
+		if (!Spec->Properties.IsValid())
+		{
+			continue;
+		}
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Property : Spec->Properties->Values)
+		{
+			FString ErrorMessage;
+			if (SetBTNodePropertyValue(BehaviorTree, Spec->RuntimeNode, Property.Key, Property.Value, ErrorMessage))
+			{
+				++PropertiesSet;
+				continue;
+			}
+			TSharedPtr<FJsonObject> ErrorObj = MakeShareable(new FJsonObject());
+			ErrorObj->SetStringField(TEXT("spec_path"), Spec->SpecPath);
+			ErrorObj->SetStringField(TEXT("node_id"), Spec->RuntimeNode->GetName());
+			ErrorObj->SetStringField(TEXT("property_name"), Property.Key);
+			ErrorObj->SetStringField(TEXT("error"), ErrorMessage);
+			PropertyErrors.Add(MakeShareable(new FJsonValueObject(ErrorObj)));
+		}
+	}
+
+	// ★ UpdateAsset と保存は一度だけ ★
+	BTGraph->NotifyGraphChanged();
+	BTGraph->UpdateAsset();
+	FSpirrowBridgeBTNodeIndex::Get().Invalidate(BehaviorTree);
+	BehaviorTree->MarkPackageDirty();
+
+	UPackage* Package = BehaviorTree->GetOutermost();
+	FString PackageFileName = FPackageName::LongPackageNameToFilename(
+		Package->GetName(), FPackageName::GetAssetPackageExtension());
+	FSavePackageArgs SaveArgs;
+	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+	const bool bSaved = UPackage::SavePackage(Package, BehaviorTree, *PackageFileName, SaveArgs);
+
+	// レスポンス
+	TArray<TSharedPtr<FJsonValue>> NodesArray;
+	TSharedPtr<FJsonObject> NodeIds = MakeShareable(new FJsonObject());
+	for (const FBTApplySpec* Spec : CreatedSpecs)
+	{
+		TSharedPtr<FJsonObject> NodeObj = MakeShareable(new FJsonObject());
+		NodeObj->SetStringField(TEXT("spec_path"), Spec->SpecPath);
+		NodeObj->SetStringField(TEXT("node_id"), Spec->RuntimeNode->GetName());
+		NodeObj->SetStringField(TEXT("kind"), BTApplyKindToString(Spec->Kind));
+		NodeObj->SetStringField(TEXT("node_class"), Spec->NodeClass->GetName());
+		NodesArray.Add(MakeShareable(new FJsonValueObject(NodeObj)));
+
+		if (!Spec->Alias.IsEmpty())
+		{
+			NodeIds->SetStringField(Spec->Alias, Spec->RuntimeNode->GetName());
+		}
+	}
+
+	TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject());
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetBoolField(TEXT("applied"), true);
+	Result->SetStringField(TEXT("behavior_tree_name"), BehaviorTreeName);
+	Result->SetStringField(TEXT("root_node_id"), RootSpec.RuntimeNode->GetName());
+	Result->SetStringField(TEXT("parent_node_id"), bAttachToRoot ? TEXT("Root") : ParentNodeId);
+	Result->SetNumberField(TEXT("created_count"), CreatedSpecs.Num());
+	Result->SetNumberField(TEXT("removed_count"), RemovedCount);
+	Result->SetNumberField(TEXT("properties_set"), PropertiesSet);
+	Result->SetArrayField(TEXT("nodes"), NodesArray);
+	Result->SetObjectField(TEXT("node_ids"), NodeIds);
+	if (PropertyErrors.Num() > 0)
+	{
+		Result->SetArrayField(TEXT("property_errors"), PropertyErrors);
+	}
+	Result->SetBoolField(TEXT("saved"), bSaved);
+	Result->SetNumberField(TEXT("time_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	return Result;
+}
@@ -0,0 +1,130 @@
+#include "Commands/SpirrowBridgeAICommands.h"
+#include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeBTAuditor.h"
+
+// ===== audit_behavior_trees =====
+//
+// detect_broken_bt_nodes は1アセットずつ同期ロード・同期チェックする。
+// ここではプロジェクト内の全 BehaviorTree を対象に、ロード・スナップショット・解析を
+// FSpirrowBridgeBTAuditor に任せ、結果を JSON にまとめるだけにする。
+
+TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleAuditBehaviorTrees(
+	const TSharedPtr<FJsonObject>& Params)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	// パラメータ取得
+	FString Path;
+	FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("path"), Path, TEXT("/Game"));
+
+	bool bForce = false;
+	FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("force"), bForce, false);
+
+	bool bIncludeClean = false;
+	FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("include_clean"), bIncludeClean, false);
+
+	double MaxIssuesValue = 500.0;
+	FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("max_issues"), MaxIssuesValue, 500.0);
+	const int32 MaxIssues = FMath::Max(0, static_cast<int32>(MaxIssuesValue));
+
+	if (!Path.StartsWith(TEXT("/")))
+	{
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::InvalidParamValue,
+			FString::Printf(TEXT("path must be a content path such as /Game/AI: %s"), *Path));
+	}
+
+	// 監査実行（未キャッシュ・変更済みアセットのみ再解析）
+	TArray<FSpirrowBridgeBTAuditor::FAssetReport> Reports;
+	FSpirrowBridgeBTAuditor::FAuditStats Stats;
+	FSpirrowBridgeBTAuditor::Get().Audit(Path, bForce, Reports, Stats);
+
+	// 結果を JSON 化
+	TArray<TSharedPtr<FJsonValue>> AssetsArray;
+	TSharedPtr<FJsonObject> IssueCounts = MakeShareable(new FJsonObject());
+	TMap<FName, int32> CountsByType;
+	int32 TotalErrors = 0;
+	int32 TotalWarnings = 0;
+	int32 IssuesEmitted = 0;
+	bool bTruncated = false;
+
+	for (const FSpirrowBridgeBTAuditor::FAssetReport& Report : Reports)
+	{
+		int32 AssetErrors = Report.bLoadFailed ? 1 : 0;
+		int32 AssetWarnings = 0;
+		for (const FSpirrowBridgeBTAuditor::FIssue& Issue : Report.Issues)
+		{
+			(Issue.bError ? AssetErrors : AssetWarnings)++;
+			CountsByType.FindOrAdd(Issue.Type)++;
+		}
+		TotalErrors += AssetErrors;
+		TotalWarnings += AssetWarnings;
+
+		if (AssetErrors == 0 && AssetWarnings == 0 && !bIncludeClean)
+		{
+			continue;
+		}
+
+		TSharedPtr<FJsonObject> AssetObj = MakeShareable(new FJsonObject());
+		AssetObj->SetStringField(TEXT("name"), Report.AssetName);
+		AssetObj->SetStringField(TEXT("path"), Report.ObjectPath);
+		AssetObj->SetNumberField(TEXT("node_count"), Report.NodeCount);
+		AssetObj->SetNumberField(TEXT("error_count"), AssetErrors);
+		AssetObj->SetNumberField(TEXT("warning_count"), AssetWarnings);
+		AssetObj->SetBoolField(TEXT("cached"), Report.bFromCache);
+		if (Report.bLoadFailed)
+		{
+			AssetObj->SetBoolField(TEXT("load_failed"), true);
+		}
+
+		TArray<TSharedPtr<FJsonValue>> IssuesArray;
+		for (const FSpirrowBridgeBTAuditor::FIssue& Issue : Report.Issues)
+		{
+			if (IssuesEmitted >= MaxIssues)
+			{
+				bTruncated = true;
+				break;
+			}
+
+			TSharedPtr<FJsonObject> IssueObj = MakeShareable(new FJsonObject());
+			IssueObj->SetStringField(TEXT("type"), Issue.Type.ToString());
+			IssueObj->SetStringField(TEXT("severity"), Issue.bError ? TEXT("error") : TEXT("warning"));
+			if (!Issue.NodeId.IsEmpty())
+			{
+				IssueObj->SetStringField(TEXT("node_id"), Issue.NodeId);
+				IssueObj->SetStringField(TEXT("node_class"), Issue.NodeClass);
+			}
+			IssueObj->SetStringField(TEXT("message"), Issue.Message);
+			IssuesArray.Add(MakeShareable(new FJsonValueObject(IssueObj)));
+			IssuesEmitted++;
+		}
+		AssetObj->SetArrayField(TEXT("issues"), IssuesArray);
+
+		AssetsArray.Add(MakeShareable(new FJsonValueObject(AssetObj)));
+	}
+
+	for (const TPair<FName, int32>& Pair : CountsByType)
+	{
+		IssueCounts->SetNumberField(Pair.Key.ToString(), Pair.Value);
+	}
+
+	TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject());
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetStringField(TEXT("path"), Path);
+	Result->SetNumberField(TEXT("asset_count"), Stats.NumAssets);
+	Result->SetNumberField(TEXT("audited_count"), Stats.Audited);
+	Result->SetNumberField(TEXT("cached_count"), Stats.FromCache);
+	Result->SetNumberField(TEXT("loaded_count"), Stats.Loaded);
+	Result->SetNumberField(TEXT("load_failed_count"), Stats.LoadFailed);
+	Result->SetNumberField(TEXT("error_count"), TotalErrors);
+	Result->SetNumberField(TEXT("warning_count"), TotalWarnings);
+	Result->SetObjectField(TEXT("issue_counts"), IssueCounts);
+	Result->SetArrayField(TEXT("assets"), AssetsArray);
+	Result->SetBoolField(TEXT("truncated"), bTruncated);
+	Result->SetNumberField(TEXT("load_ms"), Stats.LoadMs);
+	Result->SetNumberField(TEXT("snapshot_ms"), Stats.SnapshotMs);
+	Result->SetNumberField(TEXT("analysis_ms"), Stats.AnalysisMs);
+	Result->SetNumberField(TEXT("time_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	return Result;
+}
@@ -1,5 +1,6 @@
 #include "Commands/SpirrowBridgeAICommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeBTNodeIndex.h"
 
 // BehaviorTree runtime includes
 #include "BehaviorTree/BehaviorTree.h"
@@ -74,21 +75,16 @@ static UBehaviorTreeGraphNode_Root* FindRootGraphNode(UBehaviorTreeGraph* BTGrap
 
 /**
  * Find a graph node by its runtime node ID
+ * ★ Composite/Task のみ（Decorator/Service は親や装飾対象にならない）★
  */
 static UBehaviorTreeGraphNode* FindGraphNodeById(UBehaviorTreeGraph* BTGraph, const FString& NodeId)
 {
-	for (UEdGraphNode* Node : BTGraph->Nodes)
+	UBehaviorTreeGraphNode* GraphNode = FSpirrowBridgeBTNodeIndex::Get().FindGraphNode(BTGraph->GetTypedOuter<UBehaviorTree>(), NodeId);
+	if (GraphNode && (GraphNode->IsA<UBehaviorTreeGraphNode_Decorator>() || GraphNode->IsA<UBehaviorTreeGraphNode_Service>()))
 	{
-		UBehaviorTreeGraphNode* BTGraphNode = Cast<UBehaviorTreeGraphNode>(Node);
-		if (BTGraphNode && BTGraphNode->NodeInstance)
-		{
-			if (BTGraphNode->NodeInstance->GetName() == NodeId)
-			{
-				return BTGraphNode;
-			}
-		}
+		return nullptr;
 	}
-	return nullptr;
+	return GraphNode;
 }
 
 /**
@@ -295,6 +291,7 @@ static void FinalizeAndSaveBTGraph(UBehaviorTreeGraph* BTGraph, UBehaviorTree* B
 
 	// Rebuild runtime tree
 	BTGraph->UpdateAsset();
+	FSpirrowBridgeBTNodeIndex::Get().Invalidate(BehaviorTree);
 
 	// ★ デバッグログ: UpdateAsset後のグラフ状態 ★
 	UE_LOG(LogTemp, Warning, TEXT("=== After UpdateAsset (Graph) ==="));
@@ -1,5 +1,6 @@
 #include "Commands/SpirrowBridgeAICommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeBTNodeIndex.h"
 
 // Phase G: BT Node Operation includes
 #include "BehaviorTree/BehaviorTree.h"
@@ -7,6 +8,8 @@
 #include "BehaviorTree/BTTaskNode.h"
 #include "BehaviorTree/BTDecorator.h"
 #include "BehaviorTree/BTService.h"
+#include "BehaviorTree/BehaviorTreeTypes.h"      // FBlackboardKeySelector
+#include "BehaviorTree/BlackboardData.h"
 
 // Composites
 #include "BehaviorTree/Composites/BTComposite_Selector.h"
@@ -226,101 +229,108 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::BTNodeToJson(UBTNode* Node)
 	return NodeJson;
 }
 
-UBTNode* FSpirrowBridgeAICommands::FindBTNodeById(UBehaviorTree* BehaviorTree, const FString& NodeId)
+bool FSpirrowBridgeAICommands::SetBTNodePropertyValue(
+	UBehaviorTree* BehaviorTree,
+	UBTNode* Node,
+	const FString& PropertyName,
+	const TSharedPtr<FJsonValue>& Value,
+	FString& OutError)
 {
-	if (!BehaviorTree) return nullptr;
-
-	// ツリー内を検索
-	if (!BehaviorTree->RootNode) return nullptr;
-
-	// RootNode自体をチェック
-	if (BehaviorTree->RootNode->GetName() == NodeId)
+	if (!Node || !Value.IsValid())
 	{
-		return BehaviorTree->RootNode;
+		OutError = TEXT("Invalid node or value");
+		return false;
 	}
 
-	// 再帰的に検索
-	TFunction<UBTNode*(UBTCompositeNode*)> SearchInComposite = [&](UBTCompositeNode* Composite) -> UBTNode*
+	// FBlackboardKeySelector はキー名で指定し、Blackboard に対して解決する
+	FStructProperty* StructProp = CastField<FStructProperty>(Node->GetClass()->FindPropertyByName(*PropertyName));
+	if (StructProp && StructProp->Struct == FBlackboardKeySelector::StaticStruct())
 	{
-		if (!Composite) return nullptr;
-
-		// サービスを検索
-		for (UBTService* Service : Composite->Services)
+		FString KeyName;
+		if (Value->Type == EJson::String)
 		{
-			if (Service && Service->GetName() == NodeId)
-			{
-				return Service;
-			}
+			KeyName = Value->AsString();
+		}
+		else if (Value->Type == EJson::Object)
+		{
+			Value->AsObject()->TryGetStringField(TEXT("SelectedKeyName"), KeyName);
+		}
+		if (KeyName.IsEmpty())
+		{
+			OutError = TEXT("Blackboard key selector expects a key name");
+			return false;
 		}
 
-		// 子を検索
-		for (const FBTCompositeChild& Child : Composite->Children)
+		UBlackboardData* Blackboard = BehaviorTree ? BehaviorTree->BlackboardAsset.Get() : nullptr;
+		if (!Blackboard)
 		{
-			// デコレータを検索
-			for (UBTDecorator* Decorator : Child.Decorators)
+			OutError = TEXT("BehaviorTree has no Blackboard asset assigned");
+			return false;
+		}
+		if (Blackboard->GetKeyID(FName(*KeyName)) == FBlackboard::InvalidKey)
+		{
+			TArray<FString> AvailableKeys;
+			for (const FBlackboardEntry& Key : Blackboard->Keys)
 			{
-				if (Decorator && Decorator->GetName() == NodeId)
-				{
-					return Decorator;
-				}
+				AvailableKeys.Add(Key.EntryName.ToString());
 			}
+			OutError = FString::Printf(TEXT("Blackboard key not found: %s. Available keys: %s"),
+				*KeyName, *FString::Join(AvailableKeys, TEXT(", ")));
+			return false;
+		}
 
-			// 子Compositeを検索
-			if (Child.ChildComposite)
-			{
-				if (Child.ChildComposite->GetName() == NodeId)
-				{
-					return Child.ChildComposite;
-				}
-				if (UBTNode* Found = SearchInComposite(Child.ChildComposite))
-				{
-					return Found;
-				}
-			}
+		FBlackboardKeySelector* KeySelector = StructProp->ContainerPtrToValuePtr<FBlackboardKeySelector>(Node);
+		KeySelector->SelectedKeyName = FName(*KeyName);
+		KeySelector->ResolveSelectedKey(*Blackboard);
+		return true;
+	}
 
-			// 子Taskを検索
-			if (Child.ChildTask && Child.ChildTask->GetName() == NodeId)
-			{
-				return Child.ChildTask;
-			}
-		}
+	return FSpirrowBridgeCommonUtils::SetObjectProperty(Node, PropertyName, Value, OutError);
+}
 
-		return nullptr;
-	};
+UBTNode* FSpirrowBridgeAICommands::FindBTNodeById(UBehaviorTree* BehaviorTree, const FString& NodeId)
+{
+	if (!BehaviorTree) return nullptr;
 
-	return SearchInComposite(BehaviorTree->RootNode);
+	// RootNode自体をチェック（ルートのランタイムノードはグラフの Root ノードに対応しない）
+	if (BehaviorTree->RootNode && BehaviorTree->RootNode->GetName() == NodeId)
+	{
+		return BehaviorTree->RootNode;
+	}
+
+	FSpirrowBridgeBTNodeIndex::FEntry Entry;
+	return FSpirrowBridgeBTNodeIndex::Get().Find(BehaviorTree, NodeId, Entry) ? Entry.RuntimeNode : nullptr;
 }
 
 void FSpirrowBridgeAICommands::RemoveNodeFromParent(UBehaviorTree* BehaviorTree, UBTNode* TargetNode)
 {
-	if (!BehaviorTree || !BehaviorTree->RootNode || !TargetNode)
+	if (!BehaviorTree || !TargetNode)
 	{
 		return;
 	}
 
-	TFunction<bool(UBTCompositeNode*)> RemoveFromComposite = [&](UBTCompositeNode* Parent) -> bool
+	// インデックスから親を直接引く（ツリー全体を走査しない）
+	FSpirrowBridgeBTNodeIndex::FEntry Entry;
+	if (!FSpirrowBridgeBTNodeIndex::Get().Find(BehaviorTree, TargetNode->GetName(), Entry) || !Entry.ParentGraphNode)
 	{
-		if (!Parent) return false;
+		return;
+	}
 
-		for (int32 i = Parent->Children.Num() - 1; i >= 0; --i)
-		{
-			FBTCompositeChild& Child = Parent->Children[i];
-			if (Child.ChildComposite == TargetNode || Child.ChildTask == TargetNode)
-			{
-				Parent->Children.RemoveAt(i);
-				return true;
-			}
+	UBTCompositeNode* Parent = Cast<UBTCompositeNode>(Entry.ParentGraphNode->NodeInstance);
+	if (!Parent)
+	{
+		return;
+	}
 
-			// 再帰的に検索
-			if (Child.ChildComposite && RemoveFromComposite(Child.ChildComposite))
-			{
-				return true;
-			}
+	for (int32 i = Parent->Children.Num() - 1; i >= 0; --i)
+	{
+		const FBTCompositeChild& Child = Parent->Children[i];
+		if (Child.ChildComposite == TargetNode || Child.ChildTask == TargetNode)
+		{
+			Parent->Children.RemoveAt(i);
+			return;
 		}
-		return false;
-	};
-
-	RemoveFromComposite(BehaviorTree->RootNode);
+	}
 }
 
 FString FSpirrowBridgeAICommands::GetCompositeDescription(const FString& Type)
@@ -1,5 +1,7 @@
 #include "Commands/SpirrowBridgeAICommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeBTNodeIndex.h"
+#include "Commands/SpirrowBridgeBTLayout.h"
 
 // BehaviorTree runtime includes
 #include "BehaviorTree/BehaviorTree.h"
@@ -65,50 +67,11 @@ static UBehaviorTreeGraph* GetBTGraph(UBehaviorTree* BehaviorTree)
 
 /**
  * Find a graph node by its runtime node ID
- * ★ Decorator/Serviceも検索対象に含める（BTGraph->Nodesには含まれない）★
+ * ★ Decorator/Serviceも検索対象（FSpirrowBridgeBTNodeIndex による O(1) 検索）★
  */
 static UBehaviorTreeGraphNode* FindGraphNodeByIdInternal(UBehaviorTreeGraph* BTGraph, const FString& NodeId)
 {
-	for (UEdGraphNode* Node : BTGraph->Nodes)
-	{
-		UBehaviorTreeGraphNode* BTGraphNode = Cast<UBehaviorTreeGraphNode>(Node);
-		if (BTGraphNode && BTGraphNode->NodeInstance)
-		{
-			// ★ 通常ノード（Root/Composite/Task）のチェック ★
-			if (BTGraphNode->NodeInstance->GetName() == NodeId)
-			{
-				return BTGraphNode;
-			}
-
-			// ★ Decorators配列を検索 ★
-			for (UBehaviorTreeGraphNode* DecoratorNode : BTGraphNode->Decorators)
-			{
-				if (DecoratorNode && DecoratorNode->NodeInstance)
-				{
-					if (DecoratorNode->NodeInstance->GetName() == NodeId)
-					{
-						return DecoratorNode;
-					}
-				}
-			}
-
-			// ★ Services配列を検索（Compositeノードのみ）★
-			if (UBehaviorTreeGraphNode_Composite* CompositeNode = Cast<UBehaviorTreeGraphNode_Composite>(BTGraphNode))
-			{
-				for (UBehaviorTreeGraphNode* ServiceNode : CompositeNode->Services)
-				{
-					if (ServiceNode && ServiceNode->NodeInstance)
-					{
-						if (ServiceNode->NodeInstance->GetName() == NodeId)
-						{
-							return ServiceNode;
-						}
-					}
-				}
-			}
-		}
-	}
-	return nullptr;
+	return FSpirrowBridgeBTNodeIndex::Get().FindGraphNode(BTGraph->GetTypedOuter<UBehaviorTree>(), NodeId);
 }
 
 /**
@@ -189,6 +152,7 @@ static void FinalizeAndSaveBTGraphInternal(UBehaviorTreeGraph* BTGraph, UBehavio
 
 	// Rebuild runtime tree
 	BTGraph->UpdateAsset();
+	FSpirrowBridgeBTNodeIndex::Get().Invalidate(BehaviorTree);
 
 	// Mark package dirty
 	BehaviorTree->MarkPackageDirty();
@@ -399,110 +363,144 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleSetBTNodeProperty(
 			FString::Printf(TEXT("Runtime node not found for graph node: %s"), *NodeId));
 	}
 
-	// ★ BlackboardKey の特別処理（問題2修正）★
-	if (PropertyName == TEXT("BlackboardKey") || PropertyName.EndsWith(TEXT("BlackboardKey")))
+	// プロパティ設定（BlackboardKeySelector も含め set_bt_node_properties と同じ経路）
+	FString ErrorMessage;
+	if (!SetBTNodePropertyValue(BehaviorTree, TargetNode, PropertyName, PropertyValuePtr, ErrorMessage))
 	{
-		// FBlackboardKeySelector を直接設定
-		FStructProperty* StructProp = CastField<FStructProperty>(
-			TargetNode->GetClass()->FindPropertyByName(*PropertyName));
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::PropertySetFailed,
+			FString::Printf(TEXT("Failed to set property %s: %s"), *PropertyName, *ErrorMessage));
+	}
 
-		if (StructProp && StructProp->Struct == FBlackboardKeySelector::StaticStruct())
-		{
-			FBlackboardKeySelector* KeySelector = StructProp->ContainerPtrToValuePtr<FBlackboardKeySelector>(TargetNode);
+	// ★ グラフ更新と保存 ★
+	FinalizeAndSaveBTGraphInternal(BTGraph, BehaviorTree);
 
-			if (KeySelector)
-			{
-				// キー名を取得
-				FString KeyName;
-				if (PropertyValuePtr->Type == EJson::String)
-				{
-					KeyName = PropertyValuePtr->AsString();
-				}
-				else if (PropertyValuePtr->Type == EJson::Object)
-				{
-					TSharedPtr<FJsonObject> KeyObj = PropertyValuePtr->AsObject();
-					KeyObj->TryGetStringField(TEXT("SelectedKeyName"), KeyName);
-				}
+	// レスポンス
+	TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject());
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetStringField(TEXT("behavior_tree_name"), BehaviorTreeName);
+	Result->SetStringField(TEXT("node_id"), NodeId);
+	Result->SetStringField(TEXT("property_name"), PropertyName);
 
-				if (!KeyName.IsEmpty())
-				{
-					// BehaviorTreeからBlackboardを取得
-					UBlackboardData* Blackboard = BehaviorTree->BlackboardAsset;
-					if (Blackboard)
-					{
-						// キーIDを検索
-						FBlackboard::FKey KeyID = Blackboard->GetKeyID(FName(*KeyName));
+	FStructProperty* StructProp = CastField<FStructProperty>(TargetNode->GetClass()->FindPropertyByName(*PropertyName));
+	if (StructProp && StructProp->Struct == FBlackboardKeySelector::StaticStruct())
+	{
+		const FBlackboardKeySelector* KeySelector = StructProp->ContainerPtrToValuePtr<FBlackboardKeySelector>(TargetNode);
+		Result->SetStringField(TEXT("key_name"), KeySelector->SelectedKeyName.ToString());
+	}
+	return Result;
+}
 
-						if (KeyID != FBlackboard::InvalidKey)
-						{
-							// キー設定
-							KeySelector->SelectedKeyName = FName(*KeyName);
-
-							// ★重要: NeedsResolving() = true の場合、ResolveSelectedKey() を呼ぶ
-							KeySelector->ResolveSelectedKey(*Blackboard);
-
-							UE_LOG(LogTemp, Display, TEXT("Set BlackboardKey: %s -> KeyID: %d"),
-								*KeyName, static_cast<int32>(KeyID));
-
-							// グラフ更新と保存
-							FinalizeAndSaveBTGraphInternal(BTGraph, BehaviorTree);
-
-							// レスポンス
-							TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject());
-							Result->SetBoolField(TEXT("success"), true);
-							Result->SetStringField(TEXT("behavior_tree_name"), BehaviorTreeName);
-							Result->SetStringField(TEXT("node_id"), NodeId);
-							Result->SetStringField(TEXT("property_name"), PropertyName);
-							Result->SetStringField(TEXT("key_name"), KeyName);
-							return Result;
-						}
-						else
-						{
-							// 利用可能なキーをリスト
-							TArray<FString> AvailableKeys;
-							for (const FBlackboardEntry& Key : Blackboard->Keys)
-							{
-								AvailableKeys.Add(Key.EntryName.ToString());
-							}
-
-							return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-								ESpirrowErrorCode::PropertySetFailed,
-								FString::Printf(TEXT("Blackboard key not found: %s. Available keys: %s"),
-									*KeyName, *FString::Join(AvailableKeys, TEXT(", "))));
-						}
-					}
-					else
-					{
-						return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-							ESpirrowErrorCode::AssetNotFound,
-							TEXT("BehaviorTree has no Blackboard asset assigned"));
-					}
-				}
-			}
-		}
+TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleSetBTNodeProperties(
+	const TSharedPtr<FJsonObject>& Params)
+{
+	// パラメータ取得
+	FString BehaviorTreeName;
+	TSharedPtr<FJsonObject> NameError = FSpirrowBridgeCommonUtils::ValidateRequiredString(
+		Params, TEXT("behavior_tree_name"), BehaviorTreeName);
+	if (NameError) return NameError;
+
+	// nodes: { node_id: { property_name: value, ... }, ... }
+	const TSharedPtr<FJsonObject>* NodesObj = nullptr;
+	if (!Params->TryGetObjectField(TEXT("nodes"), NodesObj) || !NodesObj || !(*NodesObj).IsValid())
+	{
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::MissingRequiredParam,
+			TEXT("Missing required parameter: nodes ({node_id: {property_name: value}})"));
 	}
 
-	// プロパティ設定（汎用）
-	FString ErrorMessage;
-	bool bSuccess = FSpirrowBridgeCommonUtils::SetObjectProperty(
-		TargetNode, PropertyName, PropertyValuePtr, ErrorMessage);
+	FString Path;
+	FSpirrowBridgeCommonUtils::GetOptionalString(
+		Params, TEXT("path"), Path, TEXT("/Game/AI/BehaviorTrees"));
 
-	if (!bSuccess)
+	// BehaviorTree取得
+	UBehaviorTree* BehaviorTree = FindBehaviorTreeAsset(BehaviorTreeName, Path);
+	if (!BehaviorTree)
 	{
 		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-			ESpirrowErrorCode::PropertySetFailed,
-			FString::Printf(TEXT("Failed to set property %s: %s"), *PropertyName, *ErrorMessage));
+			ESpirrowErrorCode::AssetNotFound,
+			FString::Printf(TEXT("BehaviorTree not found: %s at %s"), *BehaviorTreeName, *Path));
 	}
 
-	// ★ グラフ更新と保存 ★
-	FinalizeAndSaveBTGraphInternal(BTGraph, BehaviorTree);
+	UBehaviorTreeGraph* BTGraph = GetBTGraph(BehaviorTree);
+	if (!BTGraph)
+	{
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::NodeCreationFailed,
+			TEXT("BehaviorTree has no graph"));
+	}
+
+	// ★ 全エントリを一括で適用（ノード検索はインデックス、再構築は最後に一度だけ）★
+	TArray<TSharedPtr<FJsonValue>> Results;
+	int32 SucceededCount = 0;
+	int32 FailedCount = 0;
+
+	auto AddResult = [&Results](const FString& NodeId, const FString& PropertyName, const FString& Error)
+	{
+		TSharedPtr<FJsonObject> Entry = MakeShareable(new FJsonObject());
+		Entry->SetStringField(TEXT("node_id"), NodeId);
+		if (!PropertyName.IsEmpty())
+		{
+			Entry->SetStringField(TEXT("property_name"), PropertyName);
+		}
+		Entry->SetBoolField(TEXT("success"), Error.IsEmpty());
+		if (!Error.IsEmpty())
+		{
+			Entry->SetStringField(TEXT("error"), Error);
+		}
+		Results.Add(MakeShareable(new FJsonValueObject(Entry)));
+	};
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& NodePair : (*NodesObj)->Values)
+	{
+		const FString& NodeId = NodePair.Key;
+		const TSharedPtr<FJsonObject>* PropertiesObj = nullptr;
+		if (!NodePair.Value.IsValid() || !NodePair.Value->TryGetObject(PropertiesObj) || !PropertiesObj)
+		{
+			AddResult(NodeId, FString(), TEXT("Expected an object of {property_name: value}"));
+			++FailedCount;
+			continue;
+		}
+
+		FSpirrowBridgeBTNodeIndex::FEntry Entry;
+		if (!FSpirrowBridgeBTNodeIndex::Get().Find(BehaviorTree, NodeId, Entry) || !Entry.RuntimeNode)
+		{
+			AddResult(NodeId, FString(), FString::Printf(TEXT("Node not found: %s"), *NodeId));
+			FailedCount += FMath::Max(1, (*PropertiesObj)->Values.Num());
+			continue;
+		}
+
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& PropertyPair : (*PropertiesObj)->Values)
+		{
+			FString ErrorMessage;
+			if (SetBTNodePropertyValue(BehaviorTree, Entry.RuntimeNode, PropertyPair.Key, PropertyPair.Value, ErrorMessage))
+			{
+				AddResult(NodeId, PropertyPair.Key, FString());
+				++SucceededCount;
+			}
+			else
+			{
+				AddResult(NodeId, PropertyPair.Key, ErrorMessage.IsEmpty() ? TEXT("Failed to set property") : ErrorMessage);
+				++FailedCount;
+			}
+		}
+	}
+
+	// ★ グラフ更新と保存（変更があった場合のみ、一度だけ）★
+	if (SucceededCount > 0)
+	{
+		FinalizeAndSaveBTGraphInternal(BTGraph, BehaviorTree);
+	}
 
 	// レスポンス
 	TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject());
+	// 一部失敗でも success は true（false だとラッパーが results を捨てる）。失敗は failed_count で判定
 	Result->SetBoolField(TEXT("success"), true);
 	Result->SetStringField(TEXT("behavior_tree_name"), BehaviorTreeName);
-	Result->SetStringField(TEXT("node_id"), NodeId);
-	Result->SetStringField(TEXT("property_name"), PropertyName);
+	Result->SetNumberField(TEXT("succeeded_count"), SucceededCount);
+	Result->SetNumberField(TEXT("failed_count"), FailedCount);
+	Result->SetBoolField(TEXT("saved"), SucceededCount > 0);
+	Result->SetArrayField(TEXT("results"), Results);
 	return Result;
 }
 
@@ -741,117 +739,6 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleSetBTNodePosition(
 	return Result;
 }
 
-// ===== Auto Layout Helper Functions =====
-
-/**
- * Get all child graph nodes connected to a parent node
- */
-static void GetConnectedChildGraphNodes(
-	UBehaviorTreeGraphNode* ParentNode,
-	TArray<UBehaviorTreeGraphNode*>& OutChildren)
-{
-	for (UEdGraphPin* Pin : ParentNode->Pins)
-	{
-		if (Pin->Direction == EGPD_Output)
-		{
-			for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
-			{
-				if (UBehaviorTreeGraphNode* ChildNode = Cast<UBehaviorTreeGraphNode>(LinkedPin->GetOwningNode()))
-				{
-					OutChildren.Add(ChildNode);
-				}
-			}
-		}
-	}
-}
-
-/**
- * Calculate subtree width recursively for proper spacing
- */
-static int32 CalculateSubtreeWidth(UBehaviorTreeGraphNode* Node, int32 HorizontalSpacing)
-{
-	TArray<UBehaviorTreeGraphNode*> Children;
-	GetConnectedChildGraphNodes(Node, Children);
-
-	if (Children.Num() == 0)
-	{
-		return HorizontalSpacing; // Leaf node width
-	}
-
-	int32 TotalWidth = 0;
-	for (UBehaviorTreeGraphNode* Child : Children)
-	{
-		TotalWidth += CalculateSubtreeWidth(Child, HorizontalSpacing);
-	}
-
-	return FMath::Max(TotalWidth, HorizontalSpacing);
-}
-
-/**
- * Layout child nodes recursively
- */
-static int32 LayoutChildNodesRecursive(
-	UBehaviorTreeGraphNode* ParentNode,
-	int32 StartX,
-	int32 CurrentY,
-	int32 HorizontalSpacing,
-	int32 VerticalSpacing,
-	int32& OutNodesLayouted)
-{
-	TArray<UBehaviorTreeGraphNode*> Children;
-	GetConnectedChildGraphNodes(ParentNode, Children);
-
-	if (Children.Num() == 0)
-	{
-		return StartX + HorizontalSpacing;
-	}
-
-	int32 ChildY = CurrentY + VerticalSpacing;
-	int32 CurrentX = StartX;
-
-	for (UBehaviorTreeGraphNode* Child : Children)
-	{
-		// Calculate this child's subtree width
-		int32 SubtreeWidth = CalculateSubtreeWidth(Child, HorizontalSpacing);
-
-		// Position child at center of its subtree
-		int32 ChildX = CurrentX + SubtreeWidth / 2 - HorizontalSpacing / 2;
-		Child->NodePosX = ChildX;
-		Child->NodePosY = ChildY;
-		OutNodesLayouted++;
-
-		// Layout decorators above the node
-		int32 DecoratorY = ChildY - 60;
-		for (int32 d = 0; d < Child->Decorators.Num(); ++d)
-		{
-			Child->Decorators[d]->NodePosX = ChildX;
-			Child->Decorators[d]->NodePosY = DecoratorY - d * 50;
-			OutNodesLayouted++;
-		}
-
-		// Layout services (if this is a composite node)
-		UBehaviorTreeGraphNode_Composite* CompositeNode = Cast<UBehaviorTreeGraphNode_Composite>(Child);
-		if (CompositeNode)
-		{
-			int32 ServiceY = ChildY - 40;
-			for (int32 s = 0; s < CompositeNode->Services.Num(); ++s)
-			{
-				CompositeNode->Services[s]->NodePosX = ChildX + 150;
-				CompositeNode->Services[s]->NodePosY = ServiceY - s * 40;
-				OutNodesLayouted++;
-			}
-		}
-
-		// Recursively layout grandchildren
-		LayoutChildNodesRecursive(Child, CurrentX, ChildY, HorizontalSpacing, VerticalSpacing, OutNodesLayouted);
-
-		// Move to next position
-		CurrentX += SubtreeWidth;
-	}
-
-	return CurrentX;
-}
-
 TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleAutoLayoutBT(
 	const TSharedPtr<FJsonObject>& Params)
 {
@@ -865,15 +752,21 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleAutoLayoutBT(
 	FSpirrowBridgeCommonUtils::GetOptionalString(
 		Params, TEXT("path"), Path, TEXT("/Game/AI/BehaviorTrees"));
 
-	double HorizontalSpacingDouble = 300.0;
+	double HorizontalSpacingDouble = 40.0;
 	FSpirrowBridgeCommonUtils::GetOptionalNumber(
-		Params, TEXT("horizontal_spacing"), HorizontalSpacingDouble, 300.0);
-	int32 HorizontalSpacing = static_cast<int32>(HorizontalSpacingDouble);
+		Params, TEXT("horizontal_spacing"), HorizontalSpacingDouble, 40.0);
 
-	double VerticalSpacingDouble = 150.0;
+	double VerticalSpacingDouble = 60.0;
 	FSpirrowBridgeCommonUtils::GetOptionalNumber(
-		Params, TEXT("vertical_spacing"), VerticalSpacingDouble, 150.0);
-	int32 VerticalSpacing = static_cast<int32>(VerticalSpacingDouble);
+		Params, TEXT("vertical_spacing"), VerticalSpacingDouble, 60.0);
+
+	bool bFull = false;
+	FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("full"), bFull, false);
+
+	FSpirrowBridgeBTLayout::FSettings Settings;
+	Settings.HorizontalSpacing = FMath::Max(0, static_cast<int32>(HorizontalSpacingDouble));
+	Settings.VerticalSpacing = FMath::Max(0, static_cast<int32>(VerticalSpacingDouble));
+	Settings.bFullRelayout = bFull;
 
 	// BehaviorTree取得
 	UBehaviorTree* BehaviorTree = FindBehaviorTreeAsset(BehaviorTreeName, Path);
@@ -893,38 +786,40 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleAutoLayoutBT(
 			TEXT("BehaviorTree has no graph"));
 	}
 
-	// Rootノード取得
-	UBehaviorTreeGraphNode_Root* RootNode = FindRootGraphNodeInternal(BTGraph);
-	if (!RootNode)
+	// レイアウト（形が変わったサブツリーのみ再計算し、動いたノードのみ書き込む）
+	FSpirrowBridgeBTLayout::FResult Layout;
+	if (!FSpirrowBridgeBTLayout::Layout(BehaviorTree, Settings, Layout))
 	{
 		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
 			ESpirrowErrorCode::NodeNotFound,
 			TEXT("Root node not found in graph"));
 	}
 
-	// Calculate total tree width to center it
-	int32 TotalWidth = CalculateSubtreeWidth(RootNode, HorizontalSpacing);
-	int32 StartX = -TotalWidth / 2;
-
-	// Rootの位置を設定（ツリーの中央上部）
-	RootNode->NodePosX = 0;
-	RootNode->NodePosY = 0;
-
-	int32 NodesLayouted = 1; // Root counted
-
-	// 再帰的に子ノードをレイアウト
-	LayoutChildNodesRecursive(RootNode, StartX, 0, HorizontalSpacing, VerticalSpacing, NodesLayouted);
-
-	// グラフ更新と保存
-	FinalizeAndSaveBTGraphInternal(BTGraph, BehaviorTree);
+	// 位置が変わった場合のみグラフ更新と保存
+	const bool bChanged = Layout.NumMoved > 0;
+	if (bChanged)
+	{
+		FinalizeAndSaveBTGraphInternal(BTGraph, BehaviorTree);
+	}
 
 	// レスポンス
 	TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject());
 	Result->SetBoolField(TEXT("success"), true);
 	Result->SetStringField(TEXT("behavior_tree_name"), BehaviorTreeName);
-	Result->SetNumberField(TEXT("nodes_layouted"), NodesLayouted);
-	Result->SetNumberField(TEXT("horizontal_spacing"), HorizontalSpacing);
-	Result->SetNumberField(TEXT("vertical_spacing"), VerticalSpacing);
+	Result->SetNumberField(TEXT("nodes_layouted"), Layout.NumNodes);
+	Result->SetNumberField(TEXT("nodes_moved"), Layout.NumMoved);
+	Result->SetNumberField(TEXT("subtrees_reused"), Layout.NumSubtreesReused);
+	Result->SetNumberField(TEXT("subtrees_laid_out"), Layout.NumSubtreesLaidOut);
+	Result->SetNumberField(TEXT("horizontal_spacing"), Settings.HorizontalSpacing);
+	Result->SetNumberField(TEXT("vertical_spacing"), Settings.VerticalSpacing);
+
+	TArray<TSharedPtr<FJsonValue>> SizeArray;
+	SizeArray.Add(MakeShareable(new FJsonValueNumber(Layout.Size.X)));
+	SizeArray.Add(MakeShareable(new FJsonValueNumber(Layout.Size.Y)));
+	Result->SetArrayField(TEXT("size"), SizeArray);
+
+	Result->SetBoolField(TEXT("saved"), bChanged);
+	Result->SetNumberField(TEXT("time_ms"), Layout.TimeMs);
 	return Result;
 }
 
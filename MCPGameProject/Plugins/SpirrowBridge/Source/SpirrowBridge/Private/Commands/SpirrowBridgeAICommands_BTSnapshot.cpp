@@ -0,0 +1,778 @@
+#include "Commands/SpirrowBridgeAICommands.h"
+#include "Commands/SpirrowBridgeCommonUtils.h"
+
+// BehaviorTree runtime includes
+#include "BehaviorTree/BehaviorTree.h"
+#include "BehaviorTree/BlackboardData.h"
+#include "BehaviorTree/BTNode.h"
+#include "BehaviorTree/BTCompositeNode.h"
+#include "BehaviorTree/BehaviorTreeTypes.h"      // FBlackboardKeySelector
+
+// Graph-based includes
+#include "EdGraph/EdGraph.h"
+#include "BehaviorTreeGraph.h"
+#include "BehaviorTreeGraphNode.h"
+#include "BehaviorTreeGraphNode_Root.h"
+#include "AIGraphTypes.h"
+
+#include "Hash/CityHash.h"
+
+// ===== get_bt_snapshot / diff_behavior_tree =====
+//
+// get_behavior_tree_structure / list_bt_nodes は表示用のネスト JSON で、変更確認には向かない。
+// スナップショットはノード ID（ランタイムインスタンス名）をキーにしたフラットなテーブルで、
+// 各ノードに「内容 + デコレータ/サービス + 子」のサブツリーハッシュを持たせる。
+// diff はハッシュが一致するサブツリーを丸ごとスキップするため、変更箇所の量に比例して終わる。
+
+namespace
+{
+constexpr int32 BTSnapshotFormat = 1;
+
+const TCHAR* BTSnapListNames[] = { TEXT("decorators"), TEXT("services"), TEXT("children") };
+
+struct FBTSnapNode
+{
+	FString Kind;
+	FString Class;
+	FString Name;
+
+	/** Non-default properties, sorted by name */
+	TArray<TPair<FString, FString>> Props;
+
+	/** Decorators, services, children (BTSnapListNames order) */
+	TArray<FString> Lists[3];
+
+	/** Content hash for decorators/services, subtree hash for composites/tasks */
+	FString Hash;
+};
+
+struct FBTSnapshot
+{
+	FString TreePath;
+	FString Blackboard;
+	FString RootId;
+	FString Hash;
+	TMap<FString, FBTSnapNode> Nodes;
+};
+
+FString HashBTSnapText(const FString& Text)
+{
+	const uint64 Hash = CityHash64(reinterpret_cast<const char*>(*Text), Text.Len() * sizeof(TCHAR));
+	return FString::Printf(TEXT("%016llx"), Hash);
+}
+
+/** Canonical text of a node; child/sub-node entries must already be in the snapshot */
+void ComputeBTSnapHash(const FString& Id, FBTSnapNode& Node, const FBTSnapshot& Snapshot)
+{
+	FString Text = FString::Printf(TEXT("%s\n%s\n%s\n%s\n"), *Id, *Node.Kind, *Node.Class, *Node.Name);
+	for (const TPair<FString, FString>& Prop : Node.Props)
+	{
+		Text += FString::Printf(TEXT("%s=%s\n"), *Prop.Key, *Prop.Value);
+	}
+	for (int32 ListIndex = 0; ListIndex < 3; ++ListIndex)
+	{
+		Text += BTSnapListNames[ListIndex];
+		Text += TEXT(":");
+		for (const FString& EntryId : Node.Lists[ListIndex])
+		{
+			const FBTSnapNode* Entry = Snapshot.Nodes.Find(EntryId);
+			Text += Entry ? Entry->Hash : EntryId;
+			Text += TEXT(",");
+		}
+		Text += TEXT("\n");
+	}
+	Node.Hash = HashBTSnapText(Text);
+}
+
+/** Editable properties that differ from the class defaults; key selectors as their key name */
+void CollectBTSnapProps(UBTNode* RuntimeNode, TArray<TPair<FString, FString>>& OutProps)
+{
+	static const FName NodeNamePropertyName(TEXT("NodeName"));
+
+	const UObject* Defaults = RuntimeNode->GetClass()->GetDefaultObject();
+	for (TFieldIterator<FProperty> PropIt(RuntimeNode->GetClass()); PropIt; ++PropIt)
+	{
+		FProperty* Property = *PropIt;
+		if (!Property->HasAnyPropertyFlags(CPF_Edit)
+			|| Property->HasAnyPropertyFlags(CPF_Transient | CPF_Deprecated)
+			|| Property->GetFName() == NodeNamePropertyName)
+		{
+			continue;
+		}
+
+		FString Value;
+		FStructProperty* StructProp = CastField<FStructProperty>(Property);
+		if (StructProp && StructProp->Struct == FBlackboardKeySelector::StaticStruct())
+		{
+			// Resolved key ID/type are derived data; only the key name is authored
+			const FName KeyName = StructProp->ContainerPtrToValuePtr<FBlackboardKeySelector>(RuntimeNode)->SelectedKeyName;
+			const FName DefaultKeyName = StructProp->ContainerPtrToValuePtr<FBlackboardKeySelector>(Defaults)->SelectedKeyName;
+			if (KeyName == DefaultKeyName)
+			{
+				continue;
+			}
+			Value = KeyName.ToString();
+		}
+		else
+		{
+			if (Property->Identical_InContainer(RuntimeNode, Defaults))
+			{
+				continue;
+			}
+			Property->ExportTextItem_Direct(Value, Property->ContainerPtrToValuePtr<void>(RuntimeNode), nullptr, RuntimeNode, PPF_None);
+		}
+		OutProps.Emplace(Property->GetName(), MoveTemp(Value));
+	}
+	OutProps.Sort([](const TPair<FString, FString>& A, const TPair<FString, FString>& B)
+	{
+		return A.Key < B.Key;
+	});
+}
+
+FString AddBTSnapNode(UBehaviorTreeGraphNode* GraphNode, const TCHAR* Kind, FBTSnapshot& Snapshot, TSet<UBehaviorTreeGraphNode*>& Visited)
+{
+	if (!GraphNode || Visited.Contains(GraphNode))
+	{
+		return FString();
+	}
+	Visited.Add(GraphNode);
+
+	FString Id;
+	FBTSnapNode Node;
+	if (UBTNode* RuntimeNode = Cast<UBTNode>(GraphNode->NodeInstance))
+	{
+		Id = RuntimeNode->GetName();
+		Node.Kind = Kind;
+		Node.Class = RuntimeNode->GetClass()->GetName();
+		Node.Name = RuntimeNode->NodeName;
+		CollectBTSnapProps(RuntimeNode, Node.Props);
+	}
+	else
+	{
+		// クラスが読めずインスタンスが無いノードもサブツリーごと残す（消えると diff が削除と誤認する）
+		const FString StoredClassName = GraphNode->ClassData.GetClassName();
+		Id = GraphNode->GetName();
+		Node.Kind = TEXT("broken");
+		Node.Class = StoredClassName.IsEmpty() ? GraphNode->GetClass()->GetName() : StoredClassName;
+	}
+
+	for (UBehaviorTreeGraphNode* Decorator : GraphNode->Decorators)
+	{
+		const FString SubId = AddBTSnapNode(Decorator, TEXT("decorator"), Snapshot, Visited);
+		if (!SubId.IsEmpty())
+		{
+			Node.Lists[0].Add(SubId);
+		}
+	}
+	for (UBehaviorTreeGraphNode* Service : GraphNode->Services)
+	{
+		const FString SubId = AddBTSnapNode(Service, TEXT("service"), Snapshot, Visited);
+		if (!SubId.IsEmpty())
+		{
+			Node.Lists[1].Add(SubId);
+		}
+	}
+
+	// Child order is the execution order (UpdateAsset sorts links by X)
+	for (UEdGraphPin* Pin : GraphNode->Pins)
+	{
+		if (!Pin || Pin->Direction != EGPD_Output)
+		{
+			continue;
+		}
+		for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
+		{
+			UBehaviorTreeGraphNode* ChildNode = LinkedPin ? Cast<UBehaviorTreeGraphNode>(LinkedPin->GetOwningNode()) : nullptr;
+			const UBTNode* ChildRuntime = ChildNode ? Cast<UBTNode>(ChildNode->NodeInstance) : nullptr;
+			const TCHAR* ChildKind = ChildRuntime && ChildRuntime->IsA<UBTCompositeNode>() ? TEXT("composite") : TEXT("task");
+			const FString ChildId = AddBTSnapNode(ChildNode, ChildKind, Snapshot, Visited);
+			if (!ChildId.IsEmpty())
+			{
+				Node.Lists[2].Add(ChildId);
+			}
+		}
+	}
+
+	ComputeBTSnapHash(Id, Node, Snapshot);
+	Snapshot.Nodes.Add(Id, MoveTemp(Node));
+	return Id;
+}
+
+void FinishBTSnapshot(FBTSnapshot& Snapshot)
+{
+	const FBTSnapNode* Root = Snapshot.Nodes.Find(Snapshot.RootId);
+	Snapshot.Hash = HashBTSnapText(FString::Printf(TEXT("%s\n%s\n%s"),
+		*Snapshot.Blackboard, *Snapshot.RootId, Root ? *Root->Hash : TEXT("")));
+}
+
+/** Snapshot of everything reachable from the Root node */
+bool BuildLiveBTSnapshot(UBehaviorTree* BehaviorTree, FBTSnapshot& OutSnapshot)
+{
+	UBehaviorTreeGraph* BTGraph = Cast<UBehaviorTreeGraph>(BehaviorTree->BTGraph);
+	if (!BTGraph)
+	{
+		return false;
+	}
+
+	OutSnapshot.TreePath = BehaviorTree->GetPathName();
+	OutSnapshot.Blackboard = BehaviorTree->BlackboardAsset ? BehaviorTree->BlackboardAsset->GetName() : FString();
+
+	TSet<UBehaviorTreeGraphNode*> Visited;
+	for (UEdGraphNode* Node : BTGraph->Nodes)
+	{
+		UBehaviorTreeGraphNode_Root* RootNode = Cast<UBehaviorTreeGraphNode_Root>(Node);
+		if (!RootNode)
+		{
+			continue;
+		}
+		for (UEdGraphPin* Pin : RootNode->Pins)
+		{
+			if (Pin && Pin->Direction == EGPD_Output && Pin->LinkedTo.Num() > 0 && Pin->LinkedTo[0])
+			{
+				UBehaviorTreeGraphNode* TopNode = Cast<UBehaviorTreeGraphNode>(Pin->LinkedTo[0]->GetOwningNode());
+				OutSnapshot.RootId = AddBTSnapNode(TopNode, TEXT("composite"), OutSnapshot, Visited);
+				break;
+			}
+		}
+		break;
+	}
+
+	FinishBTSnapshot(OutSnapshot);
+	return true;
+}
+
+TSharedPtr<FJsonObject> BTSnapshotToJson(const FBTSnapshot& Snapshot)
+{
+	TSharedPtr<FJsonObject> NodesObj = MakeShareable(new FJsonObject());
+	for (const TPair<FString, FBTSnapNode>& Pair : Snapshot.Nodes)
+	{
+		const FBTSnapNode& Node = Pair.Value;
+		TSharedPtr<FJsonObject> NodeObj = MakeShareable(new FJsonObject());
+		NodeObj->SetStringField(TEXT("kind"), Node.Kind);
+		NodeObj->SetStringField(TEXT("class"), Node.Class);
+		if (!Node.Name.IsEmpty())
+		{
+			NodeObj->SetStringField(TEXT("name"), Node.Name);
+		}
+		if (Node.Props.Num() > 0)
+		{
+			TSharedPtr<FJsonObject> PropsObj = MakeShareable(new FJsonObject());
+			for (const TPair<FString, FString>& Prop : Node.Props)
+			{
+				PropsObj->SetStringField(Prop.Key, Prop.Value);
+			}
+			NodeObj->SetObjectField(TEXT("props"), PropsObj);
+		}
+		for (int32 ListIndex = 0; ListIndex < 3; ++ListIndex)
+		{
+			if (Node.Lists[ListIndex].Num() > 0)
+			{
+				TArray<TSharedPtr<FJsonValue>> IdArray;
+				for (const FString& EntryId : Node.Lists[ListIndex])
+				{
+					IdArray.Add(MakeShareable(new FJsonValueString(EntryId)));
+				}
+				NodeObj->SetArrayField(BTSnapListNames[ListIndex], IdArray);
+			}
+		}
+		NodeObj->SetStringField(TEXT("hash"), Node.Hash);
+		NodesObj->SetObjectField(Pair.Key, NodeObj);
+	}
+
+	TSharedPtr<FJsonObject> SnapshotObj = MakeShareable(new FJsonObject());
+	SnapshotObj->SetNumberField(TEXT("format"), BTSnapshotFormat);
+	SnapshotObj->SetStringField(TEXT("behavior_tree"), Snapshot.TreePath);
+	SnapshotObj->SetStringField(TEXT("blackboard"), Snapshot.Blackboard);
+	SnapshotObj->SetStringField(TEXT("root"), Snapshot.RootId);
+	SnapshotObj->SetStringField(TEXT("hash"), Snapshot.Hash);
+	SnapshotObj->SetNumberField(TEXT("node_count"), Snapshot.Nodes.Num());
+	SnapshotObj->SetObjectField(TEXT("nodes"), NodesObj);
+	return SnapshotObj;
+}
+
+/** Parse a snapshot produced by get_bt_snapshot. Hashes are taken as given; a missing hash never matches. */
+bool BTSnapshotFromJson(const TSharedPtr<FJsonObject>& SnapshotObj, FBTSnapshot& OutSnapshot, FString& OutError)
+{
+	double Format = 0.0;
+	if (!SnapshotObj->TryGetNumberField(TEXT("format"), Format) || static_cast<int32>(Format) != BTSnapshotFormat)
+	{
+		OutError = FString::Printf(TEXT("unsupported snapshot format (expected %d)"), BTSnapshotFormat);
+		return false;
+	}
+
+	const TSharedPtr<FJsonObject>* NodesObj = nullptr;
+	if (!SnapshotObj->TryGetObjectField(TEXT("nodes"), NodesObj) || !NodesObj || !(*NodesObj).IsValid())
+	{
+		OutError = TEXT("snapshot has no 'nodes' object");
+		return false;
+	}
+
+	SnapshotObj->TryGetStringField(TEXT("behavior_tree"), OutSnapshot.TreePath);
+	SnapshotObj->TryGetStringField(TEXT("blackboard"), OutSnapshot.Blackboard);
+	SnapshotObj->TryGetStringField(TEXT("root"), OutSnapshot.RootId);
+	SnapshotObj->TryGetStringField(TEXT("hash"), OutSnapshot.Hash);
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*NodesObj)->Values)
+	{
+		const TSharedPtr<FJsonObject>* NodeObj = nullptr;
+		if (!Pair.Value.IsValid() || !Pair.Value->TryGetObject(NodeObj) || !NodeObj)
+		{
+			OutError = FString::Printf(TEXT("node '%s' is not an object"), *Pair.Key);
+			return false;
+		}
+
+		FBTSnapNode& Node = OutSnapshot.Nodes.Add(Pair.Key);
+		(*NodeObj)->TryGetStringField(TEXT("kind"), Node.Kind);
+		(*NodeObj)->TryGetStringField(TEXT("class"), Node.Class);
+		(*NodeObj)->TryGetStringField(TEXT("name"), Node.Name);
+		(*NodeObj)->TryGetStringField(TEXT("hash"), Node.Hash);
+
+		const TSharedPtr<FJsonObject>* PropsObj = nullptr;
+		if ((*NodeObj)->TryGetObjectField(TEXT("props"), PropsObj) && PropsObj && (*PropsObj).IsValid())
+		{
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Prop : (*PropsObj)->Values)
+			{
+				Node.Props.Emplace(Prop.Key, Prop.Value.IsValid() ? Prop.Value->AsString() : FString());
+			}
+			Node.Props.Sort([](const TPair<FString, FString>& A, const TPair<FString, FString>& B)
+			{
+				return A.Key < B.Key;
+			});
+		}
+
+		for (int32 ListIndex = 0; ListIndex < 3; ++ListIndex)
+		{
+			const TArray<TSharedPtr<FJsonValue>>* IdArray = nullptr;
+			if ((*NodeObj)->TryGetArrayField(BTSnapListNames[ListIndex], IdArray) && IdArray)
+			{
+				for (const TSharedPtr<FJsonValue>& IdValue : *IdArray)
+				{
+					Node.Lists[ListIndex].Add(IdValue.IsValid() ? IdValue->AsString() : FString());
+				}
+			}
+		}
+	}
+
+	if (!OutSnapshot.RootId.IsEmpty() && !OutSnapshot.Nodes.Contains(OutSnapshot.RootId))
+	{
+		OutError = FString::Printf(TEXT("root '%s' is not in 'nodes'"), *OutSnapshot.RootId);
+		return false;
+	}
+	return true;
+}
+
+/** Where a node sits in one snapshot */
+struct FBTSnapPlacement
+{
+	FString Parent;
+	int32 List = 2;
+};
+
+struct FBTSnapDiff
+{
+	const FBTSnapshot& Before;
+	const FBTSnapshot& After;
+
+	TMap<FString, FBTSnapPlacement> Removed;
+	TMap<FString, FBTSnapPlacement> Added;
+	TArray<TSharedPtr<FJsonValue>> Changed;
+	TArray<TSharedPtr<FJsonValue>> Reordered;
+	int32 NodesCompared = 0;
+	int32 SubtreesSkipped = 0;
+
+	FBTSnapDiff(const FBTSnapshot& InBefore, const FBTSnapshot& InAfter)
+		: Before(InBefore)
+		, After(InAfter)
+	{
+	}
+
+	static TSharedPtr<FJsonObject> MakeChange(const FString* BeforeValue, const FString* AfterValue)
+	{
+		TSharedPtr<FJsonObject> ChangeObj = MakeShareable(new FJsonObject());
+		if (BeforeValue)
+		{
+			ChangeObj->SetStringField(TEXT("before"), *BeforeValue);
+		}
+		else
+		{
+			ChangeObj->SetField(TEXT("before"), MakeShareable(new FJsonValueNull()));
+		}
+		if (AfterValue)
+		{
+			ChangeObj->SetStringField(TEXT("after"), *AfterValue);
+		}
+		else
+		{
+			ChangeObj->SetField(TEXT("after"), MakeShareable(new FJsonValueNull()));
+		}
+		return ChangeObj;
+	}
+
+	/** Class, name and property differences of a node present in both snapshots */
+	void DiffContent(const FString& Id, const FBTSnapNode& A, const FBTSnapNode& B)
+	{
+		TSharedPtr<FJsonObject> ChangesObj = MakeShareable(new FJsonObject());
+		if (A.Class != B.Class)
+		{
+			ChangesObj->SetObjectField(TEXT("class"), MakeChange(&A.Class, &B.Class));
+		}
+		if (A.Name != B.Name)
+		{
+			ChangesObj->SetObjectField(TEXT("name"), MakeChange(&A.Name, &B.Name));
+		}
+
+		// Both lists are sorted by name; a missing entry means the class default
+		TSharedPtr<FJsonObject> PropsObj = MakeShareable(new FJsonObject());
+		int32 IndexA = 0;
+		int32 IndexB = 0;
+		while (IndexA < A.Props.Num() || IndexB < B.Props.Num())
+		{
+			const TPair<FString, FString>* PropA = IndexA < A.Props.Num() ? &A.Props[IndexA] : nullptr;
+			const TPair<FString, FString>* PropB = IndexB < B.Props.Num() ? &B.Props[IndexB] : nullptr;
+			if (PropA && (!PropB || PropA->Key < PropB->Key))
+			{
+				PropsObj->SetObjectField(PropA->Key, MakeChange(&PropA->Value, nullptr));
+				++IndexA;
+			}
+			else if (PropB && (!PropA || PropB->Key < PropA->Key))
+			{
+				PropsObj->SetObjectField(PropB->Key, MakeChange(nullptr, &PropB->Value));
+				++IndexB;
+			}
+			else
+			{
+				if (PropA->Value != PropB->Value)
+				{
+					PropsObj->SetObjectField(PropA->Key, MakeChange(&PropA->Value, &PropB->Value));
+				}
+				++IndexA;
+				++IndexB;
+			}
+		}
+		if (PropsObj->Values.Num() > 0)
+		{
+			ChangesObj->SetObjectField(TEXT("props"), PropsObj);
+		}
+
+		if (ChangesObj->Values.Num() > 0)
+		{
+			TSharedPtr<FJsonObject> ChangedObj = MakeShareable(new FJsonObject());
+			ChangedObj->SetStringField(TEXT("id"), Id);
+			ChangedObj->SetStringField(TEXT("class"), B.Class);
+			ChangedObj->SetObjectField(TEXT("changes"), ChangesObj);
+			Changed.Add(MakeShareable(new FJsonValueObject(ChangedObj)));
+		}
+	}
+
+	/** Report a changed relative order of the entries both snapshots have in the same list */
+	void CheckOrder(const FString& Id, int32 ListIndex, const TArray<FString>& ListA, const TArray<FString>& ListB)
+	{
+		TArray<FString> CommonA;
+		TArray<FString> CommonB;
+		for (const FString& Entry : ListA)
+		{
+			if (ListB.Contains(Entry))
+			{
+				CommonA.Add(Entry);
+			}
+		}
+		for (const FString& Entry : ListB)
+		{
+			if (ListA.Contains(Entry))
+			{
+				CommonB.Add(Entry);
+			}
+		}
+		if (CommonA == CommonB)
+		{
+			return;
+		}
+
+		auto ToJsonArray = [](const TArray<FString>& Ids)
+		{
+			TArray<TSharedPtr<FJsonValue>> Values;
+			for (const FString& EntryId : Ids)
+			{
+				Values.Add(MakeShareable(new FJsonValueString(EntryId)));
+			}
+			return Values;
+		};
+
+		TSharedPtr<FJsonObject> ReorderObj = MakeShareable(new FJsonObject());
+		ReorderObj->SetStringField(TEXT("parent"), Id);
+		ReorderObj->SetStringField(TEXT("list"), BTSnapListNames[ListIndex]);
+		ReorderObj->SetArrayField(TEXT("before"), ToJsonArray(ListA));
+		ReorderObj->SetArrayField(TEXT("after"), ToJsonArray(ListB));
+		Reordered.Add(MakeShareable(new FJsonValueObject(ReorderObj)));
+	}
+
+	/** Record a whole subtree as present on one side only */
+	static void RecordSubtree(const FBTSnapshot& Snapshot, const FString& Id, const FBTSnapPlacement& Placement,
+		TMap<FString, FBTSnapPlacement>& OutMap)
+	{
+		const FBTSnapNode* Node = Snapshot.Nodes.Find(Id);
+		if (!Node || OutMap.Contains(Id))
+		{
+			return;
+		}
+		OutMap.Add(Id, Placement);
+		for (int32 ListIndex = 0; ListIndex < 3; ++ListIndex)
+		{
+			for (const FString& EntryId : Node->Lists[ListIndex])
+			{
+				RecordSubtree(Snapshot, EntryId, { Id, ListIndex }, OutMap);
+			}
+		}
+	}
+
+	/** Node present at the same place in both snapshots */
+	void DiffSubtree(const FString& Id)
+	{
+		const FBTSnapNode* A = Before.Nodes.Find(Id);
+		const FBTSnapNode* B = After.Nodes.Find(Id);
+		if (!A || !B)
+		{
+			return;
+		}
+		++NodesCompared;
+
+		if (!A->Hash.IsEmpty() && A->Hash == B->Hash)
+		{
+			++SubtreesSkipped;
+			return;
+		}
+
+		DiffContent(Id, *A, *B);
+		for (int32 ListIndex = 0; ListIndex < 3; ++ListIndex)
+		{
+			const TArray<FString>& ListA = A->Lists[ListIndex];
+			const TArray<FString>& ListB = B->Lists[ListIndex];
+			for (const FString& Entry : ListA)
+			{
+				if (ListB.Contains(Entry))
+				{
+					DiffSubtree(Entry);
+				}
+				else
+				{
+					RecordSubtree(Before, Entry, { Id, ListIndex }, Removed);
+				}
+			}
+			for (const FString& Entry : ListB)
+			{
+				if (!ListA.Contains(Entry))
+				{
+					RecordSubtree(After, Entry, { Id, ListIndex }, Added);
+				}
+			}
+			CheckOrder(Id, ListIndex, ListA, ListB);
+		}
+	}
+
+	/**
+	 * IDs that left one place and appeared in another were moved. Their descendants
+	 * were recorded on both sides too, so each is compared here without recursing.
+	 */
+	TArray<TSharedPtr<FJsonValue>> ResolveMoves()
+	{
+		TArray<TSharedPtr<FJsonValue>> Moved;
+		for (auto It = Removed.CreateIterator(); It; ++It)
+		{
+			const FString& Id = It.Key();
+			const FBTSnapPlacement* AddedPlacement = Added.Find(Id);
+			if (!AddedPlacement)
+			{
+				continue;
+			}
+
+			if (AddedPlacement->Parent != It.Value().Parent || AddedPlacement->List != It.Value().List)
+			{
+				TSharedPtr<FJsonObject> MoveObj = MakeShareable(new FJsonObject());
+				MoveObj->SetStringField(TEXT("id"), Id);
+				MoveObj->SetStringField(TEXT("from_parent"), It.Value().Parent);
+				MoveObj->SetStringField(TEXT("to_parent"), AddedPlacement->Parent);
+				MoveObj->SetStringField(TEXT("list"), BTSnapListNames[AddedPlacement->List]);
+				Moved.Add(MakeShareable(new FJsonValueObject(MoveObj)));
+			}
+
+			const FBTSnapNode& A = Before.Nodes.FindChecked(Id);
+			const FBTSnapNode& B = After.Nodes.FindChecked(Id);
+			++NodesCompared;
+			DiffContent(Id, A, B);
+			for (int32 ListIndex = 0; ListIndex < 3; ++ListIndex)
+			{
+				CheckOrder(Id, ListIndex, A.Lists[ListIndex], B.Lists[ListIndex]);
+			}
+
+			Added.Remove(Id);
+			It.RemoveCurrent();
+		}
+		return Moved;
+	}
+
+	static TArray<TSharedPtr<FJsonValue>> PlacementsToJson(const FBTSnapshot& Snapshot, const TMap<FString, FBTSnapPlacement>& Placements)
+	{
+		TArray<TSharedPtr<FJsonValue>> Values;
+		for (const TPair<FString, FBTSnapPlacement>& Pair : Placements)
+		{
+			const FBTSnapNode& Node = Snapshot.Nodes.FindChecked(Pair.Key);
+			TSharedPtr<FJsonObject> EntryObj = MakeShareable(new FJsonObject());
+			EntryObj->SetStringField(TEXT("id"), Pair.Key);
+			EntryObj->SetStringField(TEXT("kind"), Node.Kind);
+			EntryObj->SetStringField(TEXT("class"), Node.Class);
+			EntryObj->SetStringField(TEXT("parent"), Pair.Value.Parent);
+			Values.Add(MakeShareable(new FJsonValueObject(EntryObj)));
+		}
+		return Values;
+	}
+};
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleGetBTSnapshot(
+	const TSharedPtr<FJsonObject>& Params)
+{
+	// パラメータ取得
+	FString BehaviorTreeName;
+	TSharedPtr<FJsonObject> NameError = FSpirrowBridgeCommonUtils::ValidateRequiredString(
+		Params, TEXT("behavior_tree_name"), BehaviorTreeName);
+	if (NameError) return NameError;
+
+	FString Path;
+	FSpirrowBridgeCommonUtils::GetOptionalString(
+		Params, TEXT("path"), Path, TEXT("/Game/AI/BehaviorTrees"));
+
+	// BehaviorTree取得
+	UBehaviorTree* BehaviorTree = FindBehaviorTreeAsset(BehaviorTreeName, Path);
+	if (!BehaviorTree)
+	{
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::AssetNotFound,
+			FString::Printf(TEXT("BehaviorTree not found: %s at %s"), *BehaviorTreeName, *Path));
+	}
+
+	FBTSnapshot Snapshot;
+	if (!BuildLiveBTSnapshot(BehaviorTree, Snapshot))
+	{
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::GraphNotFound,
+			TEXT("BehaviorTree has no graph"));
+	}
+
+	TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject());
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetStringField(TEXT("behavior_tree_name"), BehaviorTreeName);
+	Result->SetObjectField(TEXT("snapshot"), BTSnapshotToJson(Snapshot));
+	return Result;
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleDiffBehaviorTree(
+	const TSharedPtr<FJsonObject>& Params)
+{
+	// パラメータ取得
+	const TSharedPtr<FJsonObject>* BeforeObj = nullptr;
+	if (!Params->TryGetObjectField(TEXT("before"), BeforeObj) || !BeforeObj || !(*BeforeObj).IsValid())
+	{
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::MissingRequiredParam,
+			TEXT("Missing 'before' parameter (a snapshot from get_bt_snapshot)"));
+	}
+
+	bool bIncludeSnapshot = false;
+	FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("include_snapshot"), bIncludeSnapshot, false);
+
+	FBTSnapshot Before;
+	FString ParseError;
+	if (!BTSnapshotFromJson(*BeforeObj, Before, ParseError))
+	{
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::InvalidParamValue,
+			FString::Printf(TEXT("Invalid 'before' snapshot: %s"), *ParseError));
+	}
+
+	// 比較対象: 'after' スナップショット、なければライブアセット
+	FBTSnapshot After;
+	bool bAfterIsLive = false;
+	const TSharedPtr<FJsonObject>* AfterObj = nullptr;
+	if (Params->TryGetObjectField(TEXT("after"), AfterObj) && AfterObj && (*AfterObj).IsValid())
+	{
+		if (!BTSnapshotFromJson(*AfterObj, After, ParseError))
+		{
+			return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+				ESpirrowErrorCode::InvalidParamValue,
+				FString::Printf(TEXT("Invalid 'after' snapshot: %s"), *ParseError));
+		}
+	}
+	else
+	{
+		FString BehaviorTreeName;
+		FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("behavior_tree_name"), BehaviorTreeName, TEXT(""));
+		FString Path;
+		FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("path"), Path, TEXT("/Game/AI/BehaviorTrees"));
+
+		UBehaviorTree* BehaviorTree = nullptr;
+		if (!BehaviorTreeName.IsEmpty())
+		{
+			BehaviorTree = FindBehaviorTreeAsset(BehaviorTreeName, Path);
+		}
+		else if (!Before.TreePath.IsEmpty())
+		{
+			BehaviorTree = LoadObject<UBehaviorTree>(nullptr, *Before.TreePath);
+		}
+		if (!BehaviorTree)
+		{
+			return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+				ESpirrowErrorCode::AssetNotFound,
+				BehaviorTreeName.IsEmpty()
+					? FString::Printf(TEXT("BehaviorTree not found: %s (pass 'after' or behavior_tree_name)"), *Before.TreePath)
+					: FString::Printf(TEXT("BehaviorTree not found: %s at %s"), *BehaviorTreeName, *Path));
+		}
+		if (!BuildLiveBTSnapshot(BehaviorTree, After))
+		{
+			return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+				ESpirrowErrorCode::GraphNotFound,
+				TEXT("BehaviorTree has no graph"));
+		}
+		bAfterIsLive = true;
+	}
+
+	// ハッシュが一致するサブツリーはスキップして比較
+	FBTSnapDiff Diff(Before, After);
+	const bool bIdentical = !Before.Hash.IsEmpty() && Before.Hash == After.Hash;
+	if (!bIdentical)
+	{
+		if (Before.RootId == After.RootId)
+		{
+			Diff.DiffSubtree(Before.RootId);
+		}
+		else
+		{
+			Diff.RecordSubtree(Before, Before.RootId, { TEXT("Root"), 2 }, Diff.Removed);
+			Diff.RecordSubtree(After, After.RootId, { TEXT("Root"), 2 }, Diff.Added);
+		}
+	}
+	TArray<TSharedPtr<FJsonValue>> Moved = Diff.ResolveMoves();
+
+	// レスポンス
+	TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject());
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetBoolField(TEXT("identical"), bIdentical);
+	Result->SetStringField(TEXT("before_hash"), Before.Hash);
+	Result->SetStringField(TEXT("after_hash"), After.Hash);
+	Result->SetBoolField(TEXT("after_is_live"), bAfterIsLive);
+	if (Before.Blackboard != After.Blackboard)
+	{
+		Result->SetObjectField(TEXT("blackboard"), FBTSnapDiff::MakeChange(&Before.Blackboard, &After.Blackboard));
+	}
+	Result->SetArrayField(TEXT("added"), FBTSnapDiff::PlacementsToJson(After, Diff.Added));
+	Result->SetArrayField(TEXT("removed"), FBTSnapDiff::PlacementsToJson(Before, Diff.Removed));
+	Result->SetArrayField(TEXT("moved"), Moved);
+	Result->SetArrayField(TEXT("changed"), Diff.Changed);
+	Result->SetArrayField(TEXT("reordered"), Diff.Reordered);
+	Result->SetNumberField(TEXT("nodes_compared"), Diff.NodesCompared);
+	Result->SetNumberField(TEXT("subtrees_skipped"), Diff.SubtreesSkipped);
+	if (bIncludeSnapshot)
+	{
+		Result->SetObjectField(TEXT("snapshot"), BTSnapshotToJson(After));
+	}
+	return Result;
+}
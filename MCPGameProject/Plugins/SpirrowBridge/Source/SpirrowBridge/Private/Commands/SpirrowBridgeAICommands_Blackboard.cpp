@@ -43,6 +43,35 @@ UClass* FSpirrowBridgeAICommands::GetBlackboardKeyTypeClass(const FString& TypeS
 	return nullptr;
 }
 
+UClass* FSpirrowBridgeAICommands::ResolveBlackboardBaseClass(const FString& ClassName)
+{
+	// Method 1: Try direct lookup (works for full paths like /Script/Engine.Actor)
+	UClass* FoundClass = FindObject<UClass>(nullptr, *ClassName);
+
+	// Method 2: Try with /Script/Engine prefix for common Engine classes
+	if (!FoundClass)
+	{
+		FString EnginePath = FString::Printf(TEXT("/Script/Engine.%s"), *ClassName);
+		FoundClass = FindObject<UClass>(nullptr, *EnginePath);
+	}
+
+	// Method 3: Try with /Script/CoreUObject prefix
+	if (!FoundClass)
+	{
+		FString CorePath = FString::Printf(TEXT("/Script/CoreUObject.%s"), *ClassName);
+		FoundClass = FindObject<UClass>(nullptr, *CorePath);
+	}
+
+	// Method 4: Use StaticLoadClass as fallback
+	if (!FoundClass)
+	{
+		FString ClassPath = FString::Printf(TEXT("/Script/Engine.%s"), *ClassName);
+		FoundClass = StaticLoadClass(UObject::StaticClass(), nullptr, *ClassPath);
+	}
+
+	return FoundClass;
+}
+
 TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::BlackboardKeyToJson(const FBlackboardEntry& Entry)
 {
 	TSharedPtr<FJsonObject> KeyJson = MakeShareable(new FJsonObject());
@@ -208,33 +237,8 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleAddBlackboardKey(
 	// Object/Classタイプの場合、BaseClassを設定
 	if (!BaseClass.IsEmpty())
 	{
-		// Try to find the class by various methods
-		UClass* FoundClass = nullptr;
-		
-		// Method 1: Try direct lookup (works for full paths like /Script/Engine.Actor)
-		FoundClass = FindObject<UClass>(nullptr, *BaseClass);
-		
-		// Method 2: Try with /Script/Engine prefix for common Engine classes
-		if (!FoundClass)
-		{
-			FString EnginePath = FString::Printf(TEXT("/Script/Engine.%s"), *BaseClass);
-			FoundClass = FindObject<UClass>(nullptr, *EnginePath);
-		}
-		
-		// Method 3: Try with /Script/CoreUObject prefix
-		if (!FoundClass)
-		{
-			FString CorePath = FString::Printf(TEXT("/Script/CoreUObject.%s"), *BaseClass);
-			FoundClass = FindObject<UClass>(nullptr, *CorePath);
-		}
-		
-		// Method 4: Use StaticLoadClass as fallback
-		if (!FoundClass)
-		{
-			FString ClassPath = FString::Printf(TEXT("/Script/Engine.%s"), *BaseClass);
-			FoundClass = StaticLoadClass(UObject::StaticClass(), nullptr, *ClassPath);
-		}
-		
+		UClass* FoundClass = ResolveBlackboardBaseClass(BaseClass);
+
 		if (FoundClass)
 		{
 			if (UBlackboardKeyType_Object* ObjectType = Cast<UBlackboardKeyType_Object>(NewEntry.KeyType))
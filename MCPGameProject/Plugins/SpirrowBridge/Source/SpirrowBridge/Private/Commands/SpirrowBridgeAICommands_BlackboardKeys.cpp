@@ -0,0 +1,691 @@
+#include "Commands/SpirrowBridgeAICommands.h"
+#include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeBlackboardKeyIndex.h"
+
+// BehaviorTree / Blackboard includes
+#include "BehaviorTree/BehaviorTree.h"
+#include "BehaviorTree/BehaviorTreeTypes.h"
+#include "BehaviorTree/BlackboardData.h"
+#include "BehaviorTree/BTNode.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Object.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Class.h"
+
+// Asset management includes
+#include "UObject/SavePackage.h"
+#include "Misc/PackageName.h"
+
+// ===== set_blackboard_keys / find_blackboard_key_usages =====
+//
+// add/remove_blackboard_key は1キーごとに保存し、参照している BehaviorTree を見ない。
+// set_blackboard_keys は操作列を先に全部検証してから（1つでも失敗すれば何も変更しない）
+// まとめて適用し、Blackboard を1回だけ保存する。キー参照の確認とリネームの伝播には
+// FSpirrowBridgeBlackboardKeyIndex（プロジェクト全体のキー使用箇所インデックス）を使う。
+
+namespace
+{
+	enum class EBlackboardKeyOp : uint8
+	{
+		Add,
+		Remove,
+		Retype,
+		Rename
+	};
+
+	struct FBlackboardKeyOperation
+	{
+		EBlackboardKeyOp Op = EBlackboardKeyOp::Add;
+		FString OpName;
+		FName KeyName;
+		FName NewName;
+		FString KeyTypeName;
+		UClass* KeyTypeClass = nullptr;
+		UClass* BaseClass = nullptr;
+		bool bHasInstanceSynced = false;
+		bool bInstanceSynced = false;
+
+		/** Key name before this request; None for keys added earlier in the same request */
+		FName OriginalName;
+
+		FString Error;
+		TArray<int32> References;
+		int32 NumBroken = 0;
+	};
+
+	/** Key state while validating operations in order */
+	struct FSimulatedKey
+	{
+		FName Name;
+		FName OriginalName;
+	};
+
+	/** Cap on references listed per operation / key in responses */
+	constexpr int32 MaxListedReferences = 100;
+
+	void SetKeyBaseClass(UBlackboardKeyType* KeyType, UClass* BaseClass)
+	{
+		if (!BaseClass)
+		{
+			return;
+		}
+		if (UBlackboardKeyType_Object* ObjectType = Cast<UBlackboardKeyType_Object>(KeyType))
+		{
+			ObjectType->BaseClass = BaseClass;
+		}
+		else if (UBlackboardKeyType_Class* ClassType = Cast<UBlackboardKeyType_Class>(KeyType))
+		{
+			ClassType->BaseClass = BaseClass;
+		}
+	}
+
+	bool SaveAssetPackage(UObject* Asset)
+	{
+		Asset->MarkPackageDirty();
+		UPackage* Package = Asset->GetOutermost();
+		FString PackageFileName = FPackageName::LongPackageNameToFilename(
+			Package->GetName(), FPackageName::GetAssetPackageExtension());
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+		return UPackage::SavePackage(Package, Asset, *PackageFileName, SaveArgs);
+	}
+
+	TSharedPtr<FJsonObject> KeyUsageToJson(const FSpirrowBridgeBlackboardKeyIndex::FUsage& Usage)
+	{
+		TSharedPtr<FJsonObject> UsageObj = MakeShareable(new FJsonObject());
+		UsageObj->SetStringField(TEXT("behavior_tree"), Usage.TreeName);
+		UsageObj->SetStringField(TEXT("path"), Usage.TreePath);
+		UsageObj->SetStringField(TEXT("node_id"), Usage.NodeId);
+		UsageObj->SetStringField(TEXT("node_class"), Usage.NodeClass);
+		UsageObj->SetStringField(TEXT("property"), Usage.Property);
+		return UsageObj;
+	}
+
+	TSharedPtr<FJsonObject> IndexStatsToJson(const FSpirrowBridgeBlackboardKeyIndex::FUpdateStats& Stats)
+	{
+		TSharedPtr<FJsonObject> IndexObj = MakeShareable(new FJsonObject());
+		IndexObj->SetNumberField(TEXT("tree_count"), Stats.NumTrees);
+		IndexObj->SetNumberField(TEXT("indexed_count"), Stats.Indexed);
+		IndexObj->SetNumberField(TEXT("loaded_count"), Stats.Loaded);
+		IndexObj->SetNumberField(TEXT("load_failed_count"), Stats.LoadFailed);
+		IndexObj->SetNumberField(TEXT("time_ms"), Stats.TimeMs);
+		return IndexObj;
+	}
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleSetBlackboardKeys(
+	const TSharedPtr<FJsonObject>& Params)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	// パラメータ検証
+	FString BlackboardName;
+	TSharedPtr<FJsonObject> BlackboardNameError = FSpirrowBridgeCommonUtils::ValidateRequiredString(Params, TEXT("blackboard_name"), BlackboardName);
+	if (BlackboardNameError)
+	{
+		return BlackboardNameError;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* OperationsArray = nullptr;
+	if (!Params->TryGetArrayField(TEXT("operations"), OperationsArray) || !OperationsArray || OperationsArray->Num() == 0)
+	{
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::MissingRequiredParam,
+			TEXT("'operations' must be a non-empty array of {op, key_name, ...}"));
+	}
+
+	FString Path;
+	FSpirrowBridgeCommonUtils::GetOptionalString(
+		Params, TEXT("path"), Path, TEXT("/Game/AI/Blackboards"));
+	bool bPropagate = true;
+	FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("propagate"), bPropagate, true);
+	bool bForce = false;
+	FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("force"), bForce, false);
+	bool bDryRun = false;
+	FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("dry_run"), bDryRun, false);
+
+	// Blackboard検索
+	UBlackboardData* Blackboard = FindBlackboardAsset(BlackboardName, Path);
+	if (!Blackboard)
+	{
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::AssetNotFound,
+			FString::Printf(TEXT("Blackboard not found: %s at %s"), *BlackboardName, *Path));
+	}
+
+	// 親 Blackboard のキー（子で同名キーは追加できない）
+	TMap<FName, FString> InheritedKeys;
+	for (const UBlackboardData* It = Blackboard->Parent; It; It = It->Parent)
+	{
+		for (const FBlackboardEntry& Entry : It->Keys)
+		{
+			InheritedKeys.Add(Entry.EntryName, It->GetName());
+		}
+	}
+
+	TArray<FSimulatedKey> SimKeys;
+	for (const FBlackboardEntry& Entry : Blackboard->Keys)
+	{
+		SimKeys.Add({ Entry.EntryName, Entry.EntryName });
+	}
+	auto FindSimKey = [&SimKeys](FName Name)
+	{
+		return SimKeys.IndexOfByPredicate([Name](const FSimulatedKey& Key) { return Key.Name == Name; });
+	};
+	auto CheckNameFree = [&FindSimKey, &InheritedKeys](FName Name, FString& OutError)
+	{
+		if (FindSimKey(Name) != INDEX_NONE)
+		{
+			OutError = FString::Printf(TEXT("Key already exists: %s"), *Name.ToString());
+			return false;
+		}
+		if (const FString* ParentName = InheritedKeys.Find(Name))
+		{
+			OutError = FString::Printf(TEXT("Key '%s' is already declared by parent Blackboard '%s'"), *Name.ToString(), **ParentName);
+			return false;
+		}
+		return true;
+	};
+
+	// ===== 1. 操作を順に検証（キー状態はシミュレーションのみ） =====
+	TArray<FBlackboardKeyOperation> Operations;
+	Operations.SetNum(OperationsArray->Num());
+	for (int32 OpIndex = 0; OpIndex < OperationsArray->Num(); ++OpIndex)
+	{
+		FBlackboardKeyOperation& Operation = Operations[OpIndex];
+
+		const TSharedPtr<FJsonObject>* OpObj = nullptr;
+		if (!(*OperationsArray)[OpIndex].IsValid() || !(*OperationsArray)[OpIndex]->TryGetObject(OpObj) || !OpObj || !(*OpObj).IsValid())
+		{
+			Operation.Error = TEXT("Operation must be an object");
+			continue;
+		}
+
+		FString KeyName;
+		(*OpObj)->TryGetStringField(TEXT("op"), Operation.OpName);
+		(*OpObj)->TryGetStringField(TEXT("key_name"), KeyName);
+		Operation.KeyName = FName(*KeyName);
+
+		const FString OpName = Operation.OpName.ToLower();
+		if (OpName == TEXT("add"))
+		{
+			Operation.Op = EBlackboardKeyOp::Add;
+		}
+		else if (OpName == TEXT("remove"))
+		{
+			Operation.Op = EBlackboardKeyOp::Remove;
+		}
+		else if (OpName == TEXT("retype"))
+		{
+			Operation.Op = EBlackboardKeyOp::Retype;
+		}
+		else if (OpName == TEXT("rename"))
+		{
+			Operation.Op = EBlackboardKeyOp::Rename;
+		}
+		else
+		{
+			Operation.Error = FString::Printf(TEXT("Unknown op '%s' (expected add, remove, retype or rename)"), *Operation.OpName);
+			continue;
+		}
+
+		if (KeyName.IsEmpty())
+		{
+			Operation.Error = TEXT("key_name is required");
+			continue;
+		}
+
+		// add / retype: キータイプと BaseClass
+		if (Operation.Op == EBlackboardKeyOp::Add || Operation.Op == EBlackboardKeyOp::Retype)
+		{
+			(*OpObj)->TryGetStringField(TEXT("key_type"), Operation.KeyTypeName);
+			Operation.KeyTypeClass = GetBlackboardKeyTypeClass(Operation.KeyTypeName);
+			if (!Operation.KeyTypeClass)
+			{
+				Operation.Error = FString::Printf(TEXT("Invalid key type: %s"), *Operation.KeyTypeName);
+				continue;
+			}
+
+			FString BaseClassName;
+			if ((*OpObj)->TryGetStringField(TEXT("base_class"), BaseClassName) && !BaseClassName.IsEmpty())
+			{
+				Operation.BaseClass = ResolveBlackboardBaseClass(BaseClassName);
+				if (!Operation.BaseClass)
+				{
+					Operation.Error = FString::Printf(TEXT("Could not find base_class: %s"), *BaseClassName);
+					continue;
+				}
+			}
+
+			Operation.bHasInstanceSynced = (*OpObj)->TryGetBoolField(TEXT("instance_synced"), Operation.bInstanceSynced);
+		}
+
+		if (Operation.Op == EBlackboardKeyOp::Add)
+		{
+			if (!CheckNameFree(Operation.KeyName, Operation.Error))
+			{
+				continue;
+			}
+			SimKeys.Add({ Operation.KeyName, NAME_None });
+			continue;
+		}
+
+		// remove / retype / rename: 既存キーが対象
+		const int32 SimIndex = FindSimKey(Operation.KeyName);
+		if (SimIndex == INDEX_NONE)
+		{
+			const FString* ParentName = InheritedKeys.Find(Operation.KeyName);
+			Operation.Error = ParentName
+				? FString::Printf(TEXT("Key '%s' is declared by parent Blackboard '%s'; edit it there"), *KeyName, **ParentName)
+				: FString::Printf(TEXT("Key not found: %s"), *KeyName);
+			continue;
+		}
+		Operation.OriginalName = SimKeys[SimIndex].OriginalName;
+
+		if (Operation.Op == EBlackboardKeyOp::Remove)
+		{
+			SimKeys.RemoveAt(SimIndex);
+		}
+		else if (Operation.Op == EBlackboardKeyOp::Rename)
+		{
+			FString NewName;
+			(*OpObj)->TryGetStringField(TEXT("new_name"), NewName);
+			if (NewName.IsEmpty())
+			{
+				Operation.Error = TEXT("new_name is required for rename");
+				continue;
+			}
+			Operation.NewName = FName(*NewName);
+			if (!CheckNameFree(Operation.NewName, Operation.Error))
+			{
+				continue;
+			}
+			SimKeys[SimIndex].Name = Operation.NewName;
+		}
+	}
+
+	int32 FailedCount = Operations.FilterByPredicate([](const FBlackboardKeyOperation& Operation) { return !Operation.Error.IsEmpty(); }).Num();
+
+	// ===== 2. 既存キーへの参照を確認 =====
+	TSet<FName> ReferencedNames;
+	for (const FBlackboardKeyOperation& Operation : Operations)
+	{
+		if (Operation.Error.IsEmpty() && !Operation.OriginalName.IsNone())
+		{
+			ReferencedNames.Add(Operation.OriginalName);
+		}
+	}
+
+	FSpirrowBridgeBlackboardKeyIndex& KeyIndex = FSpirrowBridgeBlackboardKeyIndex::Get();
+	FSpirrowBridgeBlackboardKeyIndex::FUpdateStats IndexStats;
+	TArray<FSpirrowBridgeBlackboardKeyIndex::FUsage> Usages;
+	const bool bCheckReferences = FailedCount == 0 && ReferencedNames.Num() > 0;
+	if (bCheckReferences)
+	{
+		KeyIndex.Update(IndexStats);
+		KeyIndex.FindUsages(Blackboard, &ReferencedNames, Usages);
+	}
+
+	// 元の名前 -> 最終的な名前（途中で削除されたキーは含めない）
+	TMap<FName, FName> RenameMap;
+	for (const FSimulatedKey& Key : SimKeys)
+	{
+		if (!Key.OriginalName.IsNone() && Key.Name != Key.OriginalName)
+		{
+			RenameMap.Add(Key.OriginalName, Key.Name);
+		}
+	}
+
+	for (FBlackboardKeyOperation& Operation : Operations)
+	{
+		if (!Operation.Error.IsEmpty() || Operation.OriginalName.IsNone())
+		{
+			continue;
+		}
+
+		TSet<FString> Trees;
+		TSet<FString> BrokenTrees;
+		for (int32 UsageIndex = 0; UsageIndex < Usages.Num(); ++UsageIndex)
+		{
+			const FSpirrowBridgeBlackboardKeyIndex::FUsage& Usage = Usages[UsageIndex];
+			if (Usage.KeyName != Operation.OriginalName)
+			{
+				continue;
+			}
+			Operation.References.Add(UsageIndex);
+			Trees.Add(Usage.TreePath);
+
+			bool bBroken = false;
+			switch (Operation.Op)
+			{
+			case EBlackboardKeyOp::Remove:
+				bBroken = true;
+				break;
+			case EBlackboardKeyOp::Rename:
+				bBroken = !bPropagate;
+				break;
+			case EBlackboardKeyOp::Retype:
+				// キーセレクタの型フィルタに新しい型が含まれない
+				bBroken = Usage.AllowedTypes.Num() > 0 && !Usage.AllowedTypes.Contains(Operation.KeyTypeClass->GetFName());
+				break;
+			default:
+				break;
+			}
+			if (bBroken)
+			{
+				++Operation.NumBroken;
+				BrokenTrees.Add(Usage.TreePath);
+			}
+		}
+
+		if (Operation.NumBroken > 0 && !bForce)
+		{
+			const TCHAR* Reason = Operation.Op == EBlackboardKeyOp::Remove ? TEXT("still reference the key")
+				: Operation.Op == EBlackboardKeyOp::Rename ? TEXT("reference the key and propagate is false")
+				: TEXT("do not accept the new key type");
+			Operation.Error = FString::Printf(TEXT("%d key selector(s) in %d BehaviorTree(s) %s; pass force=true to apply anyway"),
+				Operation.NumBroken, BrokenTrees.Num(), Reason);
+			++FailedCount;
+		}
+	}
+
+	// ===== 結果 JSON（検証結果） =====
+	TArray<TSharedPtr<FJsonValue>> Results;
+	for (int32 OpIndex = 0; OpIndex < Operations.Num(); ++OpIndex)
+	{
+		const FBlackboardKeyOperation& Operation = Operations[OpIndex];
+
+		TSharedPtr<FJsonObject> Entry = MakeShareable(new FJsonObject());
+		Entry->SetNumberField(TEXT("index"), OpIndex);
+		Entry->SetStringField(TEXT("op"), Operation.OpName);
+		if (!Operation.KeyName.IsNone())
+		{
+			Entry->SetStringField(TEXT("key_name"), Operation.KeyName.ToString());
+		}
+		if (!Operation.NewName.IsNone())
+		{
+			Entry->SetStringField(TEXT("new_name"), Operation.NewName.ToString());
+		}
+		if (Operation.KeyTypeClass)
+		{
+			Entry->SetStringField(TEXT("key_type"), Operation.KeyTypeName);
+		}
+		Entry->SetBoolField(TEXT("success"), Operation.Error.IsEmpty());
+		if (!Operation.Error.IsEmpty())
+		{
+			Entry->SetStringField(TEXT("error"), Operation.Error);
+		}
+
+		if (bCheckReferences && !Operation.OriginalName.IsNone())
+		{
+			Entry->SetNumberField(TEXT("reference_count"), Operation.References.Num());
+			Entry->SetNumberField(TEXT("broken_reference_count"), Operation.NumBroken);
+
+			TArray<TSharedPtr<FJsonValue>> ReferencesArray;
+			for (const int32 UsageIndex : Operation.References)
+			{
+				if (ReferencesArray.Num() >= MaxListedReferences)
+				{
+					Entry->SetBoolField(TEXT("references_truncated"), true);
+					break;
+				}
+				ReferencesArray.Add(MakeShareable(new FJsonValueObject(KeyUsageToJson(Usages[UsageIndex]))));
+			}
+			Entry->SetArrayField(TEXT("references"), ReferencesArray);
+		}
+
+		Results.Add(MakeShareable(new FJsonValueObject(Entry)));
+	}
+
+	TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject());
+	// 検証エラーでも success は true（false だとラッパーが results を捨てる）。applied / failed_count で判定
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetStringField(TEXT("blackboard_name"), BlackboardName);
+	Result->SetBoolField(TEXT("dry_run"), bDryRun);
+	Result->SetNumberField(TEXT("succeeded_count"), Operations.Num() - FailedCount);
+	Result->SetNumberField(TEXT("failed_count"), FailedCount);
+	Result->SetArrayField(TEXT("results"), Results);
+	if (bCheckReferences)
+	{
+		Result->SetObjectField(TEXT("index"), IndexStatsToJson(IndexStats));
+	}
+
+	// 1つでも失敗していれば何も変更しない
+	if (FailedCount > 0 || bDryRun)
+	{
+		Result->SetBoolField(TEXT("applied"), false);
+		Result->SetNumberField(TEXT("time_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+		return Result;
+	}
+
+	// ===== 3. Blackboard に適用して1回保存 =====
+	for (const FBlackboardKeyOperation& Operation : Operations)
+	{
+		const int32 KeyIndexInAsset = Blackboard->Keys.IndexOfByPredicate([&Operation](const FBlackboardEntry& Entry)
+		{
+			return Entry.EntryName == Operation.KeyName;
+		});
+
+		switch (Operation.Op)
+		{
+		case EBlackboardKeyOp::Add:
+		{
+			FBlackboardEntry NewEntry;
+			NewEntry.EntryName = Operation.KeyName;
+			NewEntry.KeyType = NewObject<UBlackboardKeyType>(Blackboard, Operation.KeyTypeClass);
+			NewEntry.bInstanceSynced = Operation.bInstanceSynced;
+			SetKeyBaseClass(NewEntry.KeyType, Operation.BaseClass);
+			Blackboard->Keys.Add(NewEntry);
+			break;
+		}
+		case EBlackboardKeyOp::Remove:
+			Blackboard->Keys.RemoveAt(KeyIndexInAsset);
+			break;
+		case EBlackboardKeyOp::Retype:
+		{
+			FBlackboardEntry& Entry = Blackboard->Keys[KeyIndexInAsset];
+			Entry.KeyType = NewObject<UBlackboardKeyType>(Blackboard, Operation.KeyTypeClass);
+			SetKeyBaseClass(Entry.KeyType, Operation.BaseClass);
+			if (Operation.bHasInstanceSynced)
+			{
+				Entry.bInstanceSynced = Operation.bInstanceSynced;
+			}
+			break;
+		}
+		case EBlackboardKeyOp::Rename:
+			Blackboard->Keys[KeyIndexInAsset].EntryName = Operation.NewName;
+			break;
+		}
+	}
+
+	const bool bSaved = SaveAssetPackage(Blackboard);
+
+	// ===== 4. リネームを参照元 BehaviorTree に伝播（ツリーごとに1回保存） =====
+	TMap<FString, TSet<FString>> SelectorsByTree;
+	if (bPropagate)
+	{
+		for (const FSpirrowBridgeBlackboardKeyIndex::FUsage& Usage : Usages)
+		{
+			if (RenameMap.Contains(Usage.KeyName))
+			{
+				SelectorsByTree.FindOrAdd(Usage.TreePath).Add(Usage.NodeId + TEXT("|") + Usage.Property);
+			}
+		}
+	}
+
+	TArray<TSharedPtr<FJsonValue>> TreesArray;
+	int32 SelectorsUpdated = 0;
+	int32 TreesFailed = 0;
+	for (const TPair<FString, TSet<FString>>& TreePair : SelectorsByTree)
+	{
+		TSharedPtr<FJsonObject> TreeObj = MakeShareable(new FJsonObject());
+		TreeObj->SetStringField(TEXT("path"), TreePair.Key);
+
+		UBehaviorTree* BehaviorTree = LoadObject<UBehaviorTree>(nullptr, *TreePair.Key);
+		if (!BehaviorTree)
+		{
+			TreeObj->SetStringField(TEXT("error"), TEXT("Failed to load BehaviorTree"));
+			TreesArray.Add(MakeShareable(new FJsonValueObject(TreeObj)));
+			++TreesFailed;
+			continue;
+		}
+
+		int32 TreeSelectorsUpdated = 0;
+		UBlackboardData* TreeBlackboard = BehaviorTree->BlackboardAsset;
+		FSpirrowBridgeBlackboardKeyIndex::ForEachNodeInstance(BehaviorTree, [&](UBTNode* Node)
+		{
+			FSpirrowBridgeBlackboardKeyIndex::ForEachKeySelector(Node, [&](FBlackboardKeySelector& Selector, const FString& Property)
+			{
+				const FName* NewName = RenameMap.Find(Selector.SelectedKeyName);
+				if (!NewName || !TreePair.Value.Contains(Node->GetName() + TEXT("|") + Property))
+				{
+					return;
+				}
+				Selector.SelectedKeyName = *NewName;
+				if (TreeBlackboard)
+				{
+					Selector.ResolveSelectedKey(*TreeBlackboard);
+				}
+				++TreeSelectorsUpdated;
+			});
+		});
+
+		TreeObj->SetStringField(TEXT("behavior_tree"), BehaviorTree->GetName());
+		TreeObj->SetNumberField(TEXT("selectors_updated"), TreeSelectorsUpdated);
+		if (TreeSelectorsUpdated > 0)
+		{
+			const bool bTreeSaved = SaveAssetPackage(BehaviorTree);
+			TreeObj->SetBoolField(TEXT("saved"), bTreeSaved);
+			TreesFailed += bTreeSaved ? 0 : 1;
+		}
+		SelectorsUpdated += TreeSelectorsUpdated;
+		TreesArray.Add(MakeShareable(new FJsonValueObject(TreeObj)));
+	}
+
+	Result->SetBoolField(TEXT("applied"), true);
+	Result->SetBoolField(TEXT("saved"), bSaved);
+	Result->SetNumberField(TEXT("total_keys"), Blackboard->Keys.Num());
+	if (RenameMap.Num() > 0)
+	{
+		TSharedPtr<FJsonObject> PropagationObj = MakeShareable(new FJsonObject());
+		PropagationObj->SetBoolField(TEXT("enabled"), bPropagate);
+		PropagationObj->SetNumberField(TEXT("trees_updated"), SelectorsByTree.Num() - TreesFailed);
+		PropagationObj->SetNumberField(TEXT("trees_failed"), TreesFailed);
+		PropagationObj->SetNumberField(TEXT("selectors_updated"), SelectorsUpdated);
+		PropagationObj->SetArrayField(TEXT("trees"), TreesArray);
+		Result->SetObjectField(TEXT("propagation"), PropagationObj);
+	}
+	Result->SetNumberField(TEXT("time_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	return Result;
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeAICommands::HandleFindBlackboardKeyUsages(
+	const TSharedPtr<FJsonObject>& Params)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	// パラメータ検証
+	FString BlackboardName;
+	TSharedPtr<FJsonObject> BlackboardNameError = FSpirrowBridgeCommonUtils::ValidateRequiredString(Params, TEXT("blackboard_name"), BlackboardName);
+	if (BlackboardNameError)
+	{
+		return BlackboardNameError;
+	}
+
+	FString Path;
+	FSpirrowBridgeCommonUtils::GetOptionalString(
+		Params, TEXT("path"), Path, TEXT("/Game/AI/Blackboards"));
+	FString KeyName;
+	FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("key_name"), KeyName, TEXT(""));
+
+	// Blackboard検索
+	UBlackboardData* Blackboard = FindBlackboardAsset(BlackboardName, Path);
+	if (!Blackboard)
+	{
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::AssetNotFound,
+			FString::Printf(TEXT("Blackboard not found: %s at %s"), *BlackboardName, *Path));
+	}
+
+	// 対象キー（この Blackboard 自身が宣言するキーのみ）
+	TArray<const FBlackboardEntry*> Keys;
+	for (const FBlackboardEntry& Entry : Blackboard->Keys)
+	{
+		if (KeyName.IsEmpty() || Entry.EntryName == FName(*KeyName))
+		{
+			Keys.Add(&Entry);
+		}
+	}
+	if (!KeyName.IsEmpty() && Keys.Num() == 0)
+	{
+		const UBlackboardData* Declaring = FSpirrowBridgeBlackboardKeyIndex::FindDeclaringBlackboard(Blackboard, FName(*KeyName));
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::InvalidParameter,
+			Declaring
+				? FString::Printf(TEXT("Key '%s' is declared by parent Blackboard '%s'; query that Blackboard"), *KeyName, *Declaring->GetName())
+				: FString::Printf(TEXT("Key not found: %s"), *KeyName));
+	}
+
+	// インデックス更新（新規・変更されたツリーのみ）と検索
+	FSpirrowBridgeBlackboardKeyIndex& KeyIndex = FSpirrowBridgeBlackboardKeyIndex::Get();
+	FSpirrowBridgeBlackboardKeyIndex::FUpdateStats IndexStats;
+	KeyIndex.Update(IndexStats);
+
+	TSet<FName> KeyNames;
+	for (const FBlackboardEntry* Entry : Keys)
+	{
+		KeyNames.Add(Entry->EntryName);
+	}
+	TArray<FSpirrowBridgeBlackboardKeyIndex::FUsage> Usages;
+	KeyIndex.FindUsages(Blackboard, &KeyNames, Usages);
+
+	// キーごとに JSON 化
+	TArray<TSharedPtr<FJsonValue>> KeysArray;
+	TArray<TSharedPtr<FJsonValue>> UnusedKeys;
+	TSet<FString> AllTrees;
+	for (const FBlackboardEntry* Entry : Keys)
+	{
+		TSharedPtr<FJsonObject> KeyObj = BlackboardKeyToJson(*Entry);
+
+		TArray<TSharedPtr<FJsonValue>> UsagesArray;
+		TSet<FString> KeyTrees;
+		int32 UsageCount = 0;
+		for (const FSpirrowBridgeBlackboardKeyIndex::FUsage& Usage : Usages)
+		{
+			if (Usage.KeyName != Entry->EntryName)
+			{
+				continue;
+			}
+			++UsageCount;
+			KeyTrees.Add(Usage.TreePath);
+			if (UsagesArray.Num() < MaxListedReferences)
+			{
+				UsagesArray.Add(MakeShareable(new FJsonValueObject(KeyUsageToJson(Usage))));
+			}
+		}
+		AllTrees.Append(KeyTrees);
+
+		KeyObj->SetNumberField(TEXT("usage_count"), UsageCount);
+		KeyObj->SetNumberField(TEXT("tree_count"), KeyTrees.Num());
+		KeyObj->SetArrayField(TEXT("usages"), UsagesArray);
+		if (UsageCount > UsagesArray.Num())
+		{
+			KeyObj->SetBoolField(TEXT("usages_truncated"), true);
+		}
+		if (UsageCount == 0)
+		{
+			UnusedKeys.Add(MakeShareable(new FJsonValueString(Entry->EntryName.ToString())));
+		}
+		KeysArray.Add(MakeShareable(new FJsonValueObject(KeyObj)));
+	}
+
+	// レスポンス作成
+	TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject());
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetStringField(TEXT("blackboard_name"), BlackboardName);
+	Result->SetArrayField(TEXT("keys"), KeysArray);
+	Result->SetArrayField(TEXT("unused_keys"), UnusedKeys);
+	Result->SetNumberField(TEXT("usage_count"), Usages.Num());
+	Result->SetNumberField(TEXT("tree_count"), AllTrees.Num());
+	Result->SetObjectField(TEXT("index"), IndexStatsToJson(IndexStats));
+	Result->SetNumberField(TEXT("time_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	return Result;
+}
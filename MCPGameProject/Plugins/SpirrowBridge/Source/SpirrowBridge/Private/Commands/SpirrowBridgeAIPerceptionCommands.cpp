@@ -58,6 +58,10 @@ TSharedPtr<FJsonObject> FSpirrowBridgeAIPerceptionCommands::HandleCommand(const
 	{
 		return HandleAddPerceptionStimuliSource(Params);
 	}
+	else if (CommandType == TEXT("configure_perception_bulk"))
+	{
+		return HandleConfigurePerceptionBulk(Params);
+	}
 
 	return FSpirrowBridgeCommonUtils::CreateErrorResponse(
 		ESpirrowErrorCode::UnknownCommand,
@@ -0,0 +1,554 @@
+#include "Commands/SpirrowBridgeAIPerceptionCommands.h"
+#include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeClassHierarchyCache.h"
+#include "Commands/SpirrowBridgeCompileQueue.h"
+
+// Actor includes
+#include "GameFramework/Actor.h"
+
+// Blueprint includes
+#include "Engine/Blueprint.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "Engine/SCS_Node.h"
+#include "Engine/InheritableComponentHandler.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "EditorAssetLibrary.h"
+#include "FileHelpers.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+
+// AI Perception includes
+#include "Perception/AIPerceptionComponent.h"
+#include "Perception/AISenseConfig.h"
+#include "Perception/AISenseConfig_Sight.h"
+#include "Perception/AISenseConfig_Hearing.h"
+#include "Perception/AISenseConfig_Damage.h"
+
+// ===== configure_perception_bulk =====
+//
+// The single-Blueprint configure_*_sense commands compile (structurally) and save per call.
+// Here every target is edited first; the changed Blueprints are then marked modified (a sense
+// config lives on the component template, so the class layout does not change), compiled as
+// one FBlueprintCompilationManager batch and saved with one SavePackages call. Targets are
+// loaded up front with all async requests in flight at once.
+
+namespace
+{
+	UClass* GetSenseConfigClass(const FString& SenseType)
+	{
+		if (SenseType.Equals(TEXT("Sight"), ESearchCase::IgnoreCase))
+		{
+			return UAISenseConfig_Sight::StaticClass();
+		}
+		else if (SenseType.Equals(TEXT("Hearing"), ESearchCase::IgnoreCase))
+		{
+			return UAISenseConfig_Hearing::StaticClass();
+		}
+		else if (SenseType.Equals(TEXT("Damage"), ESearchCase::IgnoreCase))
+		{
+			return UAISenseConfig_Damage::StaticClass();
+		}
+
+		return nullptr;
+	}
+
+	/** Same match as the single-Blueprint handlers: by variable name, or the first perception component for the default name */
+	USCS_Node* FindPerceptionNode(const USimpleConstructionScript* SCS, const FString& ComponentName)
+	{
+		if (!SCS)
+		{
+			return nullptr;
+		}
+
+		for (USCS_Node* Node : SCS->GetAllNodes())
+		{
+			if (Node && Node->ComponentClass && Node->ComponentClass->IsChildOf(UAIPerceptionComponent::StaticClass()))
+			{
+				if (Node->GetVariableName() == FName(*ComponentName) || ComponentName == TEXT("AIPerceptionComponent"))
+				{
+					return Node;
+				}
+			}
+		}
+
+		return nullptr;
+	}
+
+	UAISenseConfig* FindSenseConfig(UAIPerceptionComponent* PerceptionComp, UClass* ConfigClass)
+	{
+		for (auto It = PerceptionComp->GetSensesConfigIterator(); It; ++It)
+		{
+			UAISenseConfig* Config = *It;
+			if (Config && Config->IsA(ConfigClass))
+			{
+				return Config;
+			}
+		}
+
+		return nullptr;
+	}
+
+	/** Blueprint name, package path or object path -> object path */
+	FString ResolveBlueprintObjectPath(const FString& NameOrPath, const FString& Path)
+	{
+		if (!NameOrPath.StartsWith(TEXT("/")))
+		{
+			return FString::Printf(TEXT("%s/%s.%s"), *Path, *NameOrPath, *NameOrPath);
+		}
+		if (NameOrPath.Contains(TEXT(".")))
+		{
+			return NameOrPath;
+		}
+		return FString::Printf(TEXT("%s.%s"), *NameOrPath, *FPackageName::GetShortName(NameOrPath));
+	}
+
+	TSharedPtr<FJsonObject> MakeChange(const FString& Field, const TSharedPtr<FJsonValue>& OldValue, const TSharedPtr<FJsonValue>& NewValue)
+	{
+		TSharedPtr<FJsonObject> Change = MakeShareable(new FJsonObject);
+		Change->SetStringField(TEXT("field"), Field);
+		Change->SetField(TEXT("old"), OldValue);
+		Change->SetField(TEXT("new"), NewValue);
+		return Change;
+	}
+
+	void ApplyFloatParam(float& Field, const TCHAR* Key, double Default, const TSharedPtr<FJsonObject>& Params,
+		bool bNewConfig, bool bWrite, TArray<TSharedPtr<FJsonValue>>& OutChanges)
+	{
+		double Value = Default;
+		if (!Params->TryGetNumberField(Key, Value) && !bNewConfig)
+		{
+			return;
+		}
+
+		if (!FMath::IsNearlyEqual(static_cast<double>(Field), Value))
+		{
+			OutChanges.Add(MakeShareable(new FJsonValueObject(MakeChange(Key,
+				MakeShareable(new FJsonValueNumber(Field)), MakeShareable(new FJsonValueNumber(Value))))));
+			if (bWrite)
+			{
+				Field = static_cast<float>(Value);
+			}
+		}
+	}
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeAIPerceptionCommands::HandleConfigurePerceptionBulk(const TSharedPtr<FJsonObject>& Params)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Validate required parameters
+	FString SenseType;
+	if (auto Error = FSpirrowBridgeCommonUtils::ValidateRequiredString(Params, TEXT("sense_type"), SenseType))
+	{
+		return Error;
+	}
+
+	UClass* ConfigClass = GetSenseConfigClass(SenseType);
+	if (!ConfigClass)
+	{
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::InvalidParamValue,
+			FString::Printf(TEXT("Invalid sense_type: %s. Valid types: Sight, Hearing, Damage"), *SenseType)
+		);
+	}
+
+	FString ComponentName;
+	FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("component_name"), ComponentName, TEXT("AIPerceptionComponent"));
+	FString Path;
+	FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("path"), Path, TEXT("/Game/Blueprints"));
+	FString ParentClassName;
+	FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("parent_class"), ParentClassName, TEXT(""));
+	FString PathFilter;
+	FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("path_filter"), PathFilter, TEXT("/Game"));
+	FString InheritedMode;
+	FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("inherited"), InheritedMode, TEXT("skip"));
+	bool bDryRun = false;
+	FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("dry_run"), bDryRun, false);
+
+	const bool bOverrideInherited = InheritedMode.Equals(TEXT("override"), ESearchCase::IgnoreCase);
+	if (!bOverrideInherited && !InheritedMode.Equals(TEXT("skip"), ESearchCase::IgnoreCase))
+	{
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::InvalidParamValue,
+			FString::Printf(TEXT("Invalid inherited: %s. Valid values: skip, override"), *InheritedMode)
+		);
+	}
+
+	// Collect targets: explicit list, then everything under the parent class
+	TArray<FString> ObjectPaths;
+	const TArray<TSharedPtr<FJsonValue>>* BlueprintsArray = nullptr;
+	Params->TryGetArrayField(TEXT("blueprints"), BlueprintsArray);
+	if (!BlueprintsArray && ParentClassName.IsEmpty())
+	{
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::MissingRequiredParam,
+			TEXT("Either 'blueprints' or 'parent_class' is required")
+		);
+	}
+
+	if (BlueprintsArray)
+	{
+		for (const TSharedPtr<FJsonValue>& Value : *BlueprintsArray)
+		{
+			ObjectPaths.AddUnique(ResolveBlueprintObjectPath(Value->AsString(), Path));
+		}
+	}
+
+	if (!ParentClassName.IsEmpty())
+	{
+		FSpirrowBridgeClassHierarchyCache& Hierarchy = FSpirrowBridgeClassHierarchyCache::Get();
+		Hierarchy.EnsureBuilt();
+		const TArray<FSpirrowBridgeClassHierarchyCache::FClassEntry>& Entries = Hierarchy.GetEntries();
+
+		const int32 ParentId = Hierarchy.FindClassId(ParentClassName);
+		if (ParentId == INDEX_NONE)
+		{
+			return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+				ESpirrowErrorCode::ClassNotFound,
+				FString::Printf(TEXT("Parent class not found: %s"), *ParentClassName)
+			);
+		}
+
+		// The parent itself counts when it is a Blueprint; its subtree is a contiguous ID range
+		for (int32 Id = ParentId; Id < Entries[ParentId].SubtreeEnd; ++Id)
+		{
+			const FSpirrowBridgeClassHierarchyCache::FClassEntry& Entry = Entries[Id];
+			if (Entry.bIsBlueprint && Entry.Path.StartsWith(PathFilter))
+			{
+				ObjectPaths.AddUnique(Entry.Path);
+			}
+		}
+	}
+
+	// Load every target that is not resident, all requests in flight at once
+	const double LoadStart = FPlatformTime::Seconds();
+	TArray<int32> RequestIds;
+	for (const FString& ObjectPath : ObjectPaths)
+	{
+		const FString PackageName = FPackageName::ObjectPathToPackageName(ObjectPath);
+		if (!FindPackage(nullptr, *PackageName) && FPackageName::DoesPackageExist(PackageName))
+		{
+			RequestIds.Add(LoadPackageAsync(PackageName, FLoadPackageAsyncDelegate()));
+		}
+	}
+	if (RequestIds.Num() > 0)
+	{
+		FlushAsyncLoading(RequestIds);
+	}
+	const double LoadMs = (FPlatformTime::Seconds() - LoadStart) * 1000.0;
+
+	TArray<TSharedPtr<FJsonObject>> Results;
+	TArray<UBlueprint*> ChangedBlueprints;
+	int32 NumUpdated = 0;
+	int32 NumUnchanged = 0;
+	int32 NumSkipped = 0;
+	int32 NumFailed = 0;
+
+	for (const FString& ObjectPath : ObjectPaths)
+	{
+		TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
+		Result->SetStringField(TEXT("path"), ObjectPath);
+		Results.Add(Result);
+
+		UBlueprint* Blueprint = Cast<UBlueprint>(UEditorAssetLibrary::LoadAsset(ObjectPath));
+		if (!Blueprint)
+		{
+			Result->SetBoolField(TEXT("success"), false);
+			Result->SetStringField(TEXT("error"), FString::Printf(TEXT("Blueprint not found: %s"), *ObjectPath));
+			NumFailed++;
+			continue;
+		}
+		Result->SetStringField(TEXT("blueprint_name"), Blueprint->GetName());
+
+		// Own component first, then one inherited from a parent Blueprint, then a native default subobject
+		UAIPerceptionComponent* PerceptionComp = nullptr;
+		FString Source;
+		bool bCreateOverride = false;
+		if (USCS_Node* Node = FindPerceptionNode(Blueprint->SimpleConstructionScript, ComponentName))
+		{
+			PerceptionComp = Cast<UAIPerceptionComponent>(Node->ComponentTemplate);
+			Source = TEXT("own");
+		}
+		else
+		{
+			for (UClass* Class = Blueprint->ParentClass; Class && Source.IsEmpty(); Class = Class->GetSuperClass())
+			{
+				UBlueprint* ParentBlueprint = UBlueprint::GetBlueprintFromClass(Class);
+				if (!ParentBlueprint)
+				{
+					break;
+				}
+
+				USCS_Node* ParentNode = FindPerceptionNode(ParentBlueprint->SimpleConstructionScript, ComponentName);
+				if (!ParentNode)
+				{
+					continue;
+				}
+
+				Result->SetStringField(TEXT("inherited_from"), ParentBlueprint->GetName());
+				const FComponentKey Key(ParentNode);
+				UInheritableComponentHandler* InheritableHandler = Blueprint->GetInheritableComponentHandler(false);
+				PerceptionComp = InheritableHandler ? Cast<UAIPerceptionComponent>(InheritableHandler->GetOverridenComponentTemplate(Key)) : nullptr;
+				if (PerceptionComp)
+				{
+					Source = TEXT("override");
+				}
+				else if (bOverrideInherited)
+				{
+					// Dry runs diff against the parent's template instead of creating the override
+					bCreateOverride = true;
+					PerceptionComp = bDryRun
+						? Cast<UAIPerceptionComponent>(ParentNode->ComponentTemplate)
+						: Cast<UAIPerceptionComponent>(Blueprint->GetInheritableComponentHandler(true)->CreateOverridenComponentTemplate(Key));
+					Source = TEXT("new_override");
+				}
+				else
+				{
+					Source = TEXT("inherited");
+				}
+			}
+
+			if (Source.IsEmpty() && Blueprint->GeneratedClass)
+			{
+				if (AActor* CDO = Cast<AActor>(Blueprint->GeneratedClass->GetDefaultObject()))
+				{
+					PerceptionComp = CDO->FindComponentByClass<UAIPerceptionComponent>();
+					Source = PerceptionComp ? TEXT("native") : TEXT("");
+				}
+			}
+		}
+
+		if (Source == TEXT("inherited"))
+		{
+			const FString ParentName = Result->GetStringField(TEXT("inherited_from"));
+			const bool bParentInBatch = ObjectPaths.ContainsByPredicate([&ParentName](const FString& TargetPath)
+			{
+				return FPackageName::ObjectPathToObjectName(TargetPath) == ParentName;
+			});
+			Result->SetBoolField(TEXT("success"), true);
+			Result->SetStringField(TEXT("status"), TEXT("skipped"));
+			Result->SetStringField(TEXT("reason"), bParentInBatch
+				? FString::Printf(TEXT("Component is inherited from %s, which is in this batch"), *ParentName)
+				: FString::Printf(TEXT("Component is inherited from %s; include it or pass inherited='override'"), *ParentName));
+			NumSkipped++;
+			continue;
+		}
+
+		if (!PerceptionComp)
+		{
+			Result->SetBoolField(TEXT("success"), false);
+			Result->SetStringField(TEXT("error"), FString::Printf(TEXT("AIPerceptionComponent '%s' not found in Blueprint"), *ComponentName));
+			NumFailed++;
+			continue;
+		}
+		Result->SetStringField(TEXT("component_source"), Source);
+
+		// Edit the existing config in place, or create one (on a throwaway object for dry runs)
+		UAISenseConfig* Config = FindSenseConfig(PerceptionComp, ConfigClass);
+		const bool bNewConfig = Config == nullptr;
+		if (bNewConfig)
+		{
+			Config = NewObject<UAISenseConfig>(bDryRun ? static_cast<UObject*>(GetTransientPackage()) : PerceptionComp, ConfigClass);
+		}
+
+		// Existing configs are diffed first so unchanged Blueprints are neither dirtied nor compiled
+		TArray<TSharedPtr<FJsonValue>> Changes;
+		ApplySenseParams(Config, Params, bNewConfig, bNewConfig, Changes);
+		const bool bChanged = bNewConfig || bCreateOverride || Changes.Num() > 0;
+
+		if (bChanged && !bDryRun)
+		{
+			PerceptionComp->Modify();
+			if (bNewConfig)
+			{
+				PerceptionComp->ConfigureSense(*Config);
+			}
+			else
+			{
+				Config->Modify();
+				TArray<TSharedPtr<FJsonValue>> AppliedChanges;
+				ApplySenseParams(Config, Params, false, true, AppliedChanges);
+			}
+			ChangedBlueprints.Add(Blueprint);
+		}
+
+		Result->SetBoolField(TEXT("success"), true);
+		Result->SetStringField(TEXT("status"), bChanged ? (bDryRun ? TEXT("would_update") : TEXT("updated")) : TEXT("unchanged"));
+		Result->SetBoolField(TEXT("config_created"), bNewConfig);
+		Result->SetArrayField(TEXT("changes"), Changes);
+		if (bChanged)
+		{
+			NumUpdated++;
+		}
+		else
+		{
+			NumUnchanged++;
+		}
+	}
+
+	// One compile pass for all changed Blueprints. An open compile batch keeps them queued,
+	// and saves them, at its flush; saving now would write uncompiled assets.
+	FSpirrowBridgeCompileQueue& Queue = FSpirrowBridgeCompileQueue::Get();
+	const bool bCompileDeferred = Queue.IsBatchOpen();
+	FSpirrowBridgeCompileQueue::FFlushResult CompileResult;
+	for (UBlueprint* Blueprint : ChangedBlueprints)
+	{
+		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+		if (bCompileDeferred)
+		{
+			Queue.RequestCompile(Blueprint, /*bSaveAfterCompile=*/true);
+		}
+		else
+		{
+			Queue.Enqueue(Blueprint);
+		}
+	}
+	if (ChangedBlueprints.Num() > 0 && !bCompileDeferred)
+	{
+		CompileResult = Queue.Flush(FSpirrowBridgeCompileQueue::EFlushMode::Batch);
+
+		// One save for the whole batch
+		TArray<UPackage*> Packages;
+		for (UBlueprint* Blueprint : ChangedBlueprints)
+		{
+			Packages.AddUnique(Blueprint->GetOutermost());
+		}
+		UEditorLoadingAndSavingUtils::SavePackages(Packages, /*bOnlyDirty=*/true);
+	}
+
+	// The flush compiles everything queued, including other commands' entries; count only ours
+	int32 NumCompiled = 0;
+	int32 NumSaved = 0;
+	for (const TSharedPtr<FJsonObject>& Result : Results)
+	{
+		FString Status;
+		if (!Result->TryGetStringField(TEXT("status"), Status) || Status != TEXT("updated"))
+		{
+			continue;
+		}
+
+		const FString ObjectPath = Result->GetStringField(TEXT("path"));
+		const FSpirrowBridgeCompileQueue::FCompileEntryResult* CompileEntry = CompileResult.Entries.FindByPredicate(
+			[&ObjectPath](const FSpirrowBridgeCompileQueue::FCompileEntryResult& Entry) { return Entry.Path == ObjectPath; });
+		if (CompileEntry)
+		{
+			NumCompiled++;
+			Result->SetStringField(TEXT("compile_status"), CompileEntry->Status);
+			if (CompileEntry->Status == TEXT("error"))
+			{
+				Result->SetBoolField(TEXT("success"), false);
+				Result->SetStringField(TEXT("status"), TEXT("failed"));
+				Result->SetStringField(TEXT("error"), CompileEntry->Errors.Num() > 0 ? CompileEntry->Errors[0] : TEXT("Blueprint compiled with errors"));
+				NumUpdated--;
+				NumFailed++;
+			}
+		}
+		else if (bCompileDeferred)
+		{
+			Result->SetStringField(TEXT("compile_status"), TEXT("deferred"));
+		}
+
+		const UPackage* Package = FindPackage(nullptr, *FPackageName::ObjectPathToPackageName(ObjectPath));
+		const bool bSaved = Package && !Package->IsDirty();
+		Result->SetBoolField(TEXT("saved"), bSaved);
+		NumSaved += bSaved ? 1 : 0;
+	}
+
+	TArray<TSharedPtr<FJsonValue>> ResultsArray;
+	for (const TSharedPtr<FJsonObject>& Result : Results)
+	{
+		ResultsArray.Add(MakeShareable(new FJsonValueObject(Result)));
+	}
+
+	// Build response. Per-Blueprint failures are reported through failed_count and
+	// results: success:false would make the wrapper drop them.
+	TSharedPtr<FJsonObject> Response = FSpirrowBridgeCommonUtils::CreateSuccessResponse();
+	Response->SetStringField(TEXT("sense_type"), SenseType);
+	Response->SetBoolField(TEXT("dry_run"), bDryRun);
+	Response->SetNumberField(TEXT("matched_count"), ObjectPaths.Num());
+	Response->SetNumberField(TEXT("updated_count"), NumUpdated);
+	Response->SetNumberField(TEXT("unchanged_count"), NumUnchanged);
+	Response->SetNumberField(TEXT("skipped_count"), NumSkipped);
+	Response->SetNumberField(TEXT("failed_count"), NumFailed);
+	Response->SetBoolField(TEXT("compile_deferred"), bCompileDeferred && ChangedBlueprints.Num() > 0);
+	Response->SetNumberField(TEXT("compiled_count"), NumCompiled);
+	Response->SetNumberField(TEXT("compile_ms"), CompileResult.TotalTimeMs);
+	Response->SetNumberField(TEXT("saved_count"), NumSaved);
+	Response->SetNumberField(TEXT("load_ms"), LoadMs);
+	Response->SetNumberField(TEXT("total_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	Response->SetArrayField(TEXT("results"), ResultsArray);
+
+	return Response;
+}
+
+void FSpirrowBridgeAIPerceptionCommands::ApplySenseParams(UAISenseConfig* Config, const TSharedPtr<FJsonObject>& Params,
+	bool bNewConfig, bool bWrite, TArray<TSharedPtr<FJsonValue>>& OutChanges)
+{
+	if (UAISenseConfig_Sight* SightConfig = Cast<UAISenseConfig_Sight>(Config))
+	{
+		ApplyFloatParam(SightConfig->SightRadius, TEXT("sight_radius"), 3000.0, Params, bNewConfig, bWrite, OutChanges);
+		ApplyFloatParam(SightConfig->LoseSightRadius, TEXT("lose_sight_radius"), 3500.0, Params, bNewConfig, bWrite, OutChanges);
+		ApplyFloatParam(SightConfig->PeripheralVisionAngleDegrees, TEXT("peripheral_vision_angle"), 90.0, Params, bNewConfig, bWrite, OutChanges);
+		ApplyFloatParam(SightConfig->AutoSuccessRangeFromLastSeenLocation, TEXT("auto_success_range"), 500.0, Params, bNewConfig, bWrite, OutChanges);
+	}
+	else if (UAISenseConfig_Hearing* HearingConfig = Cast<UAISenseConfig_Hearing>(Config))
+	{
+		ApplyFloatParam(HearingConfig->HearingRange, TEXT("hearing_range"), 3000.0, Params, bNewConfig, bWrite, OutChanges);
+	}
+
+	// MaxAge is behind an accessor
+	float MaxAge = Config->GetMaxAge();
+	TArray<TSharedPtr<FJsonValue>> MaxAgeChanges;
+	ApplyFloatParam(MaxAge, TEXT("max_age"), 5.0, Params, bNewConfig, true, MaxAgeChanges);
+	if (MaxAgeChanges.Num() > 0)
+	{
+		OutChanges.Append(MaxAgeChanges);
+		if (bWrite)
+		{
+			Config->SetMaxAge(MaxAge);
+		}
+	}
+
+	// Detection by affiliation (Sight and Hearing); the flags are bitfields
+	FAISenseAffiliationFilter* Affiliation = nullptr;
+	if (UAISenseConfig_Sight* SightConfig = Cast<UAISenseConfig_Sight>(Config))
+	{
+		Affiliation = &SightConfig->DetectionByAffiliation;
+	}
+	else if (UAISenseConfig_Hearing* HearingConfig = Cast<UAISenseConfig_Hearing>(Config))
+	{
+		Affiliation = &HearingConfig->DetectionByAffiliation;
+	}
+
+	const TSharedPtr<FJsonObject>* AffiliationJson = nullptr;
+	const bool bHasAffiliation = Params->TryGetObjectField(TEXT("detection_by_affiliation"), AffiliationJson);
+	if (Affiliation && (bHasAffiliation || bNewConfig))
+	{
+		bool bDetectEnemies = bNewConfig ? true : Affiliation->bDetectEnemies;
+		bool bDetectNeutrals = bNewConfig ? true : Affiliation->bDetectNeutrals;
+		bool bDetectFriendlies = bNewConfig ? false : Affiliation->bDetectFriendlies;
+		if (bHasAffiliation)
+		{
+			ParseDetectionAffiliation(*AffiliationJson, bDetectEnemies, bDetectNeutrals, bDetectFriendlies);
+		}
+
+		auto ApplyFlag = [&OutChanges](const TCHAR* Field, bool bOldValue, bool bNewValue)
+		{
+			if (bOldValue != bNewValue)
+			{
+				OutChanges.Add(MakeShareable(new FJsonValueObject(MakeChange(Field,
+					MakeShareable(new FJsonValueBoolean(bOldValue)), MakeShareable(new FJsonValueBoolean(bNewValue))))));
+			}
+		};
+		ApplyFlag(TEXT("detection_by_affiliation.enemies"), Affiliation->bDetectEnemies, bDetectEnemies);
+		ApplyFlag(TEXT("detection_by_affiliation.neutrals"), Affiliation->bDetectNeutrals, bDetectNeutrals);
+		ApplyFlag(TEXT("detection_by_affiliation.friendlies"), Affiliation->bDetectFriendlies, bDetectFriendlies);
+
+		if (bWrite)
+		{
+			Affiliation->bDetectEnemies = bDetectEnemies;
+			Affiliation->bDetectNeutrals = bDetectNeutrals;
+			Affiliation->bDetectFriendlies = bDetectFriendlies;
+		}
+	}
+}
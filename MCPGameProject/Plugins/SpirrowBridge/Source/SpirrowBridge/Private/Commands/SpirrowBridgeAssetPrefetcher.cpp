@@ -0,0 +1,138 @@
+#include "Commands/SpirrowBridgeAssetPrefetcher.h"
+#include "Commands/SpirrowBridgeAssetWorkingSet.h"
+#include "UObject/Package.h"
+
+FSpirrowBridgeAssetPrefetcher& FSpirrowBridgeAssetPrefetcher::Get()
+{
+    static FSpirrowBridgeAssetPrefetcher Instance;
+    return Instance;
+}
+
+void FSpirrowBridgeAssetPrefetcher::Shutdown()
+{
+    Entries.Empty();
+}
+
+int32 FSpirrowBridgeAssetPrefetcher::Prefetch(const TArray<FName>& PackageNames, int32 Priority, FBatchStats& OutStats)
+{
+    const int32 BatchId = NextBatchId++;
+    const double Now = FPlatformTime::Seconds();
+
+    OutStats = FBatchStats();
+    for (const FName& PackageName : PackageNames)
+    {
+        if (const FPrefetchEntry* Existing = Entries.Find(PackageName))
+        {
+            // Already queued or finished by an earlier batch
+            if (Existing->State != EPrefetchState::Failed)
+            {
+                continue;
+            }
+        }
+
+        FPrefetchEntry& Entry = Entries.Add(PackageName);
+        Entry.BatchId = BatchId;
+        Entry.RequestTime = Now;
+        ++OutStats.Requested;
+
+        // Fully loaded packages only need to be retained
+        UPackage* ResidentPackage = FindPackage(nullptr, *PackageName.ToString());
+        if (ResidentPackage && ResidentPackage->IsFullyLoaded())
+        {
+            Entry.State = EPrefetchState::Loaded;
+            Entry.CompleteTime = Now;
+            Entry.Package.Reset(ResidentPackage);
+            ++OutStats.AlreadyResident;
+            ++OutStats.Loaded;
+            continue;
+        }
+
+        Entry.State = EPrefetchState::Pending;
+        ++OutStats.Pending;
+
+        // The completion delegate may fire synchronously when the loader
+        // already has the package, so the entry must be fully set up first.
+        const int32 RequestId = LoadPackageAsync(
+            PackageName.ToString(),
+            FLoadPackageAsyncDelegate::CreateRaw(this, &FSpirrowBridgeAssetPrefetcher::OnPackageLoaded),
+            Priority);
+
+        if (FPrefetchEntry* Requested = Entries.Find(PackageName))
+        {
+            Requested->RequestId = RequestId;
+        }
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("SpirrowBridge: Prefetch batch %d queued %d packages (%d already resident)"),
+        BatchId, OutStats.Requested - OutStats.AlreadyResident, OutStats.AlreadyResident);
+
+    return BatchId;
+}
+
+void FSpirrowBridgeAssetPrefetcher::OnPackageLoaded(const FName& PackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result)
+{
+    FPrefetchEntry* Entry = Entries.Find(PackageName);
+    if (!Entry)
+    {
+        // Cleared while in flight
+        return;
+    }
+
+    Entry->CompleteTime = FPlatformTime::Seconds();
+    if (Result == EAsyncLoadingResult::Succeeded && LoadedPackage)
+    {
+        Entry->State = EPrefetchState::Loaded;
+        Entry->Package.Reset(LoadedPackage);
+        FSpirrowBridgeAssetWorkingSet::Get().Track(LoadedPackage, TEXT("prefetch_assets"));
+    }
+    else
+    {
+        Entry->State = EPrefetchState::Failed;
+        UE_LOG(LogTemp, Warning, TEXT("SpirrowBridge: Prefetch failed for %s"), *PackageName.ToString());
+    }
+}
+
+FSpirrowBridgeAssetPrefetcher::FBatchStats FSpirrowBridgeAssetPrefetcher::GetStats(int32 BatchId) const
+{
+    FBatchStats Stats;
+    for (const TPair<FName, FPrefetchEntry>& Pair : Entries)
+    {
+        if (BatchId != INDEX_NONE && Pair.Value.BatchId != BatchId)
+        {
+            continue;
+        }
+
+        ++Stats.Requested;
+        switch (Pair.Value.State)
+        {
+            case EPrefetchState::Pending: ++Stats.Pending; break;
+            case EPrefetchState::Loaded:  ++Stats.Loaded;  break;
+            case EPrefetchState::Failed:  ++Stats.Failed;  break;
+        }
+    }
+    return Stats;
+}
+
+int32 FSpirrowBridgeAssetPrefetcher::ClearCompleted()
+{
+    const int32 Before = Entries.Num();
+    for (auto It = Entries.CreateIterator(); It; ++It)
+    {
+        if (It.Value().State != EPrefetchState::Pending)
+        {
+            It.RemoveCurrent();
+        }
+    }
+    return Before - Entries.Num();
+}
+
+void FSpirrowBridgeAssetPrefetcher::Release(FName PackageName)
+{
+    if (FPrefetchEntry* Entry = Entries.Find(PackageName))
+    {
+        if (Entry->State != EPrefetchState::Pending)
+        {
+            Entries.Remove(PackageName);
+        }
+    }
+}
@@ -0,0 +1,268 @@
+#include "Commands/SpirrowBridgeAssetWorkingSet.h"
+#include "Commands/SpirrowBridgeAssetPrefetcher.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Editor.h"
+#include "FileHelpers.h"
+#include "PackageTools.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+#include "HAL/PlatformMemory.h"
+
+FSpirrowBridgeAssetWorkingSet& FSpirrowBridgeAssetWorkingSet::Get()
+{
+    static FSpirrowBridgeAssetWorkingSet Instance;
+    return Instance;
+}
+
+void FSpirrowBridgeAssetWorkingSet::Initialize()
+{
+    if (bInitialized)
+    {
+        return;
+    }
+    bInitialized = true;
+
+    AssetLoadedHandle = FCoreUObjectDelegates::OnAssetLoaded.AddRaw(this, &FSpirrowBridgeAssetWorkingSet::OnAssetLoaded);
+    PackageDirtyHandle = UPackage::PackageMarkedDirtyEvent.AddRaw(this, &FSpirrowBridgeAssetWorkingSet::OnPackageMarkedDirty);
+}
+
+void FSpirrowBridgeAssetWorkingSet::Shutdown()
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+    bInitialized = false;
+
+    FCoreUObjectDelegates::OnAssetLoaded.Remove(AssetLoadedHandle);
+    UPackage::PackageMarkedDirtyEvent.Remove(PackageDirtyHandle);
+    Tracked.Empty();
+}
+
+bool FSpirrowBridgeAssetWorkingSet::ShouldTrack(const UPackage* Package)
+{
+    if (!Package || Package == GetTransientPackage())
+    {
+        return false;
+    }
+
+    // Only project/plugin content; engine content and maps stay resident
+    const FString PackageName = Package->GetName();
+    if (PackageName.StartsWith(TEXT("/Script/")) || PackageName.StartsWith(TEXT("/Engine/")) || PackageName.StartsWith(TEXT("/Temp/")))
+    {
+        return false;
+    }
+    return !Package->HasAnyPackageFlags(PKG_ContainsMap | PKG_PlayInEditor | PKG_CompiledIn);
+}
+
+void FSpirrowBridgeAssetWorkingSet::OnAssetLoaded(UObject* Asset)
+{
+    if (bInCommand && Asset)
+    {
+        Track(Asset->GetPackage(), CurrentCommand);
+    }
+}
+
+void FSpirrowBridgeAssetWorkingSet::OnPackageMarkedDirty(UPackage* Package, bool bWasDirty)
+{
+    if (!Package)
+    {
+        return;
+    }
+
+    // Editing counts as use for LRU purposes
+    if (FTrackedPackage* Entry = Tracked.Find(Package->GetFName()))
+    {
+        Entry->LastUseSerial = CommandSerial;
+    }
+}
+
+void FSpirrowBridgeAssetWorkingSet::Track(UPackage* Package, const FString& LoadedBy)
+{
+    if (!Settings.bEnabled || !ShouldTrack(Package))
+    {
+        return;
+    }
+
+    const FName PackageName = Package->GetFName();
+    if (FTrackedPackage* Existing = Tracked.Find(PackageName))
+    {
+        Existing->LastUseSerial = CommandSerial;
+        return;
+    }
+
+    FTrackedPackage& Entry = Tracked.Add(PackageName);
+    Entry.Package = Package;
+    Entry.LastUseSerial = CommandSerial;
+    Entry.LoadTime = FPlatformTime::Seconds();
+    Entry.LoadedBy = LoadedBy;
+
+    // On-disk size is the cheapest available estimate of resident cost
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+    if (TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(PackageName))
+    {
+        Entry.DiskSize = FMath::Max<int64>(0, PackageData->DiskSize);
+    }
+}
+
+void FSpirrowBridgeAssetWorkingSet::BeginCommand(const FString& CommandType)
+{
+    ++CommandSerial;
+    CurrentCommand = CommandType;
+    bInCommand = true;
+}
+
+void FSpirrowBridgeAssetWorkingSet::EndCommand()
+{
+    bInCommand = false;
+    CurrentCommand.Reset();
+
+    if (!Settings.bEnabled)
+    {
+        return;
+    }
+
+    ++CommandsSinceGC;
+    PruneStale();
+
+    const bool bOverCount = Settings.MaxPackages > 0 && Tracked.Num() > Settings.MaxPackages;
+    const int64 UsedMB = Settings.MemoryCapMB > 0 ? GetUsedPhysicalMB() : 0;
+    const bool bOverMemory = Settings.MemoryCapMB > 0 && UsedMB > Settings.MemoryCapMB;
+
+    if (bOverCount || bOverMemory)
+    {
+        // Evict down to 90% of the cap so the next few loads do not trim again
+        const int32 TargetPackages = bOverCount ? (Settings.MaxPackages * 9) / 10 : Tracked.Num();
+        const int64 BytesToFree = bOverMemory ? (UsedMB - Settings.MemoryCapMB) * 1024 * 1024 : 0;
+
+        const FTrimResult Result = Trim(TargetPackages, BytesToFree);
+        UE_LOG(LogTemp, Log, TEXT("SpirrowBridge: Working set trimmed %d packages (%d dirty, %d open skipped), %d still tracked"),
+            Result.Unloaded.Num(), Result.SkippedDirty, Result.SkippedOpenInEditor, Tracked.Num());
+        CommandsSinceGC = 0;
+    }
+    else if (Settings.GCIntervalCommands > 0 && CommandsSinceGC >= Settings.GCIntervalCommands)
+    {
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+        CommandsSinceGC = 0;
+        PruneStale();
+    }
+}
+
+void FSpirrowBridgeAssetWorkingSet::PruneStale()
+{
+    for (auto It = Tracked.CreateIterator(); It; ++It)
+    {
+        if (!It.Value().Package.IsValid())
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+FSpirrowBridgeAssetWorkingSet::FTrimResult FSpirrowBridgeAssetWorkingSet::Trim(int32 TargetPackages, int64 BytesToFree)
+{
+    FTrimResult Result;
+    ++TrimCount;
+    PruneStale();
+
+    // Oldest first; packages touched by the command that just ran are never candidates
+    TArray<FName> Candidates;
+    for (const TPair<FName, FTrackedPackage>& Pair : Tracked)
+    {
+        if (Pair.Value.LastUseSerial < CommandSerial)
+        {
+            Candidates.Add(Pair.Key);
+        }
+    }
+    Candidates.Sort([this](const FName& A, const FName& B)
+    {
+        return Tracked[A].LastUseSerial < Tracked[B].LastUseSerial;
+    });
+
+    UAssetEditorSubsystem* AssetEditorSubsystem = GEditor ? GEditor->GetEditorSubsystem<UAssetEditorSubsystem>() : nullptr;
+    FSpirrowBridgeAssetPrefetcher& Prefetcher = FSpirrowBridgeAssetPrefetcher::Get();
+
+    TArray<UPackage*> ToUnload;
+    TArray<FName> ToUnloadNames;
+    int64 PlannedBytes = 0;
+    int32 Remaining = Tracked.Num();
+    for (const FName& PackageName : Candidates)
+    {
+        if (Remaining <= FMath::Max(0, TargetPackages) && PlannedBytes >= BytesToFree)
+        {
+            break;
+        }
+
+        const FTrackedPackage& Entry = Tracked[PackageName];
+        UPackage* Package = Entry.Package.Get();
+        if (!Package)
+        {
+            continue;
+        }
+
+        UObject* MainAsset = Package->FindAssetInPackage();
+        if (MainAsset && AssetEditorSubsystem && AssetEditorSubsystem->FindEditorsForAsset(MainAsset).Num() > 0)
+        {
+            ++Result.SkippedOpenInEditor;
+            continue;
+        }
+
+        if (Package->IsDirty())
+        {
+            if (!Settings.bSaveDirty || !UEditorLoadingAndSavingUtils::SavePackages({ Package }, /*bOnlyDirty=*/true))
+            {
+                ++Result.SkippedDirty;
+                continue;
+            }
+            Result.Saved.Add(PackageName);
+        }
+
+        Prefetcher.Release(PackageName);
+        ToUnload.Add(Package);
+        ToUnloadNames.Add(PackageName);
+        PlannedBytes += Entry.DiskSize;
+        --Remaining;
+    }
+
+    if (ToUnload.Num() > 0)
+    {
+        // UnloadPackages clears RF_Standalone and runs the GC pass itself
+        FText ErrorMessage;
+        if (!UPackageTools::UnloadPackages(ToUnload, ErrorMessage, /*bUnloadDirtyPackages=*/false))
+        {
+            Result.bUnloadFailed = true;
+            Result.ErrorMessage = ErrorMessage.ToString();
+        }
+    }
+
+    // UnloadPackages can fail part-way; only packages that are really gone stop being tracked
+    for (const FName& PackageName : ToUnloadNames)
+    {
+        if (FindPackage(nullptr, *PackageName.ToString()) != nullptr)
+        {
+            continue;
+        }
+        Result.Unloaded.Add(PackageName);
+        Result.EstimatedBytesFreed += Tracked[PackageName].DiskSize;
+        Tracked.Remove(PackageName);
+    }
+    TotalUnloaded += Result.Unloaded.Num();
+
+    return Result;
+}
+
+int64 FSpirrowBridgeAssetWorkingSet::GetTrackedDiskBytes() const
+{
+    int64 Total = 0;
+    for (const TPair<FName, FTrackedPackage>& Pair : Tracked)
+    {
+        Total += Pair.Value.DiskSize;
+    }
+    return Total;
+}
+
+int64 FSpirrowBridgeAssetWorkingSet::GetUsedPhysicalMB()
+{
+    return static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical / (1024 * 1024));
+}
@@ -0,0 +1,533 @@
+#include "Commands/SpirrowBridgeBTAuditor.h"
+#include "Commands/SpirrowBridgeBlackboardKeyIndex.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
+#include "BehaviorTree/BehaviorTree.h"
+#include "BehaviorTree/BehaviorTreeTypes.h"
+#include "BehaviorTree/BlackboardData.h"
+#include "BehaviorTree/BTNode.h"
+#include "EdGraph/EdGraph.h"
+#include "AIGraphTypes.h"
+#include "BehaviorTreeGraph.h"
+#include "BehaviorTreeGraphNode.h"
+#include "BehaviorTreeGraphNode_Root.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+    const FName IssueNullInstance(TEXT("null_instance"));
+    const FName IssueClassLoadFailed(TEXT("class_load_failed"));
+    const FName IssueMissingBlackboardKey(TEXT("missing_blackboard_key"));
+    const FName IssueNoBlackboard(TEXT("no_blackboard"));
+    const FName IssueOrphanedNode(TEXT("orphaned_node"));
+    const FName IssueUnreachableSubtree(TEXT("unreachable_subtree"));
+    const FName IssueNoGraph(TEXT("no_graph"));
+
+    bool IsPackageDirty(FName PackageName)
+    {
+        const UPackage* Package = FindPackage(nullptr, *PackageName.ToString());
+        return Package && Package->IsDirty();
+    }
+}
+
+/** Plain copy of one graph node; safe to read off the game thread */
+struct FSpirrowBridgeBTAuditor::FNodeSnapshot
+{
+    FString NodeId;
+    FString NodeClass;
+
+    /** Tree parent for composites/tasks, owning node for decorators/services */
+    int32 Parent = INDEX_NONE;
+    TArray<int32> Children;
+    TArray<int32> SubNodes;
+
+    bool bRoot = false;
+    bool bSubNode = false;
+    bool bHasInstance = false;
+    bool bClassMissing = false;
+
+    /** (property path, key) for every Blackboard key selector set on the node, nested ones included */
+    TArray<TPair<FString, FName>> KeyRefs;
+};
+
+struct FSpirrowBridgeBTAuditor::FTreeSnapshot
+{
+    FName PackageName;
+    FString ObjectPath;
+    FString AssetName;
+    bool bHasGraph = false;
+    bool bHasBlackboard = false;
+    FString BlackboardName;
+    TSet<FName> BlackboardKeys;
+    TArray<FNodeSnapshot> Nodes;
+    TSet<FName> Dependencies;
+};
+
+FSpirrowBridgeBTAuditor& FSpirrowBridgeBTAuditor::Get()
+{
+    static FSpirrowBridgeBTAuditor Instance;
+    return Instance;
+}
+
+void FSpirrowBridgeBTAuditor::Initialize()
+{
+    if (bInitialized)
+    {
+        return;
+    }
+    bInitialized = true;
+
+    PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &FSpirrowBridgeBTAuditor::OnPackageSaved);
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+    AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FSpirrowBridgeBTAuditor::OnAssetRemoved);
+    AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FSpirrowBridgeBTAuditor::OnAssetRenamed);
+}
+
+void FSpirrowBridgeBTAuditor::Shutdown()
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+    bInitialized = false;
+
+    UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+
+    if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+    {
+        IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+        AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+    }
+
+    Reset();
+}
+
+void FSpirrowBridgeBTAuditor::Reset()
+{
+    Reports.Empty();
+}
+
+void FSpirrowBridgeBTAuditor::Audit(const FString& PathPrefix, bool bForce, TArray<FAssetReport>& OutReports, FAuditStats& OutStats)
+{
+    OutReports.Reset();
+    OutStats = FAuditStats();
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+    FARFilter Filter;
+    Filter.ClassPaths.Add(UBehaviorTree::StaticClass()->GetClassPathName());
+    if (!PathPrefix.IsEmpty())
+    {
+        FString PackagePath = PathPrefix;
+        PackagePath.RemoveFromEnd(TEXT("/"));
+        Filter.PackagePaths.Add(FName(*PackagePath));
+        Filter.bRecursivePaths = true;
+    }
+
+    TArray<FAssetData> TreeAssets;
+    AssetRegistry.GetAssets(Filter, TreeAssets);
+    OutStats.NumAssets = TreeAssets.Num();
+
+    // Split into reusable reports and trees that need an audit
+    TArray<const FAssetData*> ToAudit;
+    for (const FAssetData& AssetData : TreeAssets)
+    {
+        if (!bForce)
+        {
+            const FAssetReport* Cached = Reports.Find(AssetData.PackageName);
+            bool bValid = Cached && !IsPackageDirty(AssetData.PackageName);
+            if (bValid)
+            {
+                for (const FName Dependency : Cached->Dependencies)
+                {
+                    if (IsPackageDirty(Dependency))
+                    {
+                        bValid = false;
+                        break;
+                    }
+                }
+            }
+            if (bValid)
+            {
+                continue;
+            }
+        }
+        ToAudit.Add(&AssetData);
+    }
+
+    // Issue every load up front so the loader can stream them in parallel
+    double PhaseStart = FPlatformTime::Seconds();
+    TArray<int32> RequestIds;
+    for (const FAssetData* AssetData : ToAudit)
+    {
+        if (!AssetData->IsAssetLoaded())
+        {
+            RequestIds.Add(LoadPackageAsync(AssetData->PackageName.ToString(), FLoadPackageAsyncDelegate()));
+        }
+    }
+    if (RequestIds.Num() > 0)
+    {
+        FlushAsyncLoading(RequestIds);
+    }
+    OutStats.Loaded = RequestIds.Num();
+    OutStats.LoadMs = (FPlatformTime::Seconds() - PhaseStart) * 1000.0;
+
+    // Snapshot on the game thread; nothing below touches UObjects
+    PhaseStart = FPlatformTime::Seconds();
+    TArray<FTreeSnapshot> Snapshots;
+    Snapshots.Reserve(ToAudit.Num());
+    for (const FAssetData* AssetData : ToAudit)
+    {
+        UBehaviorTree* BehaviorTree = Cast<UBehaviorTree>(AssetData->FastGetAsset(false));
+        if (!BehaviorTree)
+        {
+            FAssetReport FailedReport;
+            FailedReport.PackageName = AssetData->PackageName;
+            FailedReport.ObjectPath = AssetData->GetObjectPathString();
+            FailedReport.AssetName = AssetData->AssetName.ToString();
+            FailedReport.bLoadFailed = true;
+            // Not cached: the next audit retries the load
+            Reports.Remove(AssetData->PackageName);
+            OutReports.Add(MoveTemp(FailedReport));
+            ++OutStats.LoadFailed;
+            continue;
+        }
+        SnapshotTree(BehaviorTree, Snapshots.AddDefaulted_GetRef());
+    }
+    OutStats.SnapshotMs = (FPlatformTime::Seconds() - PhaseStart) * 1000.0;
+
+    PhaseStart = FPlatformTime::Seconds();
+    TArray<FAssetReport> NewReports;
+    NewReports.SetNum(Snapshots.Num());
+    ParallelFor(Snapshots.Num(), [&Snapshots, &NewReports](int32 Index)
+    {
+        AnalyzeTree(Snapshots[Index], NewReports[Index]);
+    });
+    OutStats.AnalysisMs = (FPlatformTime::Seconds() - PhaseStart) * 1000.0;
+    OutStats.Audited = NewReports.Num();
+
+    TSet<FName> AuditedPackages;
+    for (FAssetReport& Report : NewReports)
+    {
+        AuditedPackages.Add(Report.PackageName);
+        Reports.Add(Report.PackageName, MoveTemp(Report));
+    }
+
+    // Assemble from the (now current) cache
+    for (const FAssetData& AssetData : TreeAssets)
+    {
+        if (const FAssetReport* Report = Reports.Find(AssetData.PackageName))
+        {
+            FAssetReport& OutReport = OutReports.Add_GetRef(*Report);
+            OutReport.bFromCache = !AuditedPackages.Contains(AssetData.PackageName);
+        }
+    }
+    OutReports.Sort([](const FAssetReport& A, const FAssetReport& B)
+    {
+        return A.ObjectPath < B.ObjectPath;
+    });
+    OutStats.FromCache = OutStats.NumAssets - OutStats.Audited - OutStats.LoadFailed;
+
+    UE_LOG(LogTemp, Log, TEXT("SpirrowBridge: BT audit of %s: %d trees, %d audited, %d cached, %d loaded (%.1f ms load, %.1f ms snapshot, %.1f ms analysis)"),
+        *PathPrefix, OutStats.NumAssets, OutStats.Audited, OutStats.FromCache, OutStats.Loaded,
+        OutStats.LoadMs, OutStats.SnapshotMs, OutStats.AnalysisMs);
+}
+
+void FSpirrowBridgeBTAuditor::SnapshotTree(UBehaviorTree* BehaviorTree, FTreeSnapshot& OutSnapshot)
+{
+    OutSnapshot.PackageName = BehaviorTree->GetOutermost()->GetFName();
+    OutSnapshot.ObjectPath = BehaviorTree->GetPathName();
+    OutSnapshot.AssetName = BehaviorTree->GetName();
+
+    if (UBlackboardData* Blackboard = BehaviorTree->BlackboardAsset)
+    {
+        OutSnapshot.bHasBlackboard = true;
+        OutSnapshot.BlackboardName = Blackboard->GetName();
+        for (const UBlackboardData* It = Blackboard; It; It = It->Parent)
+        {
+            for (const FBlackboardEntry& Entry : It->Keys)
+            {
+                OutSnapshot.BlackboardKeys.Add(Entry.EntryName);
+            }
+            OutSnapshot.Dependencies.Add(It->GetOutermost()->GetFName());
+        }
+    }
+
+    UBehaviorTreeGraph* Graph = Cast<UBehaviorTreeGraph>(BehaviorTree->BTGraph);
+    if (!Graph)
+    {
+        return;
+    }
+    OutSnapshot.bHasGraph = true;
+
+    TMap<const UEdGraphNode*, int32> IndexByNode;
+    auto AddNode = [&OutSnapshot, &IndexByNode](UBehaviorTreeGraphNode* Node, bool bSubNode) -> int32
+    {
+        const int32 Index = OutSnapshot.Nodes.AddDefaulted();
+        FNodeSnapshot& Snapshot = OutSnapshot.Nodes[Index];
+        IndexByNode.Add(Node, Index);
+
+        Snapshot.bSubNode = bSubNode;
+        Snapshot.bRoot = Node->IsA<UBehaviorTreeGraphNode_Root>();
+        Snapshot.bHasInstance = Node->NodeInstance != nullptr;
+
+        const FString StoredClassName = Node->ClassData.GetClassName();
+        Snapshot.bClassMissing = !Snapshot.bRoot && !StoredClassName.IsEmpty() && !Node->ClassData.GetClass(true);
+
+        if (UObject* Instance = Node->NodeInstance)
+        {
+            UClass* InstanceClass = Instance->GetClass();
+            Snapshot.NodeId = Instance->GetName();
+            Snapshot.NodeClass = InstanceClass->GetName();
+
+            // Blueprint node classes: recompiling and saving them can change the result
+            if (!InstanceClass->HasAnyClassFlags(CLASS_Native))
+            {
+                OutSnapshot.Dependencies.Add(InstanceClass->GetOutermost()->GetFName());
+            }
+
+            // Same walk as the key index, so selectors inside structs and arrays are checked too
+            if (UBTNode* BTNode = Cast<UBTNode>(Instance))
+            {
+                FSpirrowBridgeBlackboardKeyIndex::ForEachKeySelector(BTNode, [&Snapshot](FBlackboardKeySelector& Selector, const FString& PropertyPath)
+                {
+                    if (!Selector.SelectedKeyName.IsNone())
+                    {
+                        Snapshot.KeyRefs.Emplace(PropertyPath, Selector.SelectedKeyName);
+                    }
+                });
+            }
+        }
+        else
+        {
+            Snapshot.NodeId = Node->GetName();
+            Snapshot.NodeClass = StoredClassName.IsEmpty() ? Node->GetClass()->GetName() : StoredClassName;
+
+            const FString StoredPackage = Node->ClassData.GetPackageName();
+            if (!StoredPackage.IsEmpty())
+            {
+                OutSnapshot.Dependencies.Add(FName(*StoredPackage));
+            }
+        }
+        return Index;
+    };
+
+    // Tree nodes first so links can be resolved to indices
+    TArray<UBehaviorTreeGraphNode*> TreeNodes;
+    for (UEdGraphNode* Node : Graph->Nodes)
+    {
+        if (UBehaviorTreeGraphNode* BTGraphNode = Cast<UBehaviorTreeGraphNode>(Node))
+        {
+            TreeNodes.Add(BTGraphNode);
+            AddNode(BTGraphNode, false);
+        }
+    }
+
+    for (UBehaviorTreeGraphNode* BTGraphNode : TreeNodes)
+    {
+        const int32 Index = IndexByNode.FindChecked(BTGraphNode);
+
+        for (UEdGraphPin* Pin : BTGraphNode->Pins)
+        {
+            if (!Pin || Pin->Direction != EGPD_Output)
+            {
+                continue;
+            }
+            for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
+            {
+                const int32* ChildIndex = LinkedPin ? IndexByNode.Find(LinkedPin->GetOwningNode()) : nullptr;
+                if (ChildIndex && OutSnapshot.Nodes[*ChildIndex].Parent == INDEX_NONE)
+                {
+                    OutSnapshot.Nodes[*ChildIndex].Parent = Index;
+                    OutSnapshot.Nodes[Index].Children.Add(*ChildIndex);
+                }
+            }
+        }
+
+        auto AddSubNode = [&OutSnapshot, &AddNode, Index](UBehaviorTreeGraphNode* SubNode)
+        {
+            if (SubNode)
+            {
+                const int32 SubIndex = AddNode(SubNode, true);
+                OutSnapshot.Nodes[SubIndex].Parent = Index;
+                OutSnapshot.Nodes[Index].SubNodes.Add(SubIndex);
+            }
+        };
+        for (UBehaviorTreeGraphNode* Decorator : BTGraphNode->Decorators)
+        {
+            AddSubNode(Decorator);
+        }
+        for (UBehaviorTreeGraphNode* Service : BTGraphNode->Services)
+        {
+            AddSubNode(Service);
+        }
+    }
+}
+
+void FSpirrowBridgeBTAuditor::AnalyzeTree(const FTreeSnapshot& Snapshot, FAssetReport& OutReport)
+{
+    OutReport.PackageName = Snapshot.PackageName;
+    OutReport.ObjectPath = Snapshot.ObjectPath;
+    OutReport.AssetName = Snapshot.AssetName;
+    OutReport.Dependencies = Snapshot.Dependencies;
+
+    auto AddIssue = [&OutReport](FName Type, bool bError, const FNodeSnapshot* Node, FString&& Message)
+    {
+        FIssue& Issue = OutReport.Issues.AddDefaulted_GetRef();
+        Issue.Type = Type;
+        Issue.bError = bError;
+        if (Node)
+        {
+            Issue.NodeId = Node->NodeId;
+            Issue.NodeClass = Node->NodeClass;
+        }
+        Issue.Message = MoveTemp(Message);
+    };
+
+    if (!Snapshot.bHasGraph)
+    {
+        AddIssue(IssueNoGraph, false, nullptr, TEXT("BehaviorTree has no editor graph; graph checks skipped"));
+        return;
+    }
+
+    const TArray<FNodeSnapshot>& Nodes = Snapshot.Nodes;
+
+    // Per-node checks
+    int32 UnresolvedKeyRefs = 0;
+    for (const FNodeSnapshot& Node : Nodes)
+    {
+        if (Node.bRoot)
+        {
+            continue;
+        }
+        ++OutReport.NodeCount;
+
+        if (Node.bClassMissing)
+        {
+            AddIssue(IssueClassLoadFailed, true, &Node,
+                FString::Printf(TEXT("Node class '%s' could not be loaded"), *Node.NodeClass));
+        }
+        else if (!Node.bHasInstance)
+        {
+            AddIssue(IssueNullInstance, true, &Node, TEXT("Graph node has no NodeInstance"));
+        }
+
+        for (const TPair<FString, FName>& KeyRef : Node.KeyRefs)
+        {
+            if (!Snapshot.bHasBlackboard)
+            {
+                ++UnresolvedKeyRefs;
+            }
+            else if (!Snapshot.BlackboardKeys.Contains(KeyRef.Value))
+            {
+                AddIssue(IssueMissingBlackboardKey, true, &Node,
+                    FString::Printf(TEXT("%s references key '%s', which is not in Blackboard '%s'"),
+                        *KeyRef.Key, *KeyRef.Value.ToString(), *Snapshot.BlackboardName));
+            }
+        }
+    }
+
+    if (UnresolvedKeyRefs > 0)
+    {
+        AddIssue(IssueNoBlackboard, true, nullptr,
+            FString::Printf(TEXT("%d Blackboard key reference(s) but the tree has no Blackboard asset"), UnresolvedKeyRefs));
+    }
+
+    // Reachability from Root; decorators and services share their owner's state
+    TBitArray<> Reached(false, Nodes.Num());
+    auto MarkSubtree = [&Nodes, &Reached](int32 Start) -> int32
+    {
+        int32 NumMarked = 0;
+        TArray<int32, TInlineAllocator<32>> Stack;
+        Stack.Add(Start);
+        while (Stack.Num() > 0)
+        {
+            const int32 Index = Stack.Pop(EAllowShrinking::No);
+            if (Reached[Index])
+            {
+                continue;
+            }
+            Reached[Index] = true;
+            NumMarked += 1 + Nodes[Index].SubNodes.Num();
+            for (const int32 SubIndex : Nodes[Index].SubNodes)
+            {
+                Reached[SubIndex] = true;
+            }
+            Stack.Append(Nodes[Index].Children);
+        }
+        return NumMarked;
+    };
+
+    for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+    {
+        if (Nodes[Index].bRoot)
+        {
+            MarkSubtree(Index);
+        }
+    }
+
+    // Unreached nodes without a parent head the dead subtrees
+    for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+    {
+        const FNodeSnapshot& Node = Nodes[Index];
+        if (Reached[Index] || Node.bSubNode || Node.Parent != INDEX_NONE)
+        {
+            continue;
+        }
+
+        AddIssue(IssueOrphanedNode, false, &Node, TEXT("Node is not connected to a parent"));
+
+        const int32 NumBelow = MarkSubtree(Index) - 1 - Node.SubNodes.Num();
+        if (NumBelow > 0)
+        {
+            AddIssue(IssueUnreachableSubtree, false, &Node,
+                FString::Printf(TEXT("%d node(s) below this orphaned node are never executed"), NumBelow));
+        }
+    }
+
+    // Anything left has a parent but no path to Root (a link cycle)
+    for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+    {
+        if (!Reached[Index] && !Nodes[Index].bSubNode)
+        {
+            const int32 NumMarked = MarkSubtree(Index);
+            AddIssue(IssueUnreachableSubtree, false, &Nodes[Index],
+                FString::Printf(TEXT("%d node(s) are linked in a cycle with no path to Root"), NumMarked));
+        }
+    }
+}
+
+void FSpirrowBridgeBTAuditor::InvalidatePackage(FName PackageName)
+{
+    Reports.Remove(PackageName);
+    for (auto It = Reports.CreateIterator(); It; ++It)
+    {
+        if (It.Value().Dependencies.Contains(PackageName))
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void FSpirrowBridgeBTAuditor::OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext)
+{
+    if (!Package || SaveContext.IsProceduralSave())
+    {
+        return;
+    }
+    InvalidatePackage(Package->GetFName());
+}
+
+void FSpirrowBridgeBTAuditor::OnAssetRemoved(const FAssetData& AssetData)
+{
+    InvalidatePackage(AssetData.PackageName);
+}
+
+void FSpirrowBridgeBTAuditor::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    InvalidatePackage(FName(*FPackageName::ObjectPathToPackageName(OldObjectPath)));
+}
@@ -0,0 +1,370 @@
+#include "Commands/SpirrowBridgeBTLayout.h"
+#include "BehaviorTree/BehaviorTree.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphPin.h"
+#include "BehaviorTreeGraph.h"
+#include "BehaviorTreeGraphNode.h"
+#include "BehaviorTreeGraphNode_Root.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/ObjectKey.h"
+
+namespace
+{
+    // Rough metrics of the BehaviorTree editor node widget
+    constexpr int32 CharWidth = 7;
+    constexpr int32 TitleHeight = 36;
+    constexpr int32 DescriptionLineHeight = 16;
+    constexpr int32 SubNodeInset = 16;
+    constexpr int32 FramePadding = 16;
+    constexpr int32 MinNodeWidth = 140;
+    constexpr int32 MaxNodeWidth = 480;
+
+    /** Extent of a subtree for Y in (previous step's Bottom, Bottom], relative to the subtree root's center and top */
+    struct FContourStep
+    {
+        int32 Bottom = 0;
+        int32 X = 0;
+    };
+    using FContour = TArray<FContourStep, TInlineAllocator<8>>;
+
+    struct FSubtreeRecord
+    {
+        uint32 Signature = 0;
+        FIntPoint Size = FIntPoint::ZeroValue;
+
+        /** Refreshed every pass, reused or not */
+        TArray<UBehaviorTreeGraphNode*, TInlineAllocator<4>> Children;
+
+        /** Child center X relative to this node's center X */
+        TArray<int32, TInlineAllocator<4>> ChildOffsets;
+
+        FContour Left;
+        FContour Right;
+        uint32 Pass = 0;
+    };
+
+    struct FTreeCache
+    {
+        TWeakObjectPtr<UBehaviorTree> BehaviorTree;
+        int32 HorizontalSpacing = INDEX_NONE;
+        int32 VerticalSpacing = INDEX_NONE;
+        uint32 Pass = 0;
+        TMap<FObjectKey, FSubtreeRecord> Records;
+    };
+
+    TMap<FObjectKey, FTreeCache> GTreeCaches;
+
+    FTreeCache& FindOrAddTreeCache(UBehaviorTree* BehaviorTree)
+    {
+        const FObjectKey Key(BehaviorTree);
+        if (FTreeCache* Existing = GTreeCaches.Find(Key))
+        {
+            return *Existing;
+        }
+
+        // Drop caches of trees that have been garbage collected
+        for (auto It = GTreeCaches.CreateIterator(); It; ++It)
+        {
+            if (!It.Value().BehaviorTree.IsValid())
+            {
+                It.RemoveCurrent();
+            }
+        }
+
+        FTreeCache& Cache = GTreeCaches.Add(Key);
+        Cache.BehaviorTree = BehaviorTree;
+        return Cache;
+    }
+
+    /** Widen to fit the node's title and description and add its height */
+    void MeasureBlock(const UBehaviorTreeGraphNode* Node, int32 Inset, int32& InOutWidth, int32& InOutHeight)
+    {
+        TArray<FString> Lines;
+        Node->GetDescription().ToString().ParseIntoArrayLines(Lines);
+
+        int32 MaxChars = Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString().Len();
+        for (const FString& Line : Lines)
+        {
+            MaxChars = FMath::Max(MaxChars, Line.Len());
+        }
+
+        InOutWidth = FMath::Max(InOutWidth, MaxChars * CharWidth + 48 + Inset);
+        InOutHeight += TitleHeight + Lines.Num() * DescriptionLineHeight;
+    }
+
+    void GetChildGraphNodes(const UBehaviorTreeGraphNode* Node, TArray<UBehaviorTreeGraphNode*, TInlineAllocator<4>>& OutChildren)
+    {
+        for (const UEdGraphPin* Pin : Node->Pins)
+        {
+            if (!Pin || Pin->Direction != EGPD_Output)
+            {
+                continue;
+            }
+            for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+            {
+                if (UBehaviorTreeGraphNode* Child = LinkedPin ? Cast<UBehaviorTreeGraphNode>(LinkedPin->GetOwningNode()) : nullptr)
+                {
+                    OutChildren.Add(Child);
+                }
+            }
+        }
+    }
+
+    /** Append the steps of Steps (shifted) that lie below what Out already covers */
+    void AppendShifted(FContour& Out, const FContour& Steps, int32 DX, int32 DY)
+    {
+        const int32 Covered = Out.Num() > 0 ? Out.Last().Bottom : MIN_int32;
+        for (const FContourStep& Step : Steps)
+        {
+            if (Step.Bottom + DY > Covered)
+            {
+                Out.Add({ Step.Bottom + DY, Step.X + DX });
+            }
+        }
+    }
+
+    /** Smallest X for the next sibling's center so it clears the placed siblings at every shared height */
+    int32 RequiredOffset(const FContour& PlacedRight, const FContour& NextLeft, int32 Gap)
+    {
+        int32 Offset = MIN_int32;
+        int32 RightIndex = 0;
+        int32 LeftIndex = 0;
+        while (RightIndex < PlacedRight.Num() && LeftIndex < NextLeft.Num())
+        {
+            Offset = FMath::Max(Offset, PlacedRight[RightIndex].X - NextLeft[LeftIndex].X + Gap);
+
+            const int32 RightBottom = PlacedRight[RightIndex].Bottom;
+            const int32 LeftBottom = NextLeft[LeftIndex].Bottom;
+            if (RightBottom <= LeftBottom)
+            {
+                ++RightIndex;
+            }
+            if (LeftBottom <= RightBottom)
+            {
+                ++LeftIndex;
+            }
+        }
+        return Offset;
+    }
+
+    /** Post-order: lay out every subtree whose signature changed. Returns the node's signature. */
+    uint32 BuildRecord(FTreeCache& Cache, UBehaviorTreeGraphNode* Node, TSet<const UBehaviorTreeGraphNode*>& Visited,
+        FSpirrowBridgeBTLayout::FResult& Result)
+    {
+        Visited.Add(Node);
+        Result.NumNodes += 1 + Node->Decorators.Num() + Node->Services.Num();
+
+        TArray<UBehaviorTreeGraphNode*, TInlineAllocator<4>> Children;
+        GetChildGraphNodes(Node, Children);
+        // Links never form cycles through the schema, but a corrupt graph must not recurse forever
+        Children.RemoveAll([&Visited](const UBehaviorTreeGraphNode* Child) { return Visited.Contains(Child); });
+
+        const FIntPoint Size = FSpirrowBridgeBTLayout::EstimateNodeSize(Node);
+        uint32 Signature = HashCombine(::GetTypeHash(Size.X), ::GetTypeHash(Size.Y));
+        Signature = HashCombine(Signature, ::GetTypeHash(Children.Num()));
+        for (UBehaviorTreeGraphNode* Child : Children)
+        {
+            Signature = HashCombine(Signature, BuildRecord(Cache, Child, Visited, Result));
+        }
+
+        FSubtreeRecord& Record = Cache.Records.FindOrAdd(FObjectKey(Node));
+        Record.Pass = Cache.Pass;
+        Record.Children = Children;
+        if (Record.Signature == Signature && Record.Left.Num() > 0)
+        {
+            ++Result.NumSubtreesReused;
+            return Signature;
+        }
+
+        ++Result.NumSubtreesLaidOut;
+        Record.Signature = Signature;
+        Record.Size = Size;
+        Record.ChildOffsets.Reset();
+        Record.Left.Reset();
+        Record.Right.Reset();
+
+        const int32 LeftEdge = -Size.X / 2;
+        const int32 RightEdge = Size.X + LeftEdge;
+        if (Children.Num() == 0)
+        {
+            Record.Left.Add({ Size.Y, LeftEdge });
+            Record.Right.Add({ Size.Y, RightEdge });
+            return Signature;
+        }
+
+        // Pack children left to right, in the row's coordinates (first child's center at 0)
+        FContour RowLeft;
+        FContour RowRight;
+        TArray<int32, TInlineAllocator<4>> Offsets;
+        for (int32 Index = 0; Index < Children.Num(); ++Index)
+        {
+            const FSubtreeRecord& ChildRecord = Cache.Records.FindChecked(FObjectKey(Children[Index]));
+            if (Index == 0)
+            {
+                Offsets.Add(0);
+                RowLeft = ChildRecord.Left;
+                RowRight = ChildRecord.Right;
+                continue;
+            }
+
+            const int32 Offset = RequiredOffset(RowRight, ChildRecord.Left, Cache.HorizontalSpacing);
+            Offsets.Add(Offset);
+
+            // The new child is rightmost where it exists; earlier siblings stay leftmost where they exist
+            FContour NewRight;
+            AppendShifted(NewRight, ChildRecord.Right, Offset, 0);
+            AppendShifted(NewRight, RowRight, 0, 0);
+            RowRight = MoveTemp(NewRight);
+            AppendShifted(RowLeft, ChildRecord.Left, Offset, 0);
+        }
+
+        // Center the parent over its first and last child
+        const int32 Mid = (Offsets[0] + Offsets.Last()) / 2;
+        for (const int32 Offset : Offsets)
+        {
+            Record.ChildOffsets.Add(Offset - Mid);
+        }
+
+        const int32 RowTop = Size.Y + Cache.VerticalSpacing;
+        Record.Left.Add({ RowTop, LeftEdge });
+        Record.Right.Add({ RowTop, RightEdge });
+        AppendShifted(Record.Left, RowLeft, -Mid, RowTop);
+        AppendShifted(Record.Right, RowRight, -Mid, RowTop);
+        return Signature;
+    }
+
+    /** Pre-order: write positions, touching only nodes that move */
+    void PlaceRecord(const FTreeCache& Cache, UBehaviorTreeGraphNode* Node, int32 CenterX, int32 TopY,
+        FSpirrowBridgeBTLayout::FResult& Result)
+    {
+        const FSubtreeRecord& Record = Cache.Records.FindChecked(FObjectKey(Node));
+
+        const int32 NewX = CenterX - Record.Size.X / 2;
+        if (Node->NodePosX != NewX || Node->NodePosY != TopY)
+        {
+            // Decorators and services are drawn inside their owner; keep their stored positions relative to it
+            const int32 DeltaX = NewX - Node->NodePosX;
+            const int32 DeltaY = TopY - Node->NodePosY;
+            Node->NodePosX = NewX;
+            Node->NodePosY = TopY;
+            for (UBehaviorTreeGraphNode* Decorator : Node->Decorators)
+            {
+                if (Decorator)
+                {
+                    Decorator->NodePosX += DeltaX;
+                    Decorator->NodePosY += DeltaY;
+                }
+            }
+            for (UBehaviorTreeGraphNode* Service : Node->Services)
+            {
+                if (Service)
+                {
+                    Service->NodePosX += DeltaX;
+                    Service->NodePosY += DeltaY;
+                }
+            }
+            ++Result.NumMoved;
+        }
+
+        const int32 ChildTop = TopY + Record.Size.Y + Cache.VerticalSpacing;
+        for (int32 Index = 0; Index < Record.Children.Num(); ++Index)
+        {
+            PlaceRecord(Cache, Record.Children[Index], CenterX + Record.ChildOffsets[Index], ChildTop, Result);
+        }
+    }
+}
+
+FIntPoint FSpirrowBridgeBTLayout::EstimateNodeSize(const UBehaviorTreeGraphNode* Node)
+{
+    int32 Width = MinNodeWidth;
+    int32 Height = FramePadding;
+
+    // Decorators are stacked above the node's own block, services below it
+    for (const UBehaviorTreeGraphNode* Decorator : Node->Decorators)
+    {
+        if (Decorator)
+        {
+            MeasureBlock(Decorator, SubNodeInset, Width, Height);
+        }
+    }
+    MeasureBlock(Node, 0, Width, Height);
+    for (const UBehaviorTreeGraphNode* Service : Node->Services)
+    {
+        if (Service)
+        {
+            MeasureBlock(Service, SubNodeInset, Width, Height);
+        }
+    }
+
+    return FIntPoint(FMath::Min(Width, MaxNodeWidth), Height);
+}
+
+void FSpirrowBridgeBTLayout::ResetCache()
+{
+    GTreeCaches.Empty();
+}
+
+bool FSpirrowBridgeBTLayout::Layout(UBehaviorTree* BehaviorTree, const FSettings& Settings, FResult& OutResult)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    OutResult = FResult();
+
+    UBehaviorTreeGraph* Graph = BehaviorTree ? Cast<UBehaviorTreeGraph>(BehaviorTree->BTGraph) : nullptr;
+    if (!Graph)
+    {
+        return false;
+    }
+
+    UBehaviorTreeGraphNode_Root* RootNode = nullptr;
+    for (UEdGraphNode* Node : Graph->Nodes)
+    {
+        RootNode = Cast<UBehaviorTreeGraphNode_Root>(Node);
+        if (RootNode)
+        {
+            break;
+        }
+    }
+    if (!RootNode)
+    {
+        return false;
+    }
+
+    FTreeCache& Cache = FindOrAddTreeCache(BehaviorTree);
+    if (Settings.bFullRelayout || Cache.HorizontalSpacing != Settings.HorizontalSpacing || Cache.VerticalSpacing != Settings.VerticalSpacing)
+    {
+        Cache.Records.Reset();
+        Cache.HorizontalSpacing = Settings.HorizontalSpacing;
+        Cache.VerticalSpacing = Settings.VerticalSpacing;
+    }
+    ++Cache.Pass;
+
+    TSet<const UBehaviorTreeGraphNode*> Visited;
+    BuildRecord(Cache, RootNode, Visited, OutResult);
+
+    // Forget nodes that were deleted or disconnected from Root
+    for (auto It = Cache.Records.CreateIterator(); It; ++It)
+    {
+        if (It.Value().Pass != Cache.Pass)
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    // Root stays where it is; everything else hangs off it
+    const FSubtreeRecord& RootRecord = Cache.Records.FindChecked(FObjectKey(RootNode));
+    PlaceRecord(Cache, RootNode, RootNode->NodePosX + RootRecord.Size.X / 2, RootNode->NodePosY, OutResult);
+
+    int32 MinX = 0;
+    int32 MaxX = 0;
+    for (const FContourStep& Step : RootRecord.Left)
+    {
+        MinX = FMath::Min(MinX, Step.X);
+    }
+    for (const FContourStep& Step : RootRecord.Right)
+    {
+        MaxX = FMath::Max(MaxX, Step.X);
+    }
+    OutResult.Size = FIntPoint(MaxX - MinX, RootRecord.Right.Last().Bottom);
+    OutResult.TimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    return true;
+}
@@ -0,0 +1,224 @@
+#include "Commands/SpirrowBridgeBTNodeIndex.h"
+#include "Commands/SpirrowBridgeCommonUtils.h"
+#include "BehaviorTree/BehaviorTree.h"
+#include "BehaviorTree/BTNode.h"
+#include "EdGraph/EdGraph.h"
+#include "BehaviorTreeGraph.h"
+#include "BehaviorTreeGraphNode.h"
+#include "BehaviorTreeGraphNode_Composite.h"
+
+FSpirrowBridgeBTNodeIndex& FSpirrowBridgeBTNodeIndex::Get()
+{
+    static FSpirrowBridgeBTNodeIndex Instance;
+    return Instance;
+}
+
+void FSpirrowBridgeBTNodeIndex::Shutdown()
+{
+    for (TPair<FObjectKey, FTreeIndex>& Pair : Indices)
+    {
+        UnbindGraph(Pair.Value);
+    }
+    Indices.Empty();
+}
+
+FSpirrowBridgeBTNodeIndex::FTreeIndex& FSpirrowBridgeBTNodeIndex::FindOrAddIndex(UBehaviorTree* BehaviorTree)
+{
+    const FObjectKey Key(BehaviorTree);
+    if (FTreeIndex* Existing = Indices.Find(Key))
+    {
+        return *Existing;
+    }
+
+    // Drop indices of trees that have been garbage collected
+    for (auto It = Indices.CreateIterator(); It; ++It)
+    {
+        if (!It.Value().BehaviorTree.IsValid())
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    FTreeIndex& Index = Indices.Add(Key);
+    Index.BehaviorTree = BehaviorTree;
+    return Index;
+}
+
+void FSpirrowBridgeBTNodeIndex::UnbindGraph(FTreeIndex& Index)
+{
+    if (UBehaviorTreeGraph* Graph = Index.Graph.Get())
+    {
+        Graph->RemoveOnGraphChangedHandler(Index.GraphChangedHandle);
+    }
+    Index.Graph.Reset();
+    Index.GraphChangedHandle.Reset();
+}
+
+void FSpirrowBridgeBTNodeIndex::Rebuild(FTreeIndex& Index)
+{
+    Index.Nodes.Reset();
+    Index.bDirty = false;
+
+    UBehaviorTree* BehaviorTree = Index.BehaviorTree.Get();
+    UBehaviorTreeGraph* Graph = BehaviorTree ? Cast<UBehaviorTreeGraph>(BehaviorTree->BTGraph) : nullptr;
+    if (Graph != Index.Graph.Get())
+    {
+        UnbindGraph(Index);
+        if (Graph)
+        {
+            Index.Graph = Graph;
+            Index.GraphChangedHandle = Graph->AddOnGraphChangedHandler(
+                FOnGraphChanged::FDelegate::CreateRaw(this, &FSpirrowBridgeBTNodeIndex::OnGraphChanged, FObjectKey(BehaviorTree)));
+        }
+    }
+    if (!Graph)
+    {
+        return;
+    }
+
+    auto AddNode = [&Index](UBehaviorTreeGraphNode* Node, UBehaviorTreeGraphNode* Parent)
+    {
+        if (Node && Node->NodeInstance)
+        {
+            FStoredEntry& Entry = Index.Nodes.Add(Node->NodeInstance->GetFName());
+            Entry.GraphNode = Node;
+            Entry.RuntimeNode = Cast<UBTNode>(Node->NodeInstance);
+            Entry.ParentGraphNode = Parent;
+        }
+    };
+
+    Index.Nodes.Reserve(Graph->Nodes.Num());
+    for (UEdGraphNode* Node : Graph->Nodes)
+    {
+        UBehaviorTreeGraphNode* BTGraphNode = Cast<UBehaviorTreeGraphNode>(Node);
+        if (!BTGraphNode)
+        {
+            continue;
+        }
+
+        // Tree parent is whatever feeds the single input pin
+        UBehaviorTreeGraphNode* Parent = nullptr;
+        for (UEdGraphPin* Pin : BTGraphNode->Pins)
+        {
+            if (Pin && Pin->Direction == EGPD_Input && Pin->LinkedTo.Num() > 0 && Pin->LinkedTo[0])
+            {
+                Parent = Cast<UBehaviorTreeGraphNode>(Pin->LinkedTo[0]->GetOwningNode());
+                break;
+            }
+        }
+        AddNode(BTGraphNode, Parent);
+
+        for (UBehaviorTreeGraphNode* Decorator : BTGraphNode->Decorators)
+        {
+            AddNode(Decorator, BTGraphNode);
+        }
+        if (UBehaviorTreeGraphNode_Composite* Composite = Cast<UBehaviorTreeGraphNode_Composite>(BTGraphNode))
+        {
+            for (UBehaviorTreeGraphNode* Service : Composite->Services)
+            {
+                AddNode(Service, Composite);
+            }
+        }
+    }
+}
+
+bool FSpirrowBridgeBTNodeIndex::ResolveEntry(const FStoredEntry& Stored, FName NodeId, FEntry& OutEntry) const
+{
+    UBehaviorTreeGraphNode* GraphNode = Stored.GraphNode.Get();
+
+    // The node must still own the same instance under the same name (delete_bt_node clears NodeInstance)
+    if (!GraphNode || !GraphNode->NodeInstance || GraphNode->NodeInstance != Stored.RuntimeNode.Get()
+        || GraphNode->NodeInstance->GetFName() != NodeId)
+    {
+        return false;
+    }
+
+    OutEntry.GraphNode = GraphNode;
+    OutEntry.RuntimeNode = Stored.RuntimeNode.Get();
+    OutEntry.ParentGraphNode = Stored.ParentGraphNode.Get();
+    return true;
+}
+
+void FSpirrowBridgeBTNodeIndex::OnGraphChanged(const FEdGraphEditAction& Action, FObjectKey TreeKey)
+{
+    if (Action.Action == GRAPHACTION_SelectNode)
+    {
+        return;
+    }
+    if (FTreeIndex* Index = Indices.Find(TreeKey))
+    {
+        Index->bDirty = true;
+    }
+}
+
+void FSpirrowBridgeBTNodeIndex::Invalidate(UBehaviorTree* BehaviorTree)
+{
+    if (FTreeIndex* Index = Indices.Find(FObjectKey(BehaviorTree)))
+    {
+        Index->bDirty = true;
+    }
+}
+
+bool FSpirrowBridgeBTNodeIndex::Find(UBehaviorTree* BehaviorTree, const FString& NodeId, FEntry& OutEntry)
+{
+    OutEntry = FEntry();
+    if (!BehaviorTree || NodeId.IsEmpty())
+    {
+        return false;
+    }
+
+    FTreeIndex& Index = FindOrAddIndex(BehaviorTree);
+    bool bRebuilt = false;
+    if (Index.bDirty || Index.Graph.Get() != BehaviorTree->BTGraph)
+    {
+        Rebuild(Index);
+        bRebuilt = true;
+    }
+
+    const FName Key(*NodeId);
+    if (const FStoredEntry* Stored = Index.Nodes.Find(Key))
+    {
+        if (ResolveEntry(*Stored, Key, OutEntry))
+        {
+            return true;
+        }
+    }
+
+    // Miss or stale entry: the graph may have been edited without a notification
+    if (!bRebuilt)
+    {
+        Rebuild(Index);
+        if (const FStoredEntry* Stored = Index.Nodes.Find(Key))
+        {
+            return ResolveEntry(*Stored, Key, OutEntry);
+        }
+    }
+
+    return false;
+}
+
+UBehaviorTreeGraphNode* FSpirrowBridgeBTNodeIndex::FindGraphNode(UBehaviorTree* BehaviorTree, const FString& NodeId)
+{
+    FEntry Entry;
+    return Find(BehaviorTree, NodeId, Entry) ? Entry.GraphNode : nullptr;
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeBTNodeIndex::ResolveNode(UBehaviorTree* BehaviorTree, const FString& NodeId, FEntry& OutEntry, const TCHAR* Label)
+{
+    if (!BehaviorTree || !BehaviorTree->BTGraph)
+    {
+        OutEntry = FEntry();
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::GraphNotFound,
+            TEXT("BehaviorTree has no graph"));
+    }
+
+    if (!Find(BehaviorTree, NodeId, OutEntry))
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::NodeNotFound,
+            FString::Printf(TEXT("%s not found: %s (deleted, or an ID from before the tree was rebuilt; use list_bt_nodes)"), Label, *NodeId));
+    }
+
+    return nullptr;
+}
@@ -0,0 +1,456 @@
+#include "Commands/SpirrowBridgeBlackboardKeyIndex.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "BehaviorTree/BehaviorTree.h"
+#include "BehaviorTree/BehaviorTreeTypes.h"
+#include "BehaviorTree/BlackboardData.h"
+#include "BehaviorTree/BTNode.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType.h"
+#include "EdGraph/EdGraph.h"
+#include "BehaviorTreeGraph.h"
+#include "BehaviorTreeGraphNode.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UnrealType.h"
+
+namespace
+{
+    /** Struct nesting followed below a node (EQSRequest.QueryConfig[i].BBKey is two levels deep) */
+    constexpr int32 MaxSelectorNestingDepth = 4;
+
+    bool IsPackageDirty(FName PackageName)
+    {
+        const UPackage* Package = FindPackage(nullptr, *PackageName.ToString());
+        return Package && Package->IsDirty();
+    }
+
+    void VisitKeySelectors(const UStruct* Struct, void* Container, const FString& Prefix, int32 Depth,
+        TFunctionRef<void(FBlackboardKeySelector&, const FString&)> Visitor)
+    {
+        const UScriptStruct* SelectorStruct = FBlackboardKeySelector::StaticStruct();
+
+        for (TFieldIterator<FProperty> PropIt(Struct); PropIt; ++PropIt)
+        {
+            FProperty* Property = *PropIt;
+            if (Property->HasAnyPropertyFlags(CPF_Transient | CPF_Deprecated))
+            {
+                continue;
+            }
+
+            if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+            {
+                const bool bSelector = StructProperty->Struct->IsChildOf(SelectorStruct);
+                if (!bSelector && Depth >= MaxSelectorNestingDepth)
+                {
+                    continue;
+                }
+
+                void* Value = StructProperty->ContainerPtrToValuePtr<void>(Container);
+                const FString Path = Prefix + Property->GetName();
+                if (bSelector)
+                {
+                    Visitor(*static_cast<FBlackboardKeySelector*>(Value), Path);
+                }
+                else
+                {
+                    VisitKeySelectors(StructProperty->Struct, Value, Path + TEXT("."), Depth + 1, Visitor);
+                }
+            }
+            else if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+            {
+                FStructProperty* InnerProperty = CastField<FStructProperty>(ArrayProperty->Inner);
+                if (!InnerProperty)
+                {
+                    continue;
+                }
+                const bool bSelector = InnerProperty->Struct->IsChildOf(SelectorStruct);
+                if (!bSelector && Depth >= MaxSelectorNestingDepth)
+                {
+                    continue;
+                }
+
+                FScriptArrayHelper ArrayHelper(ArrayProperty, ArrayProperty->ContainerPtrToValuePtr<void>(Container));
+                for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
+                {
+                    void* Element = ArrayHelper.GetRawPtr(Index);
+                    const FString Path = FString::Printf(TEXT("%s%s[%d]"), *Prefix, *Property->GetName(), Index);
+                    if (bSelector)
+                    {
+                        Visitor(*static_cast<FBlackboardKeySelector*>(Element), Path);
+                    }
+                    else
+                    {
+                        VisitKeySelectors(InnerProperty->Struct, Element, Path + TEXT("."), Depth + 1, Visitor);
+                    }
+                }
+            }
+        }
+    }
+}
+
+FSpirrowBridgeBlackboardKeyIndex& FSpirrowBridgeBlackboardKeyIndex::Get()
+{
+    static FSpirrowBridgeBlackboardKeyIndex Instance;
+    return Instance;
+}
+
+void FSpirrowBridgeBlackboardKeyIndex::Initialize()
+{
+    if (bInitialized)
+    {
+        return;
+    }
+    bInitialized = true;
+
+    PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &FSpirrowBridgeBlackboardKeyIndex::OnPackageSaved);
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+    AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FSpirrowBridgeBlackboardKeyIndex::OnAssetRemoved);
+    AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FSpirrowBridgeBlackboardKeyIndex::OnAssetRenamed);
+}
+
+void FSpirrowBridgeBlackboardKeyIndex::Shutdown()
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+    bInitialized = false;
+
+    UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+
+    if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+    {
+        IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+        AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+    }
+
+    Reset();
+}
+
+void FSpirrowBridgeBlackboardKeyIndex::Reset()
+{
+    Trees.Empty();
+    TreesByKey.Empty();
+}
+
+void FSpirrowBridgeBlackboardKeyIndex::Update(FUpdateStats& OutStats)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    OutStats = FUpdateStats();
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+    FARFilter Filter;
+    Filter.ClassPaths.Add(UBehaviorTree::StaticClass()->GetClassPathName());
+
+    TArray<FAssetData> TreeAssets;
+    AssetRegistry.GetAssets(Filter, TreeAssets);
+    OutStats.NumTrees = TreeAssets.Num();
+
+    // Drop trees that no longer exist (deleted while the delegates were not bound)
+    TSet<FName> ExistingPackages;
+    ExistingPackages.Reserve(TreeAssets.Num());
+    for (const FAssetData& AssetData : TreeAssets)
+    {
+        ExistingPackages.Add(AssetData.PackageName);
+    }
+    TArray<FName> GonePackages;
+    for (const TPair<FName, FTreeEntry>& Pair : Trees)
+    {
+        if (!ExistingPackages.Contains(Pair.Key))
+        {
+            GonePackages.Add(Pair.Key);
+        }
+    }
+    for (const FName PackageName : GonePackages)
+    {
+        RemoveTree(PackageName);
+    }
+
+    // Saved trees are already current; unsaved edits are picked up from the dirty package
+    TArray<const FAssetData*> ToIndex;
+    for (const FAssetData& AssetData : TreeAssets)
+    {
+        if (!Trees.Contains(AssetData.PackageName) || IsPackageDirty(AssetData.PackageName))
+        {
+            ToIndex.Add(&AssetData);
+        }
+    }
+
+    // Issue every load up front so the loader can stream them in parallel
+    TArray<int32> RequestIds;
+    for (const FAssetData* AssetData : ToIndex)
+    {
+        if (!AssetData->IsAssetLoaded())
+        {
+            RequestIds.Add(LoadPackageAsync(AssetData->PackageName.ToString(), FLoadPackageAsyncDelegate()));
+        }
+    }
+    if (RequestIds.Num() > 0)
+    {
+        FlushAsyncLoading(RequestIds);
+    }
+    OutStats.Loaded = RequestIds.Num();
+
+    for (const FAssetData* AssetData : ToIndex)
+    {
+        UBehaviorTree* BehaviorTree = Cast<UBehaviorTree>(AssetData->FastGetAsset(false));
+        if (!BehaviorTree)
+        {
+            // Not recorded: the next update retries the load
+            ++OutStats.LoadFailed;
+            continue;
+        }
+        IndexTree(BehaviorTree);
+        ++OutStats.Indexed;
+    }
+
+    OutStats.TimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+    if (OutStats.Indexed > 0 || OutStats.LoadFailed > 0)
+    {
+        UE_LOG(LogTemp, Log, TEXT("SpirrowBridge: Blackboard key index: %d trees, %d indexed, %d loaded, %d failed (%.1f ms)"),
+            OutStats.NumTrees, OutStats.Indexed, OutStats.Loaded, OutStats.LoadFailed, OutStats.TimeMs);
+    }
+}
+
+void FSpirrowBridgeBlackboardKeyIndex::IndexTree(UBehaviorTree* BehaviorTree)
+{
+    if (!BehaviorTree)
+    {
+        return;
+    }
+
+    const FName PackageName = BehaviorTree->GetOutermost()->GetFName();
+    RemoveTree(PackageName);
+
+    FTreeEntry& Entry = Trees.Add(PackageName);
+    Entry.ObjectPath = BehaviorTree->GetPathName();
+    Entry.AssetName = BehaviorTree->GetName();
+    Entry.Blackboard = FSoftObjectPath(BehaviorTree->BlackboardAsset.Get());
+
+    ForEachNodeInstance(BehaviorTree, [&Entry](UBTNode* Node)
+    {
+        ForEachKeySelector(Node, [&Entry, Node](FBlackboardKeySelector& Selector, const FString& Property)
+        {
+            if (Selector.SelectedKeyName.IsNone())
+            {
+                return;
+            }
+
+            FKeyRef& Ref = Entry.Refs.AddDefaulted_GetRef();
+            Ref.KeyName = Selector.SelectedKeyName;
+            Ref.NodeId = Node->GetName();
+            Ref.NodeClass = Node->GetClass()->GetName();
+            Ref.Property = Property;
+            for (const UBlackboardKeyType* AllowedType : Selector.AllowedTypes)
+            {
+                if (AllowedType)
+                {
+                    Ref.AllowedTypes.AddUnique(AllowedType->GetClass()->GetFName());
+                }
+            }
+        });
+    });
+
+    for (const FKeyRef& Ref : Entry.Refs)
+    {
+        TreesByKey.FindOrAdd(Ref.KeyName).Add(PackageName);
+    }
+}
+
+void FSpirrowBridgeBlackboardKeyIndex::FindUsages(const UBlackboardData* Blackboard, const TSet<FName>* KeyNames, TArray<FUsage>& OutUsages) const
+{
+    OutUsages.Reset();
+    if (!Blackboard)
+    {
+        return;
+    }
+
+    TSet<FName> Candidates;
+    if (KeyNames)
+    {
+        for (const FName KeyName : *KeyNames)
+        {
+            if (const TSet<FName>* Packages = TreesByKey.Find(KeyName))
+            {
+                Candidates.Append(*Packages);
+            }
+        }
+    }
+    else
+    {
+        Trees.GetKeys(Candidates);
+    }
+
+    for (const FName PackageName : Candidates)
+    {
+        const FTreeEntry* Entry = Trees.Find(PackageName);
+        if (!Entry || Entry->Blackboard.IsNull())
+        {
+            continue;
+        }
+
+        const UBlackboardData* TreeBlackboard = Cast<UBlackboardData>(Entry->Blackboard.ResolveObject());
+        if (!TreeBlackboard)
+        {
+            TreeBlackboard = Cast<UBlackboardData>(Entry->Blackboard.TryLoad());
+        }
+
+        bool bInChain = false;
+        for (const UBlackboardData* It = TreeBlackboard; It; It = It->Parent)
+        {
+            if (It == Blackboard)
+            {
+                bInChain = true;
+                break;
+            }
+        }
+        if (!bInChain)
+        {
+            continue;
+        }
+
+        for (const FKeyRef& Ref : Entry->Refs)
+        {
+            if (KeyNames && !KeyNames->Contains(Ref.KeyName))
+            {
+                continue;
+            }
+            // A child Blackboard may declare a key of the same name
+            if (FindDeclaringBlackboard(TreeBlackboard, Ref.KeyName) != Blackboard)
+            {
+                continue;
+            }
+
+            FUsage& Usage = OutUsages.AddDefaulted_GetRef();
+            Usage.KeyName = Ref.KeyName;
+            Usage.TreePath = Entry->ObjectPath;
+            Usage.TreeName = Entry->AssetName;
+            Usage.NodeId = Ref.NodeId;
+            Usage.NodeClass = Ref.NodeClass;
+            Usage.Property = Ref.Property;
+            Usage.AllowedTypes = Ref.AllowedTypes;
+        }
+    }
+
+    OutUsages.Sort([](const FUsage& A, const FUsage& B)
+    {
+        if (A.TreePath != B.TreePath)
+        {
+            return A.TreePath < B.TreePath;
+        }
+        if (A.NodeId != B.NodeId)
+        {
+            return A.NodeId < B.NodeId;
+        }
+        return A.Property < B.Property;
+    });
+}
+
+void FSpirrowBridgeBlackboardKeyIndex::ForEachNodeInstance(UBehaviorTree* BehaviorTree, TFunctionRef<void(UBTNode*)> Visitor)
+{
+    UBehaviorTreeGraph* Graph = BehaviorTree ? Cast<UBehaviorTreeGraph>(BehaviorTree->BTGraph) : nullptr;
+    if (!Graph)
+    {
+        return;
+    }
+
+    auto Visit = [&Visitor](UBehaviorTreeGraphNode* GraphNode)
+    {
+        if (UBTNode* Instance = GraphNode ? Cast<UBTNode>(GraphNode->NodeInstance) : nullptr)
+        {
+            Visitor(Instance);
+        }
+    };
+
+    for (UEdGraphNode* Node : Graph->Nodes)
+    {
+        UBehaviorTreeGraphNode* BTGraphNode = Cast<UBehaviorTreeGraphNode>(Node);
+        if (!BTGraphNode)
+        {
+            continue;
+        }
+
+        Visit(BTGraphNode);
+        for (UBehaviorTreeGraphNode* Decorator : BTGraphNode->Decorators)
+        {
+            Visit(Decorator);
+        }
+        for (UBehaviorTreeGraphNode* Service : BTGraphNode->Services)
+        {
+            Visit(Service);
+        }
+    }
+}
+
+void FSpirrowBridgeBlackboardKeyIndex::ForEachKeySelector(UBTNode* Node, TFunctionRef<void(FBlackboardKeySelector&, const FString&)> Visitor)
+{
+    if (Node)
+    {
+        VisitKeySelectors(Node->GetClass(), Node, FString(), 0, Visitor);
+    }
+}
+
+const UBlackboardData* FSpirrowBridgeBlackboardKeyIndex::FindDeclaringBlackboard(const UBlackboardData* Blackboard, FName KeyName)
+{
+    for (const UBlackboardData* It = Blackboard; It; It = It->Parent)
+    {
+        for (const FBlackboardEntry& Entry : It->Keys)
+        {
+            if (Entry.EntryName == KeyName)
+            {
+                return It;
+            }
+        }
+    }
+    return nullptr;
+}
+
+void FSpirrowBridgeBlackboardKeyIndex::RemoveTree(FName PackageName)
+{
+    const FTreeEntry* Entry = Trees.Find(PackageName);
+    if (!Entry)
+    {
+        return;
+    }
+
+    for (const FKeyRef& Ref : Entry->Refs)
+    {
+        if (TSet<FName>* Packages = TreesByKey.Find(Ref.KeyName))
+        {
+            Packages->Remove(PackageName);
+            if (Packages->Num() == 0)
+            {
+                TreesByKey.Remove(Ref.KeyName);
+            }
+        }
+    }
+    Trees.Remove(PackageName);
+}
+
+void FSpirrowBridgeBlackboardKeyIndex::OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext)
+{
+    if (!Package || SaveContext.IsProceduralSave())
+    {
+        return;
+    }
+
+    if (UBehaviorTree* BehaviorTree = FindObject<UBehaviorTree>(Package, *FPackageName::GetShortName(Package)))
+    {
+        IndexTree(BehaviorTree);
+    }
+}
+
+void FSpirrowBridgeBlackboardKeyIndex::OnAssetRemoved(const FAssetData& AssetData)
+{
+    RemoveTree(AssetData.PackageName);
+}
+
+void FSpirrowBridgeBlackboardKeyIndex::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    // The tree under its new name is indexed by the next Update
+    RemoveTree(FName(*FPackageName::ObjectPathToPackageName(OldObjectPath)));
+}
@@ -1,5 +1,6 @@
 #include "Commands/SpirrowBridgeBlueprintCoreCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeCompileQueue.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Factories/BlueprintFactory.h"
@@ -55,6 +56,26 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintCoreCommands::HandleCommand(const
     {
         return HandleGetBlueprintGraph(Params);
     }
+    else if (CommandType == TEXT("begin_compile_batch"))
+    {
+        return HandleBeginCompileBatch(Params);
+    }
+    else if (CommandType == TEXT("cancel_compile_batch"))
+    {
+        return HandleCancelCompileBatch(Params);
+    }
+    else if (CommandType == TEXT("flush_compile_queue"))
+    {
+        return HandleFlushCompileQueue(Params);
+    }
+    else if (CommandType == TEXT("get_compile_queue"))
+    {
+        return HandleGetCompileQueue(Params);
+    }
+    else if (CommandType == TEXT("validate_blueprint"))
+    {
+        return HandleValidateBlueprint(Params);
+    }
 
     return nullptr; // Not handled by this class
 }
@@ -268,6 +289,8 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintCoreCommands::HandleCompileBluepr
     ResultObj->SetStringField(TEXT("name"), Blueprint->GetName());
     ResultObj->SetStringField(TEXT("path"), Blueprint->GetPathName());
     ResultObj->SetBoolField(TEXT("compiled"), true);
+    // Already-compiled Blueprints are only marked dirty; flush_compile_queue compiles them
+    ResultObj->SetBoolField(TEXT("pending_compile"), FSpirrowBridgeCompileQueue::Get().GetPending().Contains(Blueprint));
     return ResultObj;
 }
 
@@ -488,6 +511,23 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintCoreCommands::HandleGetBlueprintG
         return Error;
     }
 
+    // compact: string table + integer rows over all graphs; summary drops pins
+    FString Format = TEXT("full");
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("format"), Format, TEXT("full"));
+    if (Format == TEXT("compact") || Format == TEXT("summary"))
+    {
+        TSharedPtr<FJsonObject> ResultJson = MakeShareable(new FJsonObject());
+        ResultJson->SetBoolField(TEXT("success"), true);
+        ResultJson->SetObjectField(TEXT("result"), BuildCompactGraphExport(Blueprint, Format == TEXT("summary")));
+        return ResultJson;
+    }
+    if (Format != TEXT("full"))
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::InvalidParamValue,
+            FString::Printf(TEXT("Unknown format '%s' (expected full, compact or summary)"), *Format));
+    }
+
     TSharedPtr<FJsonObject> ResultData = MakeShareable(new FJsonObject());
     ResultData->SetStringField(TEXT("blueprint_name"), Blueprint->GetName());
     ResultData->SetStringField(TEXT("parent_class"), Blueprint->ParentClass ? Blueprint->ParentClass->GetName() : TEXT("None"));
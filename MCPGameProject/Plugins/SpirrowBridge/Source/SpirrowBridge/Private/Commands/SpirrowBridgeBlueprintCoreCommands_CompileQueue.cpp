@@ -0,0 +1,147 @@
+#include "Commands/SpirrowBridgeBlueprintCoreCommands.h"
+#include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeCompileQueue.h"
+#include "Engine/Blueprint.h"
+
+namespace
+{
+    TArray<TSharedPtr<FJsonValue>> PendingToJsonArray(const TArray<UBlueprint*>& Pending)
+    {
+        TArray<TSharedPtr<FJsonValue>> Array;
+        Array.Reserve(Pending.Num());
+        for (const UBlueprint* Blueprint : Pending)
+        {
+            TSharedPtr<FJsonObject> EntryObj = MakeShared<FJsonObject>();
+            EntryObj->SetStringField(TEXT("name"), Blueprint->GetName());
+            EntryObj->SetStringField(TEXT("path"), Blueprint->GetPathName());
+            EntryObj->SetBoolField(TEXT("up_to_date"), Blueprint->Status == BS_UpToDate || Blueprint->Status == BS_UpToDateWithWarnings);
+            Array.Add(MakeShared<FJsonValueObject>(EntryObj));
+        }
+        return Array;
+    }
+}
+
+// ===== Begin Compile Batch =====
+TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintCoreCommands::HandleBeginCompileBatch(const TSharedPtr<FJsonObject>& Params)
+{
+    FSpirrowBridgeCompileQueue& Queue = FSpirrowBridgeCompileQueue::Get();
+    Queue.BeginBatch();
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetBoolField(TEXT("batch_open"), true);
+    ResultObj->SetNumberField(TEXT("pending_count"), Queue.GetPending().Num());
+    return ResultObj;
+}
+
+// ===== Cancel Compile Batch =====
+TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintCoreCommands::HandleCancelCompileBatch(const TSharedPtr<FJsonObject>& Params)
+{
+    bool bDiscardPending = false;
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("discard_pending"), bDiscardPending, false);
+
+    FSpirrowBridgeCompileQueue& Queue = FSpirrowBridgeCompileQueue::Get();
+    const bool bWasOpen = Queue.IsBatchOpen();
+    const int32 NumDropped = Queue.CancelBatch(bDiscardPending);
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetBoolField(TEXT("was_open"), bWasOpen);
+    ResultObj->SetBoolField(TEXT("batch_open"), false);
+    ResultObj->SetNumberField(TEXT("discarded_count"), NumDropped);
+    ResultObj->SetNumberField(TEXT("pending_count"), Queue.GetPending().Num());
+    return ResultObj;
+}
+
+// ===== Flush Compile Queue =====
+TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintCoreCommands::HandleFlushCompileQueue(const TSharedPtr<FJsonObject>& Params)
+{
+    FString ModeString, Path;
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("mode"), ModeString, TEXT("ordered"));
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("path"), Path, TEXT("/Game/Blueprints"));
+
+    FSpirrowBridgeCompileQueue::EFlushMode Mode;
+    if (ModeString.Equals(TEXT("ordered"), ESearchCase::IgnoreCase))
+    {
+        Mode = FSpirrowBridgeCompileQueue::EFlushMode::Ordered;
+    }
+    else if (ModeString.Equals(TEXT("batch"), ESearchCase::IgnoreCase))
+    {
+        Mode = FSpirrowBridgeCompileQueue::EFlushMode::Batch;
+    }
+    else
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::InvalidParamValue,
+            FString::Printf(TEXT("Invalid mode '%s' (expected 'ordered' or 'batch')"), *ModeString));
+    }
+
+    // Extra Blueprints to compile alongside whatever is already queued
+    FSpirrowBridgeCompileQueue& Queue = FSpirrowBridgeCompileQueue::Get();
+    const TArray<TSharedPtr<FJsonValue>>* NamesJson = nullptr;
+    if (Params->TryGetArrayField(TEXT("blueprints"), NamesJson))
+    {
+        TArray<UBlueprint*> Extra;
+        for (const TSharedPtr<FJsonValue>& NameValue : *NamesJson)
+        {
+            UBlueprint* Blueprint = nullptr;
+            if (auto Error = FSpirrowBridgeCommonUtils::ValidateBlueprint(NameValue->AsString(), Path, Blueprint))
+            {
+                return Error;
+            }
+            Extra.Add(Blueprint);
+        }
+        for (UBlueprint* Blueprint : Extra)
+        {
+            Queue.Enqueue(Blueprint);
+        }
+    }
+
+    const FSpirrowBridgeCompileQueue::FFlushResult Result = Queue.Flush(Mode);
+
+    TArray<TSharedPtr<FJsonValue>> EntriesArray;
+    for (const FSpirrowBridgeCompileQueue::FCompileEntryResult& Entry : Result.Entries)
+    {
+        TSharedPtr<FJsonObject> EntryObj = MakeShared<FJsonObject>();
+        EntryObj->SetStringField(TEXT("name"), Entry.Name);
+        EntryObj->SetStringField(TEXT("path"), Entry.Path);
+        EntryObj->SetStringField(TEXT("status"), Entry.Status);
+        if (Mode == FSpirrowBridgeCompileQueue::EFlushMode::Ordered)
+        {
+            EntryObj->SetNumberField(TEXT("time_ms"), Entry.TimeMs);
+        }
+        EntryObj->SetNumberField(TEXT("warnings"), Entry.NumWarnings);
+
+        TArray<TSharedPtr<FJsonValue>> ErrorsArray;
+        for (const FString& Error : Entry.Errors)
+        {
+            ErrorsArray.Add(MakeShared<FJsonValueString>(Error));
+        }
+        EntryObj->SetArrayField(TEXT("errors"), ErrorsArray);
+        EntriesArray.Add(MakeShared<FJsonValueObject>(EntryObj));
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetStringField(TEXT("mode"), Mode == FSpirrowBridgeCompileQueue::EFlushMode::Ordered ? TEXT("ordered") : TEXT("batch"));
+    ResultObj->SetNumberField(TEXT("compiled_count"), Result.NumCompiled);
+    ResultObj->SetNumberField(TEXT("failed_count"), Result.NumFailed);
+    ResultObj->SetNumberField(TEXT("saved_count"), Result.NumSaved);
+    ResultObj->SetNumberField(TEXT("total_time_ms"), Result.TotalTimeMs);
+    ResultObj->SetArrayField(TEXT("blueprints"), EntriesArray);
+    return ResultObj;
+}
+
+// ===== Get Compile Queue =====
+TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintCoreCommands::HandleGetCompileQueue(const TSharedPtr<FJsonObject>& Params)
+{
+    const FSpirrowBridgeCompileQueue& Queue = FSpirrowBridgeCompileQueue::Get();
+    const TArray<UBlueprint*> Pending = Queue.GetPending();
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetBoolField(TEXT("batch_open"), Queue.IsBatchOpen());
+    ResultObj->SetNumberField(TEXT("pending_count"), Pending.Num());
+    ResultObj->SetArrayField(TEXT("pending"), PendingToJsonArray(Pending));
+    return ResultObj;
+}
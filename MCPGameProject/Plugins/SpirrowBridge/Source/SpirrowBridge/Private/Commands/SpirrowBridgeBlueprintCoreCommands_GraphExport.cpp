@@ -0,0 +1,252 @@
+#include "Commands/SpirrowBridgeBlueprintCoreCommands.h"
+#include "Commands/SpirrowBridgeBlueprintSearchIndex.h"
+#include "Engine/Blueprint.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "Engine/SCS_Node.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+
+namespace
+{
+    /** FString's default hash and equality ignore case; interned values must not */
+    struct FCaseSensitiveStringKeyFuncs : TDefaultMapKeyFuncs<FString, int32, false>
+    {
+        static bool Matches(KeyInitType A, KeyInitType B)
+        {
+            return A.Equals(B, ESearchCase::CaseSensitive);
+        }
+
+        static uint32 GetKeyHash(KeyInitType Key)
+        {
+            return FCrc::StrCrc32(*Key);
+        }
+    };
+
+    /** Interned strings; every string field of the export is an index into this table */
+    struct FStringTable
+    {
+        TArray<TSharedPtr<FJsonValue>> Values;
+        TMap<FString, int32, FDefaultSetAllocator, FCaseSensitiveStringKeyFuncs> Lookup;
+
+        int32 Intern(const FString& Value)
+        {
+            if (const int32* Existing = Lookup.Find(Value))
+            {
+                return *Existing;
+            }
+            const int32 Index = Values.Add(MakeShared<FJsonValueString>(Value));
+            Lookup.Add(Value, Index);
+            return Index;
+        }
+
+        int32 Intern(FName Value)
+        {
+            return Value.IsNone() ? INDEX_NONE : Intern(Value.ToString());
+        }
+    };
+
+    /** Flat integer array; row layouts are listed in the export's "schema" */
+    struct FIntRows
+    {
+        TArray<TSharedPtr<FJsonValue>> Values;
+
+        void Add(int64 Value)
+        {
+            Values.Add(MakeShared<FJsonValueNumber>(static_cast<double>(Value)));
+        }
+    };
+
+    TArray<TSharedPtr<FJsonValue>> MakeFieldList(std::initializer_list<const TCHAR*> Fields)
+    {
+        TArray<TSharedPtr<FJsonValue>> Values;
+        for (const TCHAR* Field : Fields)
+        {
+            Values.Add(MakeShared<FJsonValueString>(Field));
+        }
+        return Values;
+    }
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintCoreCommands::BuildCompactGraphExport(UBlueprint* Blueprint, bool bSummary)
+{
+    FStringTable Strings;
+    FIntRows Graphs, Nodes, Pins, Edges;
+    TArray<TSharedPtr<FJsonValue>> NodeIds;
+
+    struct FGraphSource
+    {
+        const TArray<UEdGraph*>& Graphs;
+        const TCHAR* Kind;
+    };
+    const FGraphSource Sources[] = {
+        { Blueprint->UbergraphPages, TEXT("ubergraph") },
+        { Blueprint->FunctionGraphs, TEXT("function") },
+        { Blueprint->MacroGraphs, TEXT("macro") },
+    };
+
+    // Node and pin indices are assigned in export order so edges can refer to them
+    TArray<const UEdGraphNode*> ExportedNodes;
+    TMap<const UEdGraphNode*, int32> NodeIndex;
+    TMap<const UEdGraphPin*, int32> PinIndex;
+    int32 NumNodes = 0;
+    int32 NumPins = 0;
+
+    for (const FGraphSource& Source : Sources)
+    {
+        const int32 KindIdx = Strings.Intern(FString(Source.Kind));
+        for (const UEdGraph* Graph : Source.Graphs)
+        {
+            if (!Graph)
+            {
+                continue;
+            }
+
+            const int32 GraphIdx = Graphs.Values.Num() / 4;
+            const int32 FirstNode = NumNodes;
+            for (const UEdGraphNode* Node : Graph->Nodes)
+            {
+                if (!Node)
+                {
+                    continue;
+                }
+
+                FName Kind, Member;
+                FSpirrowBridgeBlueprintSearchIndex::ClassifyNode(Node, Kind, Member);
+
+                const int32 NodeIdx = NumNodes++;
+                NodeIndex.Add(Node, NodeIdx);
+                ExportedNodes.Add(Node);
+                NodeIds.Add(MakeShared<FJsonValueString>(Node->NodeGuid.ToString()));
+                Nodes.Add(GraphIdx);
+                Nodes.Add(Strings.Intern(Node->GetClass()->GetFName()));
+                Nodes.Add(Strings.Intern(Kind));
+                Nodes.Add(Strings.Intern(Member));
+                Nodes.Add(Strings.Intern(Node->GetNodeTitle(ENodeTitleType::ListView).ToString()));
+                Nodes.Add(Node->NodePosX);
+                Nodes.Add(Node->NodePosY);
+
+                if (bSummary)
+                {
+                    continue;
+                }
+
+                for (const UEdGraphPin* Pin : Node->Pins)
+                {
+                    if (!Pin)
+                    {
+                        continue;
+                    }
+
+                    const UObject* SubCategoryObject = Pin->PinType.PinSubCategoryObject.Get();
+                    PinIndex.Add(Pin, NumPins++);
+                    Pins.Add(NodeIdx);
+                    Pins.Add(Strings.Intern(Pin->PinName));
+                    Pins.Add(Pin->Direction == EGPD_Input ? 0 : 1);
+                    Pins.Add(Strings.Intern(Pin->PinType.PinCategory));
+                    Pins.Add(SubCategoryObject ? Strings.Intern(SubCategoryObject->GetFName()) : Strings.Intern(Pin->PinType.PinSubCategory));
+                    Pins.Add(static_cast<int32>(Pin->PinType.ContainerType));
+                    Pins.Add(Pin->DefaultValue.IsEmpty() ? INDEX_NONE : Strings.Intern(Pin->DefaultValue));
+                }
+            }
+
+            Graphs.Add(Strings.Intern(Graph->GetFName()));
+            Graphs.Add(KindIdx);
+            Graphs.Add(FirstNode);
+            Graphs.Add(NumNodes - FirstNode);
+        }
+    }
+
+    // Edges once per output pin; summary collapses them to unique node pairs
+    TSet<TPair<int32, int32>> NodeEdges;
+    for (int32 NodeIdx = 0; NodeIdx < ExportedNodes.Num(); ++NodeIdx)
+    {
+        for (const UEdGraphPin* Pin : ExportedNodes[NodeIdx]->Pins)
+        {
+            if (!Pin || Pin->Direction != EGPD_Output)
+            {
+                continue;
+            }
+            for (const UEdGraphPin* Linked : Pin->LinkedTo)
+            {
+                if (!Linked)
+                {
+                    continue;
+                }
+                if (bSummary)
+                {
+                    const int32* TargetNode = NodeIndex.Find(Linked->GetOwningNode());
+                    bool bAlreadyAdded = false;
+                    if (TargetNode)
+                    {
+                        NodeEdges.Add(TPair<int32, int32>(NodeIdx, *TargetNode), &bAlreadyAdded);
+                    }
+                    if (TargetNode && !bAlreadyAdded)
+                    {
+                        Edges.Add(NodeIdx);
+                        Edges.Add(*TargetNode);
+                    }
+                }
+                else if (const int32* TargetPin = PinIndex.Find(Linked))
+                {
+                    Edges.Add(PinIndex[Pin]);
+                    Edges.Add(*TargetPin);
+                }
+            }
+        }
+    }
+
+    FIntRows Variables, Components;
+    for (const FBPVariableDescription& Var : Blueprint->NewVariables)
+    {
+        Variables.Add(Strings.Intern(Var.VarName));
+        Variables.Add(Strings.Intern(Var.VarType.PinCategory));
+    }
+    if (Blueprint->SimpleConstructionScript)
+    {
+        for (const USCS_Node* SCSNode : Blueprint->SimpleConstructionScript->GetAllNodes())
+        {
+            if (SCSNode && SCSNode->ComponentTemplate)
+            {
+                Components.Add(Strings.Intern(SCSNode->GetVariableName()));
+                Components.Add(Strings.Intern(SCSNode->ComponentTemplate->GetClass()->GetFName()));
+            }
+        }
+    }
+
+    // Row layouts, so the reader does not need to know the format in advance
+    TSharedPtr<FJsonObject> Schema = MakeShared<FJsonObject>();
+    Schema->SetArrayField(TEXT("graphs"), MakeFieldList({ TEXT("name"), TEXT("kind"), TEXT("first_node"), TEXT("node_count") }));
+    Schema->SetArrayField(TEXT("nodes"), MakeFieldList({ TEXT("graph"), TEXT("class"), TEXT("kind"), TEXT("member"), TEXT("title"), TEXT("x"), TEXT("y") }));
+    if (bSummary)
+    {
+        Schema->SetArrayField(TEXT("edges"), MakeFieldList({ TEXT("source_node"), TEXT("target_node") }));
+    }
+    else
+    {
+        Schema->SetArrayField(TEXT("pins"), MakeFieldList({ TEXT("node"), TEXT("name"), TEXT("direction"), TEXT("category"), TEXT("sub_type"), TEXT("container"), TEXT("default") }));
+        Schema->SetArrayField(TEXT("edges"), MakeFieldList({ TEXT("source_pin"), TEXT("target_pin") }));
+    }
+    Schema->SetArrayField(TEXT("variables"), MakeFieldList({ TEXT("name"), TEXT("type") }));
+    Schema->SetArrayField(TEXT("components"), MakeFieldList({ TEXT("name"), TEXT("class") }));
+
+    TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
+    ResultData->SetStringField(TEXT("blueprint_name"), Blueprint->GetName());
+    ResultData->SetStringField(TEXT("parent_class"), Blueprint->ParentClass ? Blueprint->ParentClass->GetName() : TEXT("None"));
+    ResultData->SetStringField(TEXT("format"), bSummary ? TEXT("compact_summary") : TEXT("compact"));
+    ResultData->SetObjectField(TEXT("schema"), Schema);
+    ResultData->SetArrayField(TEXT("strings"), Strings.Values);
+    ResultData->SetArrayField(TEXT("graphs"), Graphs.Values);
+    ResultData->SetArrayField(TEXT("node_ids"), NodeIds);
+    ResultData->SetArrayField(TEXT("nodes"), Nodes.Values);
+    if (!bSummary)
+    {
+        ResultData->SetArrayField(TEXT("pins"), Pins.Values);
+    }
+    ResultData->SetArrayField(TEXT("edges"), Edges.Values);
+    ResultData->SetArrayField(TEXT("variables"), Variables.Values);
+    ResultData->SetArrayField(TEXT("components"), Components.Values);
+    ResultData->SetNumberField(TEXT("node_count"), NumNodes);
+    ResultData->SetNumberField(TEXT("edge_count"), Edges.Values.Num() / 2);
+    return ResultData;
+}
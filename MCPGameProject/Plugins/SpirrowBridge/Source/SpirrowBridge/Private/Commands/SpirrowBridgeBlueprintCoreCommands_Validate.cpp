@@ -0,0 +1,211 @@
+#include "Commands/SpirrowBridgeBlueprintCoreCommands.h"
+#include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Variable.h"
+#include "BlueprintCompilationManager.h"
+#include "Kismet2/CompilerResultsLog.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+    struct FValidationSink
+    {
+        TArray<TSharedPtr<FJsonValue>> Diagnostics;
+        int32 NumErrors = 0;
+        int32 NumWarnings = 0;
+        int32 MaxDiagnostics = 200;
+        bool bIncludeWarnings = true;
+
+        /** Diagnostics that would be listed without the cap (warnings only when included) */
+        int32 GetNumReportable() const
+        {
+            return NumErrors + (bIncludeWarnings ? NumWarnings : 0);
+        }
+
+        void Add(const TCHAR* Severity, const UEdGraph* Graph, const UEdGraphNode* Node, const UEdGraphPin* Pin, const FString& Message)
+        {
+            const bool bError = FCString::Strcmp(Severity, TEXT("error")) == 0;
+            bError ? ++NumErrors : ++NumWarnings;
+            if ((!bError && !bIncludeWarnings) || Diagnostics.Num() >= MaxDiagnostics)
+            {
+                return;
+            }
+
+            TSharedPtr<FJsonObject> DiagObj = MakeShared<FJsonObject>();
+            DiagObj->SetStringField(TEXT("severity"), Severity);
+            DiagObj->SetStringField(TEXT("graph"), Graph ? Graph->GetName() : FString());
+            if (Node)
+            {
+                DiagObj->SetStringField(TEXT("node_id"), Node->NodeGuid.ToString());
+                DiagObj->SetStringField(TEXT("node_title"), Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
+            }
+            if (Pin)
+            {
+                DiagObj->SetStringField(TEXT("pin"), Pin->PinName.ToString());
+            }
+            DiagObj->SetStringField(TEXT("message"), Message);
+            Diagnostics.Add(MakeShared<FJsonValueObject>(DiagObj));
+        }
+    };
+
+    bool HasExecInput(const UEdGraphNode* Node, bool& bOutExecLinked)
+    {
+        bool bHasExec = false;
+        bOutExecLinked = false;
+        for (const UEdGraphPin* Pin : Node->Pins)
+        {
+            if (Pin && Pin->Direction == EGPD_Input && Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
+            {
+                bHasExec = true;
+                bOutExecLinked |= Pin->LinkedTo.Num() > 0;
+            }
+        }
+        return bHasExec;
+    }
+
+    /** Schema-level checks the compiler would run, minus bytecode generation */
+    void ValidateNode(const UEdGraph* Graph, UEdGraphNode* Node, FValidationSink& Sink)
+    {
+        const UEdGraphSchema* Schema = Graph->GetSchema();
+
+        // Node's own validation (deprecated calls, bad references, unsupported contexts...)
+        FCompilerResultsLog NodeLog;
+        NodeLog.bSilentMode = true;
+        Node->ValidateNodeDuringCompilation(NodeLog);
+        for (const TSharedRef<FTokenizedMessage>& Message : NodeLog.Messages)
+        {
+            const EMessageSeverity::Type Severity = Message->GetSeverity();
+            if (Severity <= EMessageSeverity::Warning)
+            {
+                Sink.Add(Severity <= EMessageSeverity::Error ? TEXT("error") : TEXT("warning"), Graph, Node, nullptr, Message->ToText().ToString());
+            }
+        }
+
+        // Members must resolve against the freshly regenerated skeleton
+        if (const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+        {
+            if (!CallNode->GetTargetFunction())
+            {
+                Sink.Add(TEXT("error"), Graph, Node, nullptr, FString::Printf(TEXT("Function '%s' could not be resolved"),
+                    *CallNode->FunctionReference.GetMemberName().ToString()));
+            }
+        }
+        else if (const UK2Node_Variable* VariableNode = Cast<UK2Node_Variable>(Node))
+        {
+            if (!VariableNode->GetPropertyForVariable())
+            {
+                Sink.Add(TEXT("error"), Graph, Node, nullptr, FString::Printf(TEXT("Variable '%s' could not be resolved"),
+                    *VariableNode->GetVarName().ToString()));
+            }
+        }
+
+        for (UEdGraphPin* Pin : Node->Pins)
+        {
+            if (!Pin)
+            {
+                continue;
+            }
+            if (Pin->bOrphanedPin && Pin->LinkedTo.Num() > 0)
+            {
+                Sink.Add(TEXT("error"), Graph, Node, Pin, TEXT("Pin no longer exists on the node but is still connected"));
+            }
+            if (Pin->Direction != EGPD_Output)
+            {
+                continue;
+            }
+            for (UEdGraphPin* Linked : Pin->LinkedTo)
+            {
+                if (!Linked)
+                {
+                    continue;
+                }
+                const FPinConnectionResponse Response = Schema->CanCreateConnection(Pin, Linked);
+                if (Response.Response == CONNECT_RESPONSE_DISALLOW)
+                {
+                    Sink.Add(TEXT("error"), Graph, Node, Pin, FString::Printf(TEXT("Incompatible connection to %s.%s: %s"),
+                        *Linked->GetOwningNode()->GetNodeTitle(ENodeTitleType::ListView).ToString(),
+                        *Linked->PinName.ToString(), *Response.Message.ToString()));
+                }
+            }
+        }
+
+        bool bExecLinked = false;
+        if (HasExecInput(Node, bExecLinked) && !bExecLinked)
+        {
+            Sink.Add(TEXT("warning"), Graph, Node, nullptr, TEXT("Exec input is not connected; the node will never run"));
+        }
+    }
+}
+
+// ===== Validate Blueprint =====
+TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintCoreCommands::HandleValidateBlueprint(const TSharedPtr<FJsonObject>& Params)
+{
+    UBlueprint* Blueprint = nullptr;
+    if (auto Error = FSpirrowBridgeCommonUtils::ResolveTargetBlueprint(Params, Blueprint))
+    {
+        return Error;
+    }
+
+    double MaxDiagnostics = 200.0;
+    bool bIncludeWarnings = true;
+    FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("max_diagnostics"), MaxDiagnostics, 200.0);
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("include_warnings"), bIncludeWarnings, true);
+
+    const double Start = FPlatformTime::Seconds();
+
+    // Skeleton only: refreshes the class layout and function signatures that pins
+    // resolve against, without generating bytecode or reinstancing
+    FCompilerResultsLog SkeletonLog;
+    SkeletonLog.bSilentMode = true;
+    FBlueprintCompilationManager::CompileSynchronously(FBPCompileRequest(Blueprint,
+        EBlueprintCompileOptions::RegenerateSkeletonOnly | EBlueprintCompileOptions::SkipGarbageCollection, &SkeletonLog));
+    const double SkeletonMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+    FValidationSink Sink;
+    Sink.MaxDiagnostics = FMath::Max(0, static_cast<int32>(MaxDiagnostics));
+    Sink.bIncludeWarnings = bIncludeWarnings;
+    for (const TSharedRef<FTokenizedMessage>& Message : SkeletonLog.Messages)
+    {
+        if (Message->GetSeverity() <= EMessageSeverity::Error)
+        {
+            Sink.Add(TEXT("error"), nullptr, nullptr, nullptr, Message->ToText().ToString());
+        }
+    }
+
+    TArray<UEdGraph*> Graphs;
+    Blueprint->GetAllGraphs(Graphs);
+    int32 NodeCount = 0;
+    for (UEdGraph* Graph : Graphs)
+    {
+        if (!Graph)
+        {
+            continue;
+        }
+        for (UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (Node)
+            {
+                ValidateNode(Graph, Node, Sink);
+                ++NodeCount;
+            }
+        }
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetStringField(TEXT("name"), Blueprint->GetName());
+    ResultObj->SetBoolField(TEXT("valid"), Sink.NumErrors == 0);
+    ResultObj->SetNumberField(TEXT("error_count"), Sink.NumErrors);
+    ResultObj->SetNumberField(TEXT("warning_count"), Sink.NumWarnings);
+    ResultObj->SetNumberField(TEXT("nodes_checked"), NodeCount);
+    ResultObj->SetNumberField(TEXT("skeleton_time_ms"), SkeletonMs);
+    ResultObj->SetNumberField(TEXT("total_time_ms"), (FPlatformTime::Seconds() - Start) * 1000.0);
+    ResultObj->SetArrayField(TEXT("diagnostics"), Sink.Diagnostics);
+    ResultObj->SetBoolField(TEXT("truncated"), Sink.GetNumReportable() > Sink.Diagnostics.Num());
+    return ResultObj;
+}
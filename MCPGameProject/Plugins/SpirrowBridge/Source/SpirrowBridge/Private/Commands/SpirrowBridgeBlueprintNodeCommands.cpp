@@ -2,6 +2,7 @@
 #include "Commands/SpirrowBridgeBlueprintNodeCoreCommands.h"
 #include "Commands/SpirrowBridgeBlueprintNodeVariableCommands.h"
 #include "Commands/SpirrowBridgeBlueprintNodeControlFlowCommands.h"
+#include "Commands/SpirrowBridgeBlueprintNodeGraphCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
 
 FSpirrowBridgeBlueprintNodeCommands::FSpirrowBridgeBlueprintNodeCommands()
@@ -9,6 +10,7 @@ FSpirrowBridgeBlueprintNodeCommands::FSpirrowBridgeBlueprintNodeCommands()
     CoreCommands = MakeShared<FSpirrowBridgeBlueprintNodeCoreCommands>();
     VariableCommands = MakeShared<FSpirrowBridgeBlueprintNodeVariableCommands>();
     ControlFlowCommands = MakeShared<FSpirrowBridgeBlueprintNodeControlFlowCommands>();
+    GraphCommands = MakeShared<FSpirrowBridgeBlueprintNodeGraphCommands>();
 }
 
 FSpirrowBridgeBlueprintNodeCommands::~FSpirrowBridgeBlueprintNodeCommands()
@@ -16,6 +18,7 @@ FSpirrowBridgeBlueprintNodeCommands::~FSpirrowBridgeBlueprintNodeCommands()
     CoreCommands.Reset();
     VariableCommands.Reset();
     ControlFlowCommands.Reset();
+    GraphCommands.Reset();
 }
 
 TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
@@ -43,6 +46,13 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeCommands::HandleCommand(const
         return Result;
     }
 
+    // Try GraphCommands (whole-graph declarative build)
+    Result = GraphCommands->HandleCommand(CommandType, Params);
+    if (Result.IsValid())
+    {
+        return Result;
+    }
+
     // Unknown command
     return FSpirrowBridgeCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown blueprint node command: %s"), *CommandType));
 }
@@ -1,5 +1,6 @@
 #include "Commands/SpirrowBridgeBlueprintNodeControlFlowCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeNodeTemplateCache.h"
 #include "Engine/Blueprint.h"
 #include "EdGraph/EdGraph.h"
 #include "K2Node_CallFunction.h"
@@ -184,7 +185,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeControlFlowCommands::HandleAd
             TEXT("Failed to get event graph"));
     }
 
-    UFunction* DelayFunction = UKismetSystemLibrary::StaticClass()->FindFunctionByName(TEXT("Delay"));
+    UFunction* DelayFunction = FSpirrowBridgeNodeTemplateCache::Get().FindFunction(UKismetSystemLibrary::StaticClass(), TEXT("Delay"));
     if (!DelayFunction)
     {
         return FSpirrowBridgeCommonUtils::CreateErrorResponse(
@@ -337,7 +338,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeControlFlowCommands::HandleAd
             TEXT("Failed to get event graph"));
     }
 
-    UFunction* PrintStringFunction = UKismetSystemLibrary::StaticClass()->FindFunctionByName(TEXT("PrintString"));
+    UFunction* PrintStringFunction = FSpirrowBridgeNodeTemplateCache::Get().FindFunction(UKismetSystemLibrary::StaticClass(), TEXT("PrintString"));
     if (!PrintStringFunction)
     {
         return FSpirrowBridgeCommonUtils::CreateErrorResponse(
@@ -425,7 +426,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeControlFlowCommands::HandleAd
             FString::Printf(TEXT("Unsupported operation/type: %s/%s"), *Operation, *ValueType));
     }
 
-    UFunction* MathFunction = UKismetMathLibrary::StaticClass()->FindFunctionByName(*FunctionName);
+    UFunction* MathFunction = FSpirrowBridgeNodeTemplateCache::Get().FindFunction(UKismetMathLibrary::StaticClass(), FunctionName);
     if (!MathFunction)
     {
         return FSpirrowBridgeCommonUtils::CreateErrorResponse(
@@ -514,7 +515,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeControlFlowCommands::HandleAd
             FString::Printf(TEXT("Unsupported comparison/type: %s/%s"), *Operation, *ValueType));
     }
 
-    UFunction* ComparisonFunction = UKismetMathLibrary::StaticClass()->FindFunctionByName(*FunctionName);
+    UFunction* ComparisonFunction = FSpirrowBridgeNodeTemplateCache::Get().FindFunction(UKismetMathLibrary::StaticClass(), FunctionName);
     if (!ComparisonFunction)
     {
         return FSpirrowBridgeCommonUtils::CreateErrorResponse(
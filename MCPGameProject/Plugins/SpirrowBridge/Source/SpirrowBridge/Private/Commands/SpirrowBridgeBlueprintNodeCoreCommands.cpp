@@ -1,5 +1,8 @@
 #include "Commands/SpirrowBridgeBlueprintNodeCoreCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeNodeIndex.h"
+#include "Commands/SpirrowBridgeBlueprintSearchIndex.h"
+#include "Commands/SpirrowBridgeNodeTemplateCache.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "EdGraph/EdGraph.h"
@@ -9,11 +12,6 @@
 #include "K2Node_CallFunction.h"
 #include "K2Node_VariableGet.h"
 #include "K2Node_VariableSet.h"
-#include "K2Node_InputAction.h"
-#include "K2Node_IfThenElse.h"
-#include "K2Node_Self.h"
-#include "K2Node_ExecutionSequence.h"
-#include "K2Node_MacroInstance.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/KismetEditorUtilities.h"
 #include "EdGraphSchema_K2.h"
@@ -38,6 +36,10 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeCoreCommands::HandleCommand(c
     {
         return HandleFindBlueprintNodes(Params);
     }
+    else if (CommandType == TEXT("search_blueprint_nodes"))
+    {
+        return HandleSearchBlueprintNodes(Params);
+    }
     else if (CommandType == TEXT("set_node_pin_value"))
     {
         return HandleSetNodePinValue(Params);
@@ -90,36 +92,29 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeCoreCommands::HandleConnectBl
         return Error;
     }
 
-    UEdGraph* EventGraph = FSpirrowBridgeCommonUtils::FindOrCreateEventGraph(Blueprint);
-    if (!EventGraph)
-    {
-        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-            ESpirrowErrorCode::GraphNotFound,
-            TEXT("Failed to get event graph"));
-    }
-
+    // Nodes are resolved across all graphs (event graph, functions, macros)
+    FSpirrowBridgeNodeIndex& NodeIndex = FSpirrowBridgeNodeIndex::Get();
     UEdGraphNode* SourceNode = nullptr;
     UEdGraphNode* TargetNode = nullptr;
-    for (UEdGraphNode* Node : EventGraph->Nodes)
+    if (auto Error = NodeIndex.ResolveNode(Blueprint, SourceNodeId, SourceNode, TEXT("Source node")))
     {
-        if (Node->NodeGuid.ToString() == SourceNodeId) SourceNode = Node;
-        else if (Node->NodeGuid.ToString() == TargetNodeId) TargetNode = Node;
+        return Error;
     }
-
-    if (!SourceNode)
+    if (auto Error = NodeIndex.ResolveNode(Blueprint, TargetNodeId, TargetNode, TEXT("Target node")))
     {
-        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-            ESpirrowErrorCode::NodeNotFound,
-            FString::Printf(TEXT("Source node not found: %s"), *SourceNodeId));
+        return Error;
     }
-    if (!TargetNode)
+
+    UEdGraph* Graph = SourceNode->GetGraph();
+    if (Graph != TargetNode->GetGraph())
     {
         return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-            ESpirrowErrorCode::NodeNotFound,
-            FString::Printf(TEXT("Target node not found: %s"), *TargetNodeId));
+            ESpirrowErrorCode::ConnectionFailed,
+            FString::Printf(TEXT("Nodes are in different graphs (%s, %s)"),
+                *GetNameSafe(Graph), *GetNameSafe(TargetNode->GetGraph())));
     }
 
-    if (FSpirrowBridgeCommonUtils::ConnectGraphNodes(EventGraph, SourceNode, SourcePinName, TargetNode, TargetPinName))
+    if (FSpirrowBridgeCommonUtils::ConnectGraphNodes(Graph, SourceNode, SourcePinName, TargetNode, TargetPinName))
     {
         FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
         TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
@@ -158,30 +153,11 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeCoreCommands::HandleDisconnec
         return Error;
     }
 
-    UEdGraph* EventGraph = FSpirrowBridgeCommonUtils::FindOrCreateEventGraph(Blueprint);
-    if (!EventGraph)
-    {
-        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-            ESpirrowErrorCode::GraphNotFound,
-            TEXT("Failed to get event graph"));
-    }
-
     // Find the source node
     UEdGraphNode* SourceNode = nullptr;
-    for (UEdGraphNode* Node : EventGraph->Nodes)
+    if (auto Error = FSpirrowBridgeNodeIndex::Get().ResolveNode(Blueprint, NodeId, SourceNode))
     {
-        if (Node->NodeGuid.ToString() == NodeId)
-        {
-            SourceNode = Node;
-            break;
-        }
-    }
-
-    if (!SourceNode)
-    {
-        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-            ESpirrowErrorCode::NodeNotFound,
-            FString::Printf(TEXT("Node not found: %s"), *NodeId));
+        return Error;
     }
 
     int32 DisconnectedCount = 0;
@@ -191,20 +167,9 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeCoreCommands::HandleDisconnec
     if (!PinName.IsEmpty() && !TargetNodeId.IsEmpty() && !TargetPinName.IsEmpty())
     {
         UEdGraphNode* TargetNode = nullptr;
-        for (UEdGraphNode* Node : EventGraph->Nodes)
-        {
-            if (Node->NodeGuid.ToString() == TargetNodeId)
-            {
-                TargetNode = Node;
-                break;
-            }
-        }
-
-        if (!TargetNode)
+        if (auto Error = FSpirrowBridgeNodeIndex::Get().ResolveNode(Blueprint, TargetNodeId, TargetNode, TEXT("Target node")))
         {
-            return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-                ESpirrowErrorCode::NodeNotFound,
-                FString::Printf(TEXT("Target node not found: %s"), *TargetNodeId));
+            return Error;
         }
 
         UEdGraphPin* SourcePin = FSpirrowBridgeCommonUtils::FindPin(SourceNode, PinName, EGPD_MAX);
@@ -314,58 +279,15 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeCoreCommands::HandleFindBluep
     {
         if (!Node) continue;
 
-        FString DetectedType = TEXT("Other");
-        FString NodeName;
+        FName Kind, Member;
+        FSpirrowBridgeBlueprintSearchIndex::ClassifyNode(Node, Kind, Member);
+        const FString DetectedType = Kind.ToString();
+        const FString NodeName = Member.IsNone() ? FString() : Member.ToString();
 
-        if (UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
-        {
-            DetectedType = TEXT("Event");
-            NodeName = EventNode->EventReference.GetMemberName().ToString();
-            if (!EventType.IsEmpty() && NodeName != EventType) continue;
-        }
-        else if (UK2Node_CallFunction* FuncNode = Cast<UK2Node_CallFunction>(Node))
-        {
-            DetectedType = TEXT("Function");
-            NodeName = FuncNode->FunctionReference.GetMemberName().ToString();
-            if (!FunctionNameFilter.IsEmpty() && NodeName != FunctionNameFilter) continue;
-        }
-        else if (UK2Node_VariableGet* VarGetNode = Cast<UK2Node_VariableGet>(Node))
-        {
-            DetectedType = TEXT("VariableGet");
-            NodeName = VarGetNode->VariableReference.GetMemberName().ToString();
-            if (!VariableNameFilter.IsEmpty() && NodeName != VariableNameFilter) continue;
-        }
-        else if (UK2Node_VariableSet* VarSetNode = Cast<UK2Node_VariableSet>(Node))
-        {
-            DetectedType = TEXT("VariableSet");
-            NodeName = VarSetNode->VariableReference.GetMemberName().ToString();
-            if (!VariableNameFilter.IsEmpty() && NodeName != VariableNameFilter) continue;
-        }
-        else if (Cast<UK2Node_IfThenElse>(Node))
-        {
-            DetectedType = TEXT("Branch");
-            NodeName = TEXT("Branch");
-        }
-        else if (Cast<UK2Node_ExecutionSequence>(Node))
-        {
-            DetectedType = TEXT("Sequence");
-            NodeName = TEXT("Sequence");
-        }
-        else if (UK2Node_MacroInstance* MacroNode = Cast<UK2Node_MacroInstance>(Node))
-        {
-            DetectedType = TEXT("Macro");
-            if (MacroNode->GetMacroGraph()) NodeName = MacroNode->GetMacroGraph()->GetName();
-        }
-        else if (UK2Node_InputAction* InputNode = Cast<UK2Node_InputAction>(Node))
-        {
-            DetectedType = TEXT("InputAction");
-            NodeName = InputNode->InputActionName.ToString();
-        }
-        else if (Cast<UK2Node_Self>(Node))
-        {
-            DetectedType = TEXT("Self");
-            NodeName = TEXT("Self");
-        }
+        if (DetectedType == TEXT("Event") && !EventType.IsEmpty() && NodeName != EventType) continue;
+        if (DetectedType == TEXT("Function") && !FunctionNameFilter.IsEmpty() && NodeName != FunctionNameFilter) continue;
+        if ((DetectedType == TEXT("VariableGet") || DetectedType == TEXT("VariableSet")) &&
+            !VariableNameFilter.IsEmpty() && NodeName != VariableNameFilter) continue;
 
         if (!NodeType.IsEmpty() && NodeType != TEXT("All"))
         {
@@ -409,6 +331,133 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeCoreCommands::HandleFindBluep
     return ResultObj;
 }
 
+TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeCoreCommands::HandleSearchBlueprintNodes(const TSharedPtr<FJsonObject>& Params)
+{
+    FString Path = TEXT("/Game");
+    bool bRebuild = false;
+    double Offset = 0.0;
+    double Limit = 100.0;
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("path"), Path, TEXT("/Game"));
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("rebuild"), bRebuild, false);
+    FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("offset"), Offset, 0.0);
+    FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("limit"), Limit, 100.0);
+
+    FSpirrowBridgeBlueprintSearchIndex::FQuery Query;
+    Query.Offset = FMath::Max(0, static_cast<int32>(Offset));
+    Query.Limit = FMath::Max(0, static_cast<int32>(Limit));
+    Query.PathPrefix = Path.EndsWith(TEXT("/")) ? Path : Path + TEXT("/");
+
+    auto ReadTerms = [&Params](const TCHAR* Field, TArray<FName>& OutTerms)
+    {
+        const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+        if (Params->TryGetArrayField(Field, Values))
+        {
+            for (const TSharedPtr<FJsonValue>& Value : *Values)
+            {
+                const FString Text = Value->AsString();
+                if (!Text.IsEmpty())
+                {
+                    OutTerms.Add(FSpirrowBridgeBlueprintSearchIndex::ParseTerm(Text));
+                }
+            }
+        }
+    };
+
+    // all: every term must match, any: at least one, none: no term may match
+    TArray<FName> AllTerms, AnyTerms;
+    ReadTerms(TEXT("all"), AllTerms);
+    ReadTerms(TEXT("any"), AnyTerms);
+    ReadTerms(TEXT("none"), Query.Excluded);
+    for (const FName Term : AllTerms)
+    {
+        Query.Clauses.Add({ Term });
+    }
+    if (AnyTerms.Num() > 0)
+    {
+        Query.Clauses.Add(AnyTerms);
+    }
+
+    // Shorthand filters, same names as find_blueprint_nodes
+    FString NodeType, FunctionName, VariableName, EventName;
+    Params->TryGetStringField(TEXT("node_type"), NodeType);
+    Params->TryGetStringField(TEXT("function_name"), FunctionName);
+    Params->TryGetStringField(TEXT("variable_name"), VariableName);
+    Params->TryGetStringField(TEXT("event_name"), EventName);
+    if (NodeType == TEXT("Variable"))
+    {
+        Query.Clauses.Add({ FName(TEXT("kind:VariableGet")), FName(TEXT("kind:VariableSet")) });
+    }
+    else if (!NodeType.IsEmpty() && NodeType != TEXT("All"))
+    {
+        Query.Clauses.Add({ FSpirrowBridgeBlueprintSearchIndex::MakeTerm(TEXT("kind"), FName(*NodeType)) });
+    }
+    if (!FunctionName.IsEmpty())
+    {
+        Query.Clauses.Add({ FSpirrowBridgeBlueprintSearchIndex::MakeTerm(TEXT("function"), FName(*FunctionName)) });
+    }
+    if (!VariableName.IsEmpty())
+    {
+        Query.Clauses.Add({ FSpirrowBridgeBlueprintSearchIndex::MakeTerm(TEXT("variable"), FName(*VariableName)) });
+    }
+    if (!EventName.IsEmpty())
+    {
+        Query.Clauses.Add({ FSpirrowBridgeBlueprintSearchIndex::MakeTerm(TEXT("event"), FName(*EventName)) });
+    }
+
+    if (Query.Clauses.Num() == 0 && Query.Excluded.Num() == 0)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::MissingRequiredParam,
+            TEXT("At least one filter is required (all, any, none, node_type, function_name, variable_name, event_name)"));
+    }
+
+    FSpirrowBridgeBlueprintSearchIndex& Index = FSpirrowBridgeBlueprintSearchIndex::Get();
+
+    const double IndexStart = FPlatformTime::Seconds();
+    const int32 NumIndexed = Index.EnsureIndexed(Path, bRebuild);
+    const double IndexMs = (FPlatformTime::Seconds() - IndexStart) * 1000.0;
+
+    const double QueryStart = FPlatformTime::Seconds();
+    const FSpirrowBridgeBlueprintSearchIndex::FQueryResult QueryResult = Index.Query(Query);
+    const double QueryMs = (FPlatformTime::Seconds() - QueryStart) * 1000.0;
+
+    TArray<TSharedPtr<FJsonValue>> NodesArray;
+    for (const int32 RecordId : QueryResult.Records)
+    {
+        const FSpirrowBridgeBlueprintSearchIndex::FNodeRecord& Record = Index.GetRecord(RecordId);
+        const FSpirrowBridgeBlueprintSearchIndex::FAssetEntry& Asset = Index.GetAsset(Record.AssetId);
+
+        TSharedPtr<FJsonObject> NodeObj = MakeShared<FJsonObject>();
+        NodeObj->SetStringField(TEXT("blueprint"), Asset.AssetName.ToString());
+        NodeObj->SetStringField(TEXT("asset_path"), Asset.ObjectPath.ToString());
+        NodeObj->SetStringField(TEXT("graph"), Record.Graph.ToString());
+        NodeObj->SetStringField(TEXT("node_id"), Record.NodeGuid.ToString());
+        NodeObj->SetStringField(TEXT("node_type"), Record.Kind.ToString());
+        NodeObj->SetStringField(TEXT("node_class"), Record.NodeClass.ToString());
+        NodeObj->SetStringField(TEXT("name"), Record.Member.IsNone() ? FString() : Record.Member.ToString());
+        NodesArray.Add(MakeShared<FJsonValueObject>(NodeObj));
+    }
+
+    TSharedPtr<FJsonObject> IndexObj = MakeShared<FJsonObject>();
+    IndexObj->SetNumberField(TEXT("assets"), Index.GetNumAssets());
+    IndexObj->SetNumberField(TEXT("nodes"), Index.GetNumRecords());
+    IndexObj->SetNumberField(TEXT("terms"), Index.GetNumTerms());
+    IndexObj->SetNumberField(TEXT("indexed_now"), NumIndexed);
+    IndexObj->SetNumberField(TEXT("index_time_ms"), IndexMs);
+    IndexObj->SetNumberField(TEXT("query_time_ms"), QueryMs);
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetArrayField(TEXT("nodes"), NodesArray);
+    ResultObj->SetNumberField(TEXT("count"), NodesArray.Num());
+    ResultObj->SetNumberField(TEXT("total"), QueryResult.TotalMatches);
+    ResultObj->SetNumberField(TEXT("blueprints_matched"), QueryResult.NumAssetsMatched);
+    ResultObj->SetNumberField(TEXT("offset"), Query.Offset);
+    ResultObj->SetBoolField(TEXT("has_more"), Query.Offset + NodesArray.Num() < QueryResult.TotalMatches);
+    ResultObj->SetObjectField(TEXT("index"), IndexObj);
+    return ResultObj;
+}
+
 TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeCoreCommands::HandleSetNodePinValue(const TSharedPtr<FJsonObject>& Params)
 {
     // Validate required parameters
@@ -433,25 +482,10 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeCoreCommands::HandleSetNodePi
         return Error;
     }
 
-    UEdGraph* EventGraph = FSpirrowBridgeCommonUtils::FindOrCreateEventGraph(Blueprint);
-    if (!EventGraph)
-    {
-        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-            ESpirrowErrorCode::GraphNotFound,
-            TEXT("Failed to get event graph"));
-    }
-
     UEdGraphNode* TargetNode = nullptr;
-    for (UEdGraphNode* Node : EventGraph->Nodes)
-    {
-        if (Node->NodeGuid.ToString() == NodeId) { TargetNode = Node; break; }
-    }
-
-    if (!TargetNode)
+    if (auto Error = FSpirrowBridgeNodeIndex::Get().ResolveNode(Blueprint, NodeId, TargetNode))
     {
-        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-            ESpirrowErrorCode::NodeNotFound,
-            FString::Printf(TEXT("Node not found: %s"), *NodeId));
+        return Error;
     }
 
     UEdGraphPin* TargetPin = FSpirrowBridgeCommonUtils::FindPin(TargetNode, PinName, EGPD_Input);
@@ -620,32 +654,17 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeCoreCommands::HandleDeleteNod
         return Error;
     }
 
-    UEdGraph* EventGraph = FSpirrowBridgeCommonUtils::FindOrCreateEventGraph(Blueprint);
-    if (!EventGraph)
-    {
-        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-            ESpirrowErrorCode::GraphNotFound,
-            TEXT("Failed to get event graph"));
-    }
-
     UEdGraphNode* TargetNode = nullptr;
-    for (UEdGraphNode* Node : EventGraph->Nodes)
-    {
-        if (Node->NodeGuid.ToString() == NodeId) { TargetNode = Node; break; }
-    }
-
-    if (!TargetNode)
+    if (auto Error = FSpirrowBridgeNodeIndex::Get().ResolveNode(Blueprint, NodeId, TargetNode))
     {
-        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-            ESpirrowErrorCode::NodeNotFound,
-            FString::Printf(TEXT("Node not found: %s"), *NodeId));
+        return Error;
     }
 
     for (UEdGraphPin* Pin : TargetNode->Pins)
     {
         Pin->BreakAllPinLinks();
     }
-    EventGraph->RemoveNode(TargetNode);
+    TargetNode->GetGraph()->RemoveNode(TargetNode);
     FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
@@ -679,25 +698,10 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeCoreCommands::HandleMoveNode(
         return Error;
     }
 
-    UEdGraph* EventGraph = FSpirrowBridgeCommonUtils::FindOrCreateEventGraph(Blueprint);
-    if (!EventGraph)
-    {
-        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-            ESpirrowErrorCode::GraphNotFound,
-            TEXT("Failed to get event graph"));
-    }
-
     UEdGraphNode* TargetNode = nullptr;
-    for (UEdGraphNode* Node : EventGraph->Nodes)
+    if (auto Error = FSpirrowBridgeNodeIndex::Get().ResolveNode(Blueprint, NodeId, TargetNode))
     {
-        if (Node->NodeGuid.ToString() == NodeId) { TargetNode = Node; break; }
-    }
-
-    if (!TargetNode)
-    {
-        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
-            ESpirrowErrorCode::NodeNotFound,
-            FString::Printf(TEXT("Node not found: %s"), *NodeId));
+        return Error;
     }
 
     TargetNode->NodePosX = NewPosition.X;
@@ -871,24 +875,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeCoreCommands::HandleAddBluepr
         
         if (TargetClass)
         {
-            Function = TargetClass->FindFunctionByName(*FunctionName);
-            UClass* CurrentClass = TargetClass;
-            while (!Function && CurrentClass)
-            {
-                Function = CurrentClass->FindFunctionByName(*FunctionName);
-                if (!Function)
-                {
-                    for (TFieldIterator<UFunction> FuncIt(CurrentClass); FuncIt; ++FuncIt)
-                    {
-                        if ((*FuncIt)->GetName().Equals(FunctionName, ESearchCase::IgnoreCase))
-                        {
-                            Function = *FuncIt;
-                            break;
-                        }
-                    }
-                }
-                CurrentClass = CurrentClass->GetSuperClass();
-            }
+            Function = FSpirrowBridgeNodeTemplateCache::Get().FindFunction(TargetClass, FunctionName);
         }
     }
     
@@ -914,7 +901,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeCoreCommands::HandleAddBluepr
     FString FallbackPropertyName;
     if (!FunctionNode && !Target.IsEmpty())
     {
-        UClass* FallbackClass = FSpirrowBridgeCommonUtils::FindClassByNameAnywhere(Target);
+        UClass* FallbackClass = FSpirrowBridgeNodeTemplateCache::Get().FindClass(Target);
         if (FallbackClass)
         {
             FString StrippedName;
@@ -0,0 +1,2039 @@
+#include "Commands/SpirrowBridgeBlueprintNodeGraphCommands.h"
+#include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeNodeIndex.h"
+#include "Commands/SpirrowBridgeGraphLayout.h"
+#include "Commands/SpirrowBridgeNodeTemplateCache.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_Event.h"
+#include "K2Node_CustomEvent.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_VariableGet.h"
+#include "K2Node_VariableSet.h"
+#include "K2Node_IfThenElse.h"
+#include "K2Node_ExecutionSequence.h"
+#include "K2Node_MacroInstance.h"
+#include "K2Node_Self.h"
+#include "EdGraphNode_Comment.h"
+#include "Kismet/KismetMathLibrary.h"
+#include "Kismet/KismetSystemLibrary.h"
+#include "Kismet/GameplayStatics.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Kismet2/CompilerResultsLog.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSpirrowBridgeNodeGraph, Log, All);
+
+namespace
+{
+    struct FGraphNodeSpec
+    {
+        FString TempId;
+        FString Type;
+        FVector2D Position = FVector2D::ZeroVector;
+        bool bHasPosition = false;
+        TSharedPtr<FJsonObject> Json;
+    };
+
+    struct FGraphEdgeSpec
+    {
+        FString Source;
+        FString SourcePin;
+        FString Target;
+        FString TargetPin;
+    };
+
+    const TCHAR* SupportedNodeTypes = TEXT("event, custom_event, function, variable_get, variable_set, component, self, branch, sequence, delay, print_string, for_loop_with_break, math, comparison");
+
+    /** Place, register and initialize a freshly constructed node */
+    void FinishNode(UEdGraph* Graph, UEdGraphNode* Node, const FVector2D& Position)
+    {
+        Node->NodePosX = Position.X;
+        Node->NodePosY = Position.Y;
+        Graph->AddNode(Node, false, false);
+        Node->CreateNewGuid();
+        Node->PostPlacedNewNode();
+        Node->AllocateDefaultPins();
+    }
+
+    FString GetMathFunctionName(const FString& Operation, const FString& ValueType, bool bComparison)
+    {
+        static const TMap<FString, FString> MathOps = {
+            { TEXT("Add"), TEXT("Add") }, { TEXT("Subtract"), TEXT("Subtract") },
+            { TEXT("Multiply"), TEXT("Multiply") }, { TEXT("Divide"), TEXT("Divide") } };
+        static const TMap<FString, FString> CompareOps = {
+            { TEXT("Greater"), TEXT("Greater") }, { TEXT("GreaterEqual"), TEXT("GreaterEqual") },
+            { TEXT("Less"), TEXT("Less") }, { TEXT("LessEqual"), TEXT("LessEqual") },
+            { TEXT("Equal"), TEXT("EqualEqual") }, { TEXT("NotEqual"), TEXT("NotEqual") } };
+
+        const FString* Prefix = (bComparison ? CompareOps : MathOps).Find(Operation);
+        if (!Prefix)
+        {
+            return FString();
+        }
+        if (ValueType == TEXT("Float"))
+        {
+            return *Prefix + TEXT("_DoubleDouble");
+        }
+        if (ValueType == TEXT("Int"))
+        {
+            return *Prefix + TEXT("_IntInt");
+        }
+        return FString();
+    }
+
+    UFunction* FindCallableFunction(UBlueprint* Blueprint, const FString& FunctionName, const FString& Target)
+    {
+        auto FindInClass = [&FunctionName](UClass* Class) -> UFunction*
+        {
+            return FSpirrowBridgeNodeTemplateCache::Get().FindFunction(Class, FunctionName);
+        };
+
+        if (!Target.IsEmpty())
+        {
+            return FindInClass(FSpirrowBridgeNodeTemplateCache::Get().FindClass(Target));
+        }
+
+        // Own functions (skeleton class is current even before compile), then common libraries
+        UClass* Candidates[] = {
+            Blueprint->SkeletonGeneratedClass,
+            Blueprint->GeneratedClass,
+            UKismetSystemLibrary::StaticClass(),
+            UKismetMathLibrary::StaticClass(),
+            UGameplayStatics::StaticClass() };
+        for (UClass* Class : Candidates)
+        {
+            if (UFunction* Function = FindInClass(Class))
+            {
+                return Function;
+            }
+        }
+        return nullptr;
+    }
+
+    bool HasMemberVariable(UBlueprint* Blueprint, FName VariableName)
+    {
+        if (FBlueprintEditorUtils::FindNewVariableIndex(Blueprint, VariableName) != INDEX_NONE)
+        {
+            return true;
+        }
+        UClass* SearchClass = Blueprint->SkeletonGeneratedClass ? Blueprint->SkeletonGeneratedClass : Blueprint->GeneratedClass;
+        return SearchClass && FindFProperty<FProperty>(SearchClass, VariableName) != nullptr;
+    }
+
+    /**
+     * Initial value for a shorthand pin the spec leaves out. Values that are
+     * given go through GetSpecPinValues / ApplyPinDefault like any other pin.
+     */
+    void SetShorthandFallback(const TSharedPtr<FJsonObject>& Json, UEdGraphNode* Node, const TCHAR* FieldName, const TCHAR* PinName, const TCHAR* Fallback)
+    {
+        if (Json->HasField(FieldName))
+        {
+            return;
+        }
+        if (UEdGraphPin* Pin = FSpirrowBridgeCommonUtils::FindPin(Node, PinName, EGPD_Input))
+        {
+            Pin->DefaultValue = Fallback;
+        }
+    }
+
+    /**
+     * Spawn one node from its spec. bOutCreated is false when an existing
+     * node was reused (event overrides and events that already exist).
+     */
+    UEdGraphNode* CreateNodeFromSpec(UBlueprint* Blueprint, UEdGraph* Graph, const FGraphNodeSpec& Spec, bool& bOutCreated, FString& OutError)
+    {
+        bOutCreated = true;
+        const TSharedPtr<FJsonObject>& Json = Spec.Json;
+        const FString Type = Spec.Type.ToLower();
+
+        if (Type == TEXT("event"))
+        {
+            FString EventName;
+            Json->TryGetStringField(TEXT("event_name"), EventName);
+            if (EventName.IsEmpty())
+            {
+                OutError = TEXT("'event' node requires event_name");
+                return nullptr;
+            }
+
+            UFunction* ParentFunction = nullptr;
+            for (UClass* Class = Blueprint->ParentClass; Class && !ParentFunction; Class = Class->GetSuperClass())
+            {
+                UFunction* Candidate = Class->FindFunctionByName(*EventName, EIncludeSuperFlag::ExcludeSuper);
+                if (Candidate && Candidate->HasAnyFunctionFlags(FUNC_BlueprintEvent))
+                {
+                    ParentFunction = Candidate;
+                }
+            }
+
+            if (!ParentFunction)
+            {
+                UK2Node_Event* EventNode = FSpirrowBridgeCommonUtils::FindExistingEventNode(Graph, EventName);
+                bOutCreated = EventNode == nullptr;
+                if (!EventNode)
+                {
+                    EventNode = FSpirrowBridgeCommonUtils::CreateEventNode(Graph, EventName, Spec.Position);
+                }
+                if (!EventNode)
+                {
+                    OutError = FString::Printf(TEXT("Event not found: %s"), *EventName);
+                }
+                return EventNode;
+            }
+
+            if (UK2Node_Event* Existing = FBlueprintEditorUtils::FindOverrideForFunction(Blueprint, ParentFunction->GetOwnerClass(), ParentFunction->GetFName()))
+            {
+                bOutCreated = false;
+                return Existing;
+            }
+
+            UK2Node_Event* EventNode = NewObject<UK2Node_Event>(Graph);
+            EventNode->EventReference.SetFromField<UFunction>(ParentFunction, false);
+            EventNode->bOverrideFunction = true;
+            FinishNode(Graph, EventNode, Spec.Position);
+            return EventNode;
+        }
+        if (Type == TEXT("custom_event"))
+        {
+            FString EventName;
+            Json->TryGetStringField(TEXT("event_name"), EventName);
+            if (EventName.IsEmpty())
+            {
+                OutError = TEXT("'custom_event' node requires event_name");
+                return nullptr;
+            }
+
+            for (UEdGraphNode* Node : Graph->Nodes)
+            {
+                UK2Node_CustomEvent* Existing = Cast<UK2Node_CustomEvent>(Node);
+                if (Existing && Existing->CustomFunctionName == FName(*EventName))
+                {
+                    bOutCreated = false;
+                    return Existing;
+                }
+            }
+
+            UK2Node_CustomEvent* EventNode = NewObject<UK2Node_CustomEvent>(Graph);
+            EventNode->CustomFunctionName = FName(*EventName);
+            FinishNode(Graph, EventNode, Spec.Position);
+            return EventNode;
+        }
+        if (Type == TEXT("function"))
+        {
+            FString FunctionName, Target;
+            Json->TryGetStringField(TEXT("function_name"), FunctionName);
+            Json->TryGetStringField(TEXT("target"), Target);
+            if (FunctionName.IsEmpty())
+            {
+                OutError = TEXT("'function' node requires function_name");
+                return nullptr;
+            }
+
+            UFunction* Function = FindCallableFunction(Blueprint, FunctionName, Target);
+            if (!Function)
+            {
+                OutError = FString::Printf(TEXT("Function not found: %s in target %s"), *FunctionName, Target.IsEmpty() ? TEXT("Blueprint") : *Target);
+                return nullptr;
+            }
+            return FSpirrowBridgeCommonUtils::CreateFunctionCallNode(Graph, Function, Spec.Position);
+        }
+        if (Type == TEXT("variable_get") || Type == TEXT("variable_set") || Type == TEXT("component"))
+        {
+            const TCHAR* NameField = Type == TEXT("component") ? TEXT("component_name") : TEXT("variable_name");
+            FString VariableName;
+            Json->TryGetStringField(NameField, VariableName);
+            if (VariableName.IsEmpty())
+            {
+                OutError = FString::Printf(TEXT("'%s' node requires %s"), *Spec.Type, NameField);
+                return nullptr;
+            }
+            if (!HasMemberVariable(Blueprint, FName(*VariableName)))
+            {
+                OutError = FString::Printf(TEXT("Variable not found: %s"), *VariableName);
+                return nullptr;
+            }
+
+            UK2Node_Variable* VariableNode = nullptr;
+            if (Type == TEXT("variable_set"))
+            {
+                VariableNode = NewObject<UK2Node_VariableSet>(Graph);
+            }
+            else
+            {
+                VariableNode = NewObject<UK2Node_VariableGet>(Graph);
+            }
+            VariableNode->VariableReference.SetSelfMember(FName(*VariableName));
+            FinishNode(Graph, VariableNode, Spec.Position);
+            return VariableNode;
+        }
+        if (Type == TEXT("self"))
+        {
+            return FSpirrowBridgeCommonUtils::CreateSelfReferenceNode(Graph, Spec.Position);
+        }
+        if (Type == TEXT("branch"))
+        {
+            UK2Node_IfThenElse* BranchNode = NewObject<UK2Node_IfThenElse>(Graph);
+            FinishNode(Graph, BranchNode, Spec.Position);
+            return BranchNode;
+        }
+        if (Type == TEXT("sequence"))
+        {
+            double NumOutputsDouble = 2.0;
+            Json->TryGetNumberField(TEXT("num_outputs"), NumOutputsDouble);
+            const int32 NumOutputs = FMath::Clamp(static_cast<int32>(NumOutputsDouble), 2, 10);
+
+            UK2Node_ExecutionSequence* SequenceNode = NewObject<UK2Node_ExecutionSequence>(Graph);
+            FinishNode(Graph, SequenceNode, Spec.Position);
+            for (int32 i = 2; i < NumOutputs; ++i)
+            {
+                SequenceNode->AddInputPin();
+            }
+            return SequenceNode;
+        }
+        if (Type == TEXT("delay") || Type == TEXT("print_string"))
+        {
+            const bool bDelay = Type == TEXT("delay");
+            UFunction* Function = FSpirrowBridgeNodeTemplateCache::Get().FindFunction(UKismetSystemLibrary::StaticClass(), bDelay ? TEXT("Delay") : TEXT("PrintString"));
+            UK2Node_CallFunction* Node = FSpirrowBridgeCommonUtils::CreateFunctionCallNode(Graph, Function, Spec.Position);
+            if (!Node)
+            {
+                OutError = FString::Printf(TEXT("Failed to create %s node"), *Spec.Type);
+                return nullptr;
+            }
+
+            if (bDelay)
+            {
+                SetShorthandFallback(Json, Node, TEXT("duration"), TEXT("Duration"), TEXT("1.0"));
+            }
+            else
+            {
+                SetShorthandFallback(Json, Node, TEXT("message"), TEXT("InString"), TEXT("Hello"));
+            }
+            return Node;
+        }
+        if (Type == TEXT("for_loop_with_break"))
+        {
+            UBlueprint* MacroLibrary = LoadObject<UBlueprint>(nullptr,
+                TEXT("/Engine/EditorBlueprintResources/StandardMacros.StandardMacros"));
+            UEdGraph* MacroGraph = nullptr;
+            if (MacroLibrary)
+            {
+                for (UEdGraph* Candidate : MacroLibrary->MacroGraphs)
+                {
+                    if (Candidate && Candidate->GetFName() == FName(TEXT("ForLoopWithBreak")))
+                    {
+                        MacroGraph = Candidate;
+                        break;
+                    }
+                }
+            }
+            if (!MacroGraph)
+            {
+                OutError = TEXT("Failed to find ForLoopWithBreak macro");
+                return nullptr;
+            }
+
+            UK2Node_MacroInstance* MacroNode = NewObject<UK2Node_MacroInstance>(Graph);
+            MacroNode->SetMacroGraph(MacroGraph);
+            FinishNode(Graph, MacroNode, Spec.Position);
+
+            SetShorthandFallback(Json, MacroNode, TEXT("first_index"), TEXT("FirstIndex"), TEXT("0"));
+            SetShorthandFallback(Json, MacroNode, TEXT("last_index"), TEXT("LastIndex"), TEXT("10"));
+            return MacroNode;
+        }
+        if (Type == TEXT("math") || Type == TEXT("comparison"))
+        {
+            FString Operation, ValueType = TEXT("Float");
+            Json->TryGetStringField(TEXT("operation"), Operation);
+            Json->TryGetStringField(TEXT("value_type"), ValueType);
+
+            const FString FunctionName = GetMathFunctionName(Operation, ValueType, Type == TEXT("comparison"));
+            UFunction* Function = FunctionName.IsEmpty() ? nullptr : FSpirrowBridgeNodeTemplateCache::Get().FindFunction(UKismetMathLibrary::StaticClass(), FunctionName);
+            if (!Function)
+            {
+                OutError = FString::Printf(TEXT("Unsupported %s operation/type: %s/%s"), *Spec.Type, *Operation, *ValueType);
+                return nullptr;
+            }
+            return FSpirrowBridgeCommonUtils::CreateFunctionCallNode(Graph, Function, Spec.Position);
+        }
+
+        OutError = FString::Printf(TEXT("Unknown node type '%s' (supported: %s)"), *Spec.Type, SupportedNodeTypes);
+        return nullptr;
+    }
+
+    bool IsClassPin(const UEdGraphPin* Pin)
+    {
+        const FName& Category = Pin->PinType.PinCategory;
+        return Category == UEdGraphSchema_K2::PC_Class || Category == UEdGraphSchema_K2::PC_SoftClass;
+    }
+
+    bool IsObjectPin(const UEdGraphPin* Pin)
+    {
+        const FName& Category = Pin->PinType.PinCategory;
+        return Category == UEdGraphSchema_K2::PC_Object || Category == UEdGraphSchema_K2::PC_SoftObject
+            || Category == UEdGraphSchema_K2::PC_Interface;
+    }
+
+    /** Asset path for object pins, class path or bare class name for class pins */
+    UObject* ResolvePinObject(const UEdGraphPin* Pin, const FString& StrVal)
+    {
+        UObject* Resolved = IsObjectPin(Pin) ? LoadObject<UObject>(nullptr, *StrVal) : nullptr;
+        if (!Resolved)
+        {
+            Resolved = FSpirrowBridgeCommonUtils::FindClassByNameAnywhere(StrVal);
+        }
+        return Resolved;
+    }
+
+    /** Split a "1,2,3" / "P=1,Y=2,R=3" struct default into its numbers */
+    TArray<double> ParseStructComponents(const FString& DefaultValue)
+    {
+        TArray<FString> Parts;
+        DefaultValue.ParseIntoArray(Parts, TEXT(","));
+        TArray<double> Components;
+        for (FString& Part : Parts)
+        {
+            int32 EqualsIndex;
+            if (Part.FindChar(TEXT('='), EqualsIndex))
+            {
+                Part.RightChopInline(EqualsIndex + 1);
+            }
+            Components.Add(FCString::Atod(*Part));
+        }
+        return Components;
+    }
+
+    /** Write a JSON value as a pin default, routing class/object pins through DefaultObject */
+    bool ApplyPinDefault(UEdGraphPin* Pin, const TSharedPtr<FJsonValue>& Value, FString& OutError)
+    {
+        const UEdGraphSchema_K2* K2Schema = GetDefault<UEdGraphSchema_K2>();
+        const FName& Category = Pin->PinType.PinCategory;
+
+        if (Value->Type == EJson::String)
+        {
+            const FString StrVal = Value->AsString();
+            if (IsClassPin(Pin) || IsObjectPin(Pin))
+            {
+                UObject* Resolved = ResolvePinObject(Pin, StrVal);
+                if (!Resolved)
+                {
+                    OutError = FString::Printf(TEXT("Could not resolve '%s' for pin '%s'"), *StrVal, *Pin->PinName.ToString());
+                    return false;
+                }
+                K2Schema->TrySetDefaultObject(*Pin, Resolved);
+                return true;
+            }
+
+            Pin->DefaultValue = StrVal;
+            return true;
+        }
+        if (Value->Type == EJson::Number)
+        {
+            Pin->DefaultValue = Category == UEdGraphSchema_K2::PC_Int
+                ? FString::FromInt(FMath::RoundToInt(Value->AsNumber()))
+                : FString::SanitizeFloat(Value->AsNumber());
+            return true;
+        }
+        if (Value->Type == EJson::Boolean)
+        {
+            Pin->DefaultValue = Value->AsBool() ? TEXT("true") : TEXT("false");
+            return true;
+        }
+        if (Value->Type == EJson::Array)
+        {
+            const TArray<TSharedPtr<FJsonValue>>& Array = Value->AsArray();
+            if (Array.Num() == 3 && Category == UEdGraphSchema_K2::PC_Struct)
+            {
+                const bool bRotator = Pin->PinType.PinSubCategoryObject == TBaseStructure<FRotator>::Get();
+                Pin->DefaultValue = FString::Printf(bRotator ? TEXT("P=%f,Y=%f,R=%f") : TEXT("%f,%f,%f"),
+                    Array[0]->AsNumber(), Array[1]->AsNumber(), Array[2]->AsNumber());
+                return true;
+            }
+        }
+
+        OutError = FString::Printf(TEXT("Unsupported value for pin '%s'"), *Pin->PinName.ToString());
+        return false;
+    }
+
+    /** True when the pin already holds the value ApplyPinDefault would write */
+    bool PinDefaultMatches(const UEdGraphPin* Pin, const TSharedPtr<FJsonValue>& Value)
+    {
+        switch (Value->Type)
+        {
+            case EJson::String:
+                if (IsClassPin(Pin) || IsObjectPin(Pin))
+                {
+                    return Pin->DefaultObject == ResolvePinObject(Pin, Value->AsString());
+                }
+                return Pin->DefaultValue == Value->AsString();
+            case EJson::Number:
+                return !Pin->DefaultValue.IsEmpty() && FMath::IsNearlyEqual(FCString::Atod(*Pin->DefaultValue), Value->AsNumber());
+            case EJson::Boolean:
+                return Pin->DefaultValue.ToBool() == Value->AsBool();
+            case EJson::Array:
+            {
+                const TArray<TSharedPtr<FJsonValue>>& Array = Value->AsArray();
+                const TArray<double> Current = ParseStructComponents(Pin->DefaultValue);
+                if (Current.Num() != Array.Num())
+                {
+                    return false;
+                }
+                for (int32 i = 0; i < Array.Num(); ++i)
+                {
+                    if (!FMath::IsNearlyEqual(Current[i], Array[i]->AsNumber(), 1e-4))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            default:
+                return false;
+        }
+    }
+
+    FString DescribePinDefault(const UEdGraphPin* Pin)
+    {
+        return Pin->DefaultObject ? Pin->DefaultObject->GetPathName() : Pin->DefaultValue;
+    }
+
+    /** Link two pins following the schema's connection response (breaks, conversions) */
+    bool ConnectPins(UEdGraphPin* SourcePin, UEdGraphPin* TargetPin, FString& OutError)
+    {
+        const UEdGraphSchema* Schema = SourcePin->GetSchema();
+        const FPinConnectionResponse Response = Schema->CanCreateConnection(SourcePin, TargetPin);
+
+        switch (Response.Response)
+        {
+            case CONNECT_RESPONSE_MAKE:
+                break;
+            case CONNECT_RESPONSE_BREAK_OTHERS_A:
+                SourcePin->BreakAllPinLinks(true);
+                break;
+            case CONNECT_RESPONSE_BREAK_OTHERS_B:
+                TargetPin->BreakAllPinLinks(true);
+                break;
+            case CONNECT_RESPONSE_BREAK_OTHERS_AB:
+                SourcePin->BreakAllPinLinks(true);
+                TargetPin->BreakAllPinLinks(true);
+                break;
+            case CONNECT_RESPONSE_MAKE_WITH_CONVERSION_NODE:
+            case CONNECT_RESPONSE_MAKE_WITH_PROMOTION:
+                // Needs an extra node; let the schema build it
+                if (Schema->TryCreateConnection(SourcePin, TargetPin))
+                {
+                    return true;
+                }
+                OutError = Response.Message.ToString();
+                return false;
+            default:
+                OutError = Response.Message.IsEmpty() ? TEXT("Connection not allowed") : Response.Message.ToString();
+                return false;
+        }
+
+        SourcePin->MakeLinkTo(TargetPin);
+        SourcePin->GetOwningNode()->PinConnectionListChanged(SourcePin);
+        TargetPin->GetOwningNode()->PinConnectionListChanged(TargetPin);
+        return true;
+    }
+
+    /**
+     * Undo record for apply / patch. Nodes that existed before the command are
+     * snapshotted (pin defaults, links, position) the first time they are about
+     * to be touched; Restore removes every node added since Begin and puts the
+     * snapshots back. Pins are looked up by name on restore because setting a
+     * class default can reconstruct a node and replace its pins.
+     */
+    class FGraphRollback
+    {
+    public:
+        explicit FGraphRollback(UEdGraph* InGraph)
+            : Graph(InGraph)
+        {
+            for (UEdGraphNode* Node : Graph->Nodes)
+            {
+                NodesBefore.Add(Node);
+            }
+        }
+
+        void SnapshotNode(UEdGraphNode* Node)
+        {
+            if (!Node || !NodesBefore.Contains(Node) || Snapshots.Contains(Node))
+            {
+                return;
+            }
+
+            FNodeSnapshot& Snapshot = Snapshots.Add(Node);
+            Snapshot.Position = FIntPoint(Node->NodePosX, Node->NodePosY);
+            for (const UEdGraphPin* Pin : Node->Pins)
+            {
+                if (!Pin)
+                {
+                    continue;
+                }
+                FPinSnapshot& PinSnapshot = Snapshot.Pins.AddDefaulted_GetRef();
+                PinSnapshot.Name = Pin->PinName;
+                PinSnapshot.Direction = Pin->Direction;
+                PinSnapshot.DefaultValue = Pin->DefaultValue;
+                PinSnapshot.DefaultObject = Pin->DefaultObject;
+                PinSnapshot.DefaultTextValue = Pin->DefaultTextValue;
+                for (const UEdGraphPin* Linked : Pin->LinkedTo)
+                {
+                    if (Linked)
+                    {
+                        PinSnapshot.Links.Add({ Linked->GetOwningNode(), Linked->PinName, Linked->Direction });
+                    }
+                }
+            }
+        }
+
+        /** Snapshot the pin's node and every node a break on the pin could unlink */
+        void SnapshotLinks(UEdGraphPin* Pin)
+        {
+            SnapshotNode(Pin->GetOwningNode());
+            for (UEdGraphPin* Linked : Pin->LinkedTo)
+            {
+                if (Linked)
+                {
+                    SnapshotNode(Linked->GetOwningNode());
+                }
+            }
+        }
+
+        void SnapshotForConnect(UEdGraphPin* SourcePin, UEdGraphPin* TargetPin)
+        {
+            SnapshotLinks(SourcePin);
+            SnapshotLinks(TargetPin);
+        }
+
+        void Restore()
+        {
+            // Nodes created by the command, including conversion nodes the schema added
+            for (UEdGraphNode* Node : TArray<UEdGraphNode*>(Graph->Nodes))
+            {
+                if (Node && !NodesBefore.Contains(Node))
+                {
+                    Node->BreakAllNodeLinks();
+                    Graph->RemoveNode(Node);
+                }
+            }
+
+            const UEdGraphSchema_K2* K2Schema = GetDefault<UEdGraphSchema_K2>();
+            for (TPair<UEdGraphNode*, FNodeSnapshot>& Pair : Snapshots)
+            {
+                UEdGraphNode* Node = Pair.Key;
+                Node->NodePosX = Pair.Value.Position.X;
+                Node->NodePosY = Pair.Value.Position.Y;
+                for (const FPinSnapshot& PinSnapshot : Pair.Value.Pins)
+                {
+                    UEdGraphPin* Pin = Node->FindPin(PinSnapshot.Name, PinSnapshot.Direction);
+                    if (!Pin)
+                    {
+                        continue;
+                    }
+                    if (Pin->DefaultObject != PinSnapshot.DefaultObject)
+                    {
+                        // Goes through the schema so class pins rebuild the node's outputs
+                        K2Schema->TrySetDefaultObject(*Pin, PinSnapshot.DefaultObject);
+                        Pin = Node->FindPin(PinSnapshot.Name, PinSnapshot.Direction);
+                        if (!Pin)
+                        {
+                            continue;
+                        }
+                    }
+                    Pin->DefaultValue = PinSnapshot.DefaultValue;
+                    Pin->DefaultTextValue = PinSnapshot.DefaultTextValue;
+                }
+            }
+
+            // Break everything first so links between two snapshotted nodes are restored once
+            for (TPair<UEdGraphNode*, FNodeSnapshot>& Pair : Snapshots)
+            {
+                for (const FPinSnapshot& PinSnapshot : Pair.Value.Pins)
+                {
+                    if (UEdGraphPin* Pin = Pair.Key->FindPin(PinSnapshot.Name, PinSnapshot.Direction))
+                    {
+                        Pin->BreakAllPinLinks();
+                    }
+                }
+            }
+            for (TPair<UEdGraphNode*, FNodeSnapshot>& Pair : Snapshots)
+            {
+                for (const FPinSnapshot& PinSnapshot : Pair.Value.Pins)
+                {
+                    UEdGraphPin* Pin = Pair.Key->FindPin(PinSnapshot.Name, PinSnapshot.Direction);
+                    if (!Pin)
+                    {
+                        continue;
+                    }
+                    for (const FLinkSnapshot& Link : PinSnapshot.Links)
+                    {
+                        if (UEdGraphPin* Other = Link.Node ? Link.Node->FindPin(Link.PinName, Link.Direction) : nullptr)
+                        {
+                            Pin->MakeLinkTo(Other);
+                        }
+                    }
+                }
+                Pair.Key->NodeConnectionListChanged();
+            }
+        }
+
+    private:
+        struct FLinkSnapshot
+        {
+            UEdGraphNode* Node = nullptr;
+            FName PinName;
+            EEdGraphPinDirection Direction = EGPD_Input;
+        };
+
+        struct FPinSnapshot
+        {
+            FName Name;
+            EEdGraphPinDirection Direction = EGPD_Input;
+            FString DefaultValue;
+            UObject* DefaultObject = nullptr;
+            FText DefaultTextValue;
+            TArray<FLinkSnapshot> Links;
+        };
+
+        struct FNodeSnapshot
+        {
+            FIntPoint Position = FIntPoint::ZeroValue;
+            TArray<FPinSnapshot> Pins;
+        };
+
+        UEdGraph* Graph = nullptr;
+        TSet<UEdGraphNode*> NodesBefore;
+        TMap<UEdGraphNode*, FNodeSnapshot> Snapshots;
+    };
+
+    UEdGraph* FindGraphByName(UBlueprint* Blueprint, const FString& GraphName)
+    {
+        if (GraphName.IsEmpty() || GraphName.Equals(TEXT("EventGraph"), ESearchCase::IgnoreCase))
+        {
+            return FSpirrowBridgeCommonUtils::FindOrCreateEventGraph(Blueprint);
+        }
+
+        TArray<UEdGraph*> Graphs;
+        Blueprint->GetAllGraphs(Graphs);
+        for (UEdGraph* Graph : Graphs)
+        {
+            if (Graph && Graph->GetName().Equals(GraphName, ESearchCase::IgnoreCase))
+            {
+                return Graph;
+            }
+        }
+        return nullptr;
+    }
+
+    /** Pin defaults requested by a spec: type shorthands first, then params / pin_values */
+    TArray<TPair<FString, TSharedPtr<FJsonValue>>> GetSpecPinValues(const FGraphNodeSpec& Spec)
+    {
+        TArray<TPair<FString, TSharedPtr<FJsonValue>>> PinValues;
+        auto AddShorthand = [&](const TCHAR* FieldName, const TCHAR* PinName)
+        {
+            if (TSharedPtr<FJsonValue> Value = Spec.Json->TryGetField(FieldName))
+            {
+                PinValues.Emplace(PinName, Value);
+            }
+        };
+
+        const FString Type = Spec.Type.ToLower();
+        if (Type == TEXT("delay"))
+        {
+            AddShorthand(TEXT("duration"), TEXT("Duration"));
+        }
+        else if (Type == TEXT("print_string"))
+        {
+            AddShorthand(TEXT("message"), TEXT("InString"));
+        }
+        else if (Type == TEXT("for_loop_with_break"))
+        {
+            AddShorthand(TEXT("first_index"), TEXT("FirstIndex"));
+            AddShorthand(TEXT("last_index"), TEXT("LastIndex"));
+        }
+
+        for (const TCHAR* FieldName : { TEXT("params"), TEXT("pin_values") })
+        {
+            const TSharedPtr<FJsonObject>* Values = nullptr;
+            if (Spec.Json->TryGetObjectField(FieldName, Values))
+            {
+                for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Values)->Values)
+                {
+                    PinValues.Emplace(Pair.Key, Pair.Value);
+                }
+            }
+        }
+        return PinValues;
+    }
+
+    FString GetFunctionKey(const UFunction* Function)
+    {
+        // Skeleton and generated classes of the same Blueprint must produce the same key
+        const UClass* Owner = Function->GetOwnerClass();
+        return FString::Printf(TEXT("function:%s.%s"),
+            Owner ? *Owner->GetAuthoritativeClass()->GetName() : TEXT(""), *Function->GetName());
+    }
+
+    /** Identity of a live node used to match it against a spec when no GUID is given */
+    FString GetNodeSemanticKey(const UEdGraphNode* Node)
+    {
+        if (const UK2Node_CustomEvent* CustomEvent = Cast<UK2Node_CustomEvent>(Node))
+        {
+            return TEXT("custom_event:") + CustomEvent->CustomFunctionName.ToString();
+        }
+        if (const UK2Node_Event* Event = Cast<UK2Node_Event>(Node))
+        {
+            return TEXT("event:") + Event->EventReference.GetMemberName().ToString();
+        }
+        if (const UK2Node_CallFunction* Call = Cast<UK2Node_CallFunction>(Node))
+        {
+            if (const UFunction* Function = Call->GetTargetFunction())
+            {
+                return GetFunctionKey(Function);
+            }
+            return TEXT("function:.") + Call->FunctionReference.GetMemberName().ToString();
+        }
+        if (const UK2Node_VariableSet* VariableSet = Cast<UK2Node_VariableSet>(Node))
+        {
+            return TEXT("variable_set:") + VariableSet->VariableReference.GetMemberName().ToString();
+        }
+        if (const UK2Node_VariableGet* VariableGet = Cast<UK2Node_VariableGet>(Node))
+        {
+            return TEXT("variable_get:") + VariableGet->VariableReference.GetMemberName().ToString();
+        }
+        if (const UK2Node_MacroInstance* Macro = Cast<UK2Node_MacroInstance>(Node))
+        {
+            const UEdGraph* MacroGraph = Macro->GetMacroGraph();
+            return TEXT("macro:") + (MacroGraph ? MacroGraph->GetName() : FString());
+        }
+        if (Node->IsA<UK2Node_Self>())
+        {
+            return TEXT("self");
+        }
+        if (Node->IsA<UK2Node_IfThenElse>())
+        {
+            return TEXT("branch");
+        }
+        if (Node->IsA<UK2Node_ExecutionSequence>())
+        {
+            return TEXT("sequence");
+        }
+        return TEXT("class:") + Node->GetClass()->GetName();
+    }
+
+    /** Same key as GetNodeSemanticKey would give the node CreateNodeFromSpec builds */
+    bool GetSpecSemanticKey(UBlueprint* Blueprint, const FGraphNodeSpec& Spec, FString& OutKey, FString& OutError)
+    {
+        const TSharedPtr<FJsonObject>& Json = Spec.Json;
+        const FString Type = Spec.Type.ToLower();
+        auto RequireField = [&](const TCHAR* FieldName, FString& OutValue)
+        {
+            Json->TryGetStringField(FieldName, OutValue);
+            if (OutValue.IsEmpty())
+            {
+                OutError = FString::Printf(TEXT("'%s' node requires %s"), *Spec.Type, FieldName);
+                return false;
+            }
+            return true;
+        };
+
+        FString Name;
+        if (Type == TEXT("event") || Type == TEXT("custom_event"))
+        {
+            if (!RequireField(TEXT("event_name"), Name))
+            {
+                return false;
+            }
+            OutKey = Type + TEXT(":") + Name;
+            return true;
+        }
+        if (Type == TEXT("variable_get") || Type == TEXT("variable_set"))
+        {
+            if (!RequireField(TEXT("variable_name"), Name))
+            {
+                return false;
+            }
+            OutKey = Type + TEXT(":") + Name;
+            return true;
+        }
+        if (Type == TEXT("component"))
+        {
+            if (!RequireField(TEXT("component_name"), Name))
+            {
+                return false;
+            }
+            OutKey = TEXT("variable_get:") + Name;
+            return true;
+        }
+        if (Type == TEXT("self") || Type == TEXT("branch") || Type == TEXT("sequence"))
+        {
+            OutKey = Type;
+            return true;
+        }
+        if (Type == TEXT("for_loop_with_break"))
+        {
+            OutKey = TEXT("macro:ForLoopWithBreak");
+            return true;
+        }
+
+        UFunction* Function = nullptr;
+        if (Type == TEXT("function"))
+        {
+            FString Target;
+            if (!RequireField(TEXT("function_name"), Name))
+            {
+                return false;
+            }
+            Json->TryGetStringField(TEXT("target"), Target);
+            Function = FindCallableFunction(Blueprint, Name, Target);
+        }
+        else if (Type == TEXT("delay") || Type == TEXT("print_string"))
+        {
+            Function = FSpirrowBridgeNodeTemplateCache::Get().FindFunction(UKismetSystemLibrary::StaticClass(), Type == TEXT("delay") ? TEXT("Delay") : TEXT("PrintString"));
+        }
+        else if (Type == TEXT("math") || Type == TEXT("comparison"))
+        {
+            FString Operation, ValueType = TEXT("Float");
+            Json->TryGetStringField(TEXT("operation"), Operation);
+            Json->TryGetStringField(TEXT("value_type"), ValueType);
+            const FString FunctionName = GetMathFunctionName(Operation, ValueType, Type == TEXT("comparison"));
+            Function = FunctionName.IsEmpty() ? nullptr : FSpirrowBridgeNodeTemplateCache::Get().FindFunction(UKismetMathLibrary::StaticClass(), FunctionName);
+        }
+        else
+        {
+            OutError = FString::Printf(TEXT("Unknown node type '%s' (supported: %s)"), *Spec.Type, SupportedNodeTypes);
+            return false;
+        }
+
+        if (!Function)
+        {
+            OutError = FString::Printf(TEXT("Could not resolve function for '%s' node"), *Spec.Type);
+            return false;
+        }
+        OutKey = GetFunctionKey(Function);
+        return true;
+    }
+
+    /** Parse the nodes / edges arrays shared by apply, diff and patch */
+    TSharedPtr<FJsonObject> ParseGraphSpec(const TSharedPtr<FJsonObject>& Params, TArray<FGraphNodeSpec>& OutNodes, TArray<FGraphEdgeSpec>& OutEdges)
+    {
+        const TArray<TSharedPtr<FJsonValue>>* NodesJson = nullptr;
+        if (!Params->TryGetArrayField(TEXT("nodes"), NodesJson))
+        {
+            return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                ESpirrowErrorCode::MissingRequiredParam,
+                TEXT("Missing 'nodes' parameter"));
+        }
+
+        TSet<FString> TempIds;
+        for (int32 Index = 0; Index < NodesJson->Num(); ++Index)
+        {
+            const TSharedPtr<FJsonObject>* NodeObj = nullptr;
+            if (!(*NodesJson)[Index]->TryGetObject(NodeObj))
+            {
+                return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                    ESpirrowErrorCode::InvalidParamValue,
+                    FString::Printf(TEXT("nodes[%d] must be an object"), Index));
+            }
+
+            FGraphNodeSpec& Spec = OutNodes.AddDefaulted_GetRef();
+            Spec.Json = *NodeObj;
+            (*NodeObj)->TryGetStringField(TEXT("id"), Spec.TempId);
+            (*NodeObj)->TryGetStringField(TEXT("type"), Spec.Type);
+            if (Spec.TempId.IsEmpty() || Spec.Type.IsEmpty())
+            {
+                return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                    ESpirrowErrorCode::InvalidParamValue,
+                    FString::Printf(TEXT("nodes[%d] requires 'id' and 'type'"), Index));
+            }
+            if (TempIds.Contains(Spec.TempId))
+            {
+                return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                    ESpirrowErrorCode::InvalidParamValue,
+                    FString::Printf(TEXT("Duplicate node id: %s"), *Spec.TempId));
+            }
+            TempIds.Add(Spec.TempId);
+
+            if ((*NodeObj)->HasField(TEXT("position")))
+            {
+                Spec.Position = FSpirrowBridgeCommonUtils::GetVector2DFromJson(*NodeObj, TEXT("position"));
+                Spec.bHasPosition = true;
+            }
+        }
+
+        const TArray<TSharedPtr<FJsonValue>>* EdgesJson = nullptr;
+        if (!Params->TryGetArrayField(TEXT("edges"), EdgesJson))
+        {
+            return nullptr;
+        }
+        for (int32 Index = 0; Index < EdgesJson->Num(); ++Index)
+        {
+            const TSharedPtr<FJsonObject>* EdgeObj = nullptr;
+            FGraphEdgeSpec Edge;
+            if ((*EdgesJson)[Index]->TryGetObject(EdgeObj))
+            {
+                (*EdgeObj)->TryGetStringField(TEXT("source"), Edge.Source);
+                (*EdgeObj)->TryGetStringField(TEXT("source_pin"), Edge.SourcePin);
+                (*EdgeObj)->TryGetStringField(TEXT("target"), Edge.Target);
+                (*EdgeObj)->TryGetStringField(TEXT("target_pin"), Edge.TargetPin);
+            }
+            if (Edge.Source.IsEmpty() || Edge.SourcePin.IsEmpty() || Edge.Target.IsEmpty() || Edge.TargetPin.IsEmpty())
+            {
+                return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                    ESpirrowErrorCode::InvalidParamValue,
+                    FString::Printf(TEXT("edges[%d] requires source, source_pin, target and target_pin"), Index));
+            }
+            OutEdges.Add(MoveTemp(Edge));
+        }
+        return nullptr;
+    }
+
+    TSharedPtr<FJsonObject> MakeGraphError(const FString& Where, const FString& Message)
+    {
+        TSharedPtr<FJsonObject> ErrorObj = MakeShared<FJsonObject>();
+        ErrorObj->SetStringField(TEXT("at"), Where);
+        ErrorObj->SetStringField(TEXT("error"), Message);
+        return ErrorObj;
+    }
+
+    /**
+     * Marks ResultObj as a rejected batch. success stays true because the response
+     * wrapper drops everything but the message on failure; applied=false is the signal.
+     */
+    TSharedPtr<FJsonObject> MakeNotAppliedResult(TSharedPtr<FJsonObject> ResultObj, const UEdGraph* Graph,
+        const TArray<TSharedPtr<FJsonValue>>& Errors)
+    {
+        ResultObj->SetBoolField(TEXT("success"), true);
+        ResultObj->SetBoolField(TEXT("applied"), false);
+        ResultObj->SetStringField(TEXT("graph"), Graph->GetName());
+        ResultObj->SetNumberField(TEXT("failed_count"), Errors.Num());
+        ResultObj->SetArrayField(TEXT("errors"), Errors);
+        return ResultObj;
+    }
+
+    enum class EAutoLayout : uint8
+    {
+        None,
+        /** Only nodes created by the command, placed below the existing content */
+        New,
+        /** Every node of the graph */
+        All
+    };
+
+    /** auto_layout: true / "new" / "all" (false or absent = keep spec positions) */
+    EAutoLayout GetAutoLayoutMode(const TSharedPtr<FJsonObject>& Params)
+    {
+        bool bAutoLayout = false;
+        if (Params->TryGetBoolField(TEXT("auto_layout"), bAutoLayout))
+        {
+            return bAutoLayout ? EAutoLayout::New : EAutoLayout::None;
+        }
+        FString Mode;
+        if (Params->TryGetStringField(TEXT("auto_layout"), Mode))
+        {
+            if (Mode.Equals(TEXT("all"), ESearchCase::IgnoreCase))
+            {
+                return EAutoLayout::All;
+            }
+            if (Mode.Equals(TEXT("new"), ESearchCase::IgnoreCase) || Mode.Equals(TEXT("true"), ESearchCase::IgnoreCase))
+            {
+                return EAutoLayout::New;
+            }
+        }
+        return EAutoLayout::None;
+    }
+
+    TSharedPtr<FJsonObject> MakeLayoutJson(const FSpirrowBridgeGraphLayout::FResult& Layout)
+    {
+        TSharedPtr<FJsonObject> LayoutObj = MakeShared<FJsonObject>();
+        LayoutObj->SetNumberField(TEXT("nodes"), Layout.NumNodes);
+        LayoutObj->SetNumberField(TEXT("nodes_moved"), Layout.NumMoved);
+        LayoutObj->SetNumberField(TEXT("layers"), Layout.NumLayers);
+        LayoutObj->SetNumberField(TEXT("chains"), Layout.NumComponents);
+        LayoutObj->SetNumberField(TEXT("reversed_edges"), Layout.NumReversedEdges);
+        LayoutObj->SetNumberField(TEXT("width"), Layout.Size.X);
+        LayoutObj->SetNumberField(TEXT("height"), Layout.Size.Y);
+        LayoutObj->SetNumberField(TEXT("time_ms"), Layout.TimeMs);
+        return LayoutObj;
+    }
+
+    void RunAutoLayout(UEdGraph* Graph, EAutoLayout Mode, const TArray<UEdGraphNode*>& NewNodes, const TSharedPtr<FJsonObject>& ResultObj)
+    {
+        FSpirrowBridgeGraphLayout::FSettings Settings;
+        TArray<UEdGraphNode*> Nodes;
+        if (Mode == EAutoLayout::All)
+        {
+            Nodes = Graph->Nodes;
+        }
+        else
+        {
+            Nodes = NewNodes;
+
+            // Keep clear of nodes that were already there
+            bool bHasExisting = false;
+            FIntPoint Min(MAX_int32, MAX_int32);
+            int32 Bottom = MIN_int32;
+            for (const UEdGraphNode* Node : Graph->Nodes)
+            {
+                if (Node && !NewNodes.Contains(Node))
+                {
+                    bHasExisting = true;
+                    Min.X = FMath::Min(Min.X, Node->NodePosX);
+                    Bottom = FMath::Max(Bottom, Node->NodePosY + FSpirrowBridgeGraphLayout::EstimateNodeSize(Node).Y);
+                }
+            }
+            if (bHasExisting)
+            {
+                Settings.bUseOrigin = true;
+                Settings.Origin = FIntPoint(Min.X, Bottom + Settings.ComponentSpacing);
+            }
+        }
+
+        ResultObj->SetObjectField(TEXT("layout"), MakeLayoutJson(FSpirrowBridgeGraphLayout::Layout(Nodes, Settings)));
+    }
+
+    /** Full compile with the results written into ResultObj (compiled, compile_errors) */
+    void CompileAndReport(UBlueprint* Blueprint, const TSharedPtr<FJsonObject>& ResultObj)
+    {
+        FCompilerResultsLog CompileLog;
+        FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::SkipGarbageCollection, &CompileLog);
+
+        TArray<TSharedPtr<FJsonValue>> CompileErrors;
+        for (const TSharedRef<FTokenizedMessage>& Message : CompileLog.Messages)
+        {
+            if (Message->GetSeverity() == EMessageSeverity::Error)
+            {
+                CompileErrors.Add(MakeShared<FJsonValueString>(Message->ToText().ToString()));
+            }
+        }
+        ResultObj->SetBoolField(TEXT("compiled"), Blueprint->Status != BS_Error);
+        if (CompileErrors.Num() > 0)
+        {
+            ResultObj->SetArrayField(TEXT("compile_errors"), CompileErrors);
+        }
+    }
+
+    struct FGraphDiff
+    {
+        /** Pins are kept by name: applying a class default can reconstruct the node */
+        struct FPinChange
+        {
+            FString NodeId;
+            UEdGraphNode* Node = nullptr;
+            FName PinName;
+            TSharedPtr<FJsonValue> Value;
+        };
+
+        struct FNodeMove
+        {
+            FString NodeId;
+            UEdGraphNode* Node = nullptr;
+            FVector2D To = FVector2D::ZeroVector;
+        };
+
+        /** Spec id (or GUID used as an edge endpoint) -> live node */
+        TMap<FString, UEdGraphNode*> Matched;
+        TArray<const FGraphNodeSpec*> Added;
+        TArray<UEdGraphNode*> Removed;
+        TArray<FPinChange> PinChanges;
+        TArray<FNodeMove> Moves;
+        TArray<const FGraphEdgeSpec*> AddedEdges;
+        TArray<TPair<UEdGraphPin*, UEdGraphPin*>> RemovedLinks;
+        int32 UnchangedLinks = 0;
+        TArray<TSharedPtr<FJsonValue>> Errors;
+
+        bool IsStructural() const
+        {
+            return Added.Num() > 0 || Removed.Num() > 0 || AddedEdges.Num() > 0 || RemovedLinks.Num() > 0;
+        }
+
+        bool HasChanges() const
+        {
+            return IsStructural() || PinChanges.Num() > 0 || Moves.Num() > 0;
+        }
+    };
+
+    /**
+     * Match the desired description against the live graph and collect the delta.
+     * Nodes are matched by explicit "guid" first, then by semantic key (nearest
+     * position wins among same-key candidates). Comment nodes are never touched.
+     */
+    void ComputeGraphDiff(UBlueprint* Blueprint, UEdGraph* Graph, const TArray<FGraphNodeSpec>& Specs,
+        const TArray<FGraphEdgeSpec>& Edges, bool bRemoveUnmatched, FGraphDiff& OutDiff)
+    {
+        auto AddError = [&OutDiff](const FString& Where, const FString& Message)
+        {
+            OutDiff.Errors.Add(MakeShared<FJsonValueObject>(MakeGraphError(Where, Message)));
+        };
+
+        FSpirrowBridgeNodeIndex& NodeIndex = FSpirrowBridgeNodeIndex::Get();
+        auto FindLiveByGuid = [&](const FString& Id) -> UEdGraphNode*
+        {
+            FGuid Guid;
+            if (!FGuid::Parse(Id, Guid))
+            {
+                return nullptr;
+            }
+            UEdGraphNode* Node = NodeIndex.FindNode(Blueprint, Guid);
+            return Node && Node->GetGraph() == Graph ? Node : nullptr;
+        };
+
+        TMap<FString, TArray<UEdGraphNode*>> LiveByKey;
+        for (UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (Node && !Node->IsA<UEdGraphNode_Comment>())
+            {
+                LiveByKey.FindOrAdd(GetNodeSemanticKey(Node)).Add(Node);
+            }
+        }
+
+        // Explicit GUIDs claim their nodes before any semantic matching. Described
+        // holds nodes a spec stands for; Claimed also has GUID-only edge endpoints.
+        TSet<UEdGraphNode*> Claimed;
+        TSet<UEdGraphNode*> Described;
+        TArray<const FGraphNodeSpec*> ByKey;
+        for (const FGraphNodeSpec& Spec : Specs)
+        {
+            FString GuidString;
+            if (!Spec.Json->TryGetStringField(TEXT("guid"), GuidString))
+            {
+                ByKey.Add(&Spec);
+                continue;
+            }
+
+            UEdGraphNode* Node = FindLiveByGuid(GuidString);
+            if (!Node)
+            {
+                AddError(Spec.TempId, FString::Printf(TEXT("Node not found in graph: %s"), *GuidString));
+            }
+            else if (Claimed.Contains(Node))
+            {
+                AddError(Spec.TempId, FString::Printf(TEXT("Node %s is claimed by more than one spec"), *GuidString));
+            }
+            else
+            {
+                OutDiff.Matched.Add(Spec.TempId, Node);
+                Claimed.Add(Node);
+                Described.Add(Node);
+            }
+        }
+
+        TSet<FString> AddedIds;
+        for (const FGraphNodeSpec* Spec : ByKey)
+        {
+            FString Key, KeyError;
+            if (!GetSpecSemanticKey(Blueprint, *Spec, Key, KeyError))
+            {
+                AddError(Spec->TempId, KeyError);
+                continue;
+            }
+
+            UEdGraphNode* Best = nullptr;
+            double BestDistance = TNumericLimits<double>::Max();
+            if (const TArray<UEdGraphNode*>* Candidates = LiveByKey.Find(Key))
+            {
+                for (UEdGraphNode* Candidate : *Candidates)
+                {
+                    if (Claimed.Contains(Candidate))
+                    {
+                        continue;
+                    }
+                    const double Distance = Spec->bHasPosition
+                        ? FVector2D::DistSquared(Spec->Position, FVector2D(Candidate->NodePosX, Candidate->NodePosY))
+                        : 0.0;
+                    if (!Best || Distance < BestDistance)
+                    {
+                        Best = Candidate;
+                        BestDistance = Distance;
+                    }
+                }
+            }
+
+            if (Best)
+            {
+                OutDiff.Matched.Add(Spec->TempId, Best);
+                Claimed.Add(Best);
+                Described.Add(Best);
+            }
+            else
+            {
+                OutDiff.Added.Add(Spec);
+                AddedIds.Add(Spec->TempId);
+            }
+        }
+
+        // Position and pin default changes on matched nodes
+        for (const FGraphNodeSpec& Spec : Specs)
+        {
+            UEdGraphNode* Node = OutDiff.Matched.FindRef(Spec.TempId);
+            if (!Node)
+            {
+                continue;
+            }
+
+            if (Spec.bHasPosition && (Node->NodePosX != static_cast<int32>(Spec.Position.X) || Node->NodePosY != static_cast<int32>(Spec.Position.Y)))
+            {
+                OutDiff.Moves.Add({ Spec.TempId, Node, Spec.Position });
+            }
+
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& PinValue : GetSpecPinValues(Spec))
+            {
+                UEdGraphPin* Pin = FSpirrowBridgeCommonUtils::FindPin(Node, PinValue.Key, EGPD_Input);
+                if (!Pin)
+                {
+                    AddError(Spec.TempId + TEXT(".") + PinValue.Key, TEXT("Pin not found"));
+                }
+                else if (!PinDefaultMatches(Pin, PinValue.Value))
+                {
+                    OutDiff.PinChanges.Add({ Spec.TempId, Node, Pin->PinName, PinValue.Value });
+                }
+            }
+        }
+
+        // Edges: endpoints are spec ids or GUIDs of other live nodes, which are then kept
+        TSet<TPair<UEdGraphPin*, UEdGraphPin*>> KeptLinks;
+        for (const FGraphEdgeSpec& Edge : Edges)
+        {
+            const FString Where = FString::Printf(TEXT("%s.%s -> %s.%s"), *Edge.Source, *Edge.SourcePin, *Edge.Target, *Edge.TargetPin);
+            UEdGraphNode* Endpoints[2] = { nullptr, nullptr };
+            bool bUnknown = false;
+            const FString* Ids[2] = { &Edge.Source, &Edge.Target };
+            for (int32 Side = 0; Side < 2; ++Side)
+            {
+                if (AddedIds.Contains(*Ids[Side]))
+                {
+                    continue;
+                }
+                Endpoints[Side] = OutDiff.Matched.FindRef(*Ids[Side]);
+                if (!Endpoints[Side])
+                {
+                    Endpoints[Side] = FindLiveByGuid(*Ids[Side]);
+                    if (Endpoints[Side])
+                    {
+                        OutDiff.Matched.Add(*Ids[Side], Endpoints[Side]);
+                        Claimed.Add(Endpoints[Side]);
+                    }
+                }
+                bUnknown |= Endpoints[Side] == nullptr;
+            }
+            if (bUnknown)
+            {
+                AddError(Where, TEXT("Unknown node"));
+                continue;
+            }
+
+            UEdGraphPin* SourcePin = Endpoints[0] ? FSpirrowBridgeCommonUtils::FindPin(Endpoints[0], Edge.SourcePin, EGPD_Output) : nullptr;
+            UEdGraphPin* TargetPin = Endpoints[1] ? FSpirrowBridgeCommonUtils::FindPin(Endpoints[1], Edge.TargetPin, EGPD_Input) : nullptr;
+            if ((Endpoints[0] && !SourcePin) || (Endpoints[1] && !TargetPin))
+            {
+                AddError(Where, FString::Printf(TEXT("Pin not found: %s"), (Endpoints[0] && !SourcePin) ? *Edge.SourcePin : *Edge.TargetPin));
+                continue;
+            }
+
+            if (SourcePin && TargetPin && SourcePin->LinkedTo.Contains(TargetPin))
+            {
+                KeptLinks.Add(TPair<UEdGraphPin*, UEdGraphPin*>(SourcePin, TargetPin));
+                ++OutDiff.UnchangedLinks;
+            }
+            else
+            {
+                OutDiff.AddedEdges.Add(&Edge);
+            }
+        }
+
+        // Links between two described nodes that the description no longer has.
+        // An additive patch (remove_unmatched=false) never drops links.
+        if (bRemoveUnmatched)
+        {
+            for (UEdGraphNode* Node : Described)
+            {
+                for (UEdGraphPin* Pin : Node->Pins)
+                {
+                    if (!Pin || Pin->Direction != EGPD_Output)
+                    {
+                        continue;
+                    }
+                    for (UEdGraphPin* Linked : Pin->LinkedTo)
+                    {
+                        if (Linked && Described.Contains(Linked->GetOwningNode())
+                            && !KeptLinks.Contains(TPair<UEdGraphPin*, UEdGraphPin*>(Pin, Linked)))
+                        {
+                            OutDiff.RemovedLinks.Emplace(Pin, Linked);
+                        }
+                    }
+                }
+            }
+        }
+
+        if (bRemoveUnmatched)
+        {
+            for (const TPair<FString, TArray<UEdGraphNode*>>& Pair : LiveByKey)
+            {
+                for (UEdGraphNode* Node : Pair.Value)
+                {
+                    if (!Claimed.Contains(Node) && Node->CanUserDeleteNode())
+                    {
+                        OutDiff.Removed.Add(Node);
+                    }
+                }
+            }
+        }
+    }
+
+    FString GetNodeTitle(const UEdGraphNode* Node)
+    {
+        return Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
+    }
+
+    TSharedPtr<FJsonObject> MakeDiffJson(const FGraphDiff& Diff)
+    {
+        TSharedPtr<FJsonObject> DiffObj = MakeShared<FJsonObject>();
+
+        TArray<TSharedPtr<FJsonValue>> AddedArray;
+        for (const FGraphNodeSpec* Spec : Diff.Added)
+        {
+            TSharedPtr<FJsonObject> NodeObj = MakeShared<FJsonObject>();
+            NodeObj->SetStringField(TEXT("id"), Spec->TempId);
+            NodeObj->SetStringField(TEXT("type"), Spec->Type);
+            AddedArray.Add(MakeShared<FJsonValueObject>(NodeObj));
+        }
+
+        TArray<TSharedPtr<FJsonValue>> RemovedArray;
+        for (const UEdGraphNode* Node : Diff.Removed)
+        {
+            TSharedPtr<FJsonObject> NodeObj = MakeShared<FJsonObject>();
+            NodeObj->SetStringField(TEXT("guid"), Node->NodeGuid.ToString());
+            NodeObj->SetStringField(TEXT("title"), GetNodeTitle(Node));
+            NodeObj->SetStringField(TEXT("key"), GetNodeSemanticKey(Node));
+            RemovedArray.Add(MakeShared<FJsonValueObject>(NodeObj));
+        }
+
+        // Group pin changes and moves per node
+        TMap<FString, TSharedPtr<FJsonObject>> ChangedById;
+        auto GetChanged = [&](const FString& NodeId, const UEdGraphNode* Node) -> TSharedPtr<FJsonObject>&
+        {
+            TSharedPtr<FJsonObject>& NodeObj = ChangedById.FindOrAdd(NodeId);
+            if (!NodeObj.IsValid())
+            {
+                NodeObj = MakeShared<FJsonObject>();
+                NodeObj->SetStringField(TEXT("id"), NodeId);
+                NodeObj->SetStringField(TEXT("guid"), Node->NodeGuid.ToString());
+                NodeObj->SetArrayField(TEXT("pins"), {});
+            }
+            return NodeObj;
+        };
+        for (const FGraphDiff::FNodeMove& Move : Diff.Moves)
+        {
+            TSharedPtr<FJsonObject> PositionObj = MakeShared<FJsonObject>();
+            PositionObj->SetArrayField(TEXT("from"), { MakeShared<FJsonValueNumber>(Move.Node->NodePosX), MakeShared<FJsonValueNumber>(Move.Node->NodePosY) });
+            PositionObj->SetArrayField(TEXT("to"), { MakeShared<FJsonValueNumber>(Move.To.X), MakeShared<FJsonValueNumber>(Move.To.Y) });
+            GetChanged(Move.NodeId, Move.Node)->SetObjectField(TEXT("position"), PositionObj);
+        }
+        for (const FGraphDiff::FPinChange& Change : Diff.PinChanges)
+        {
+            TSharedPtr<FJsonObject> NodeObj = GetChanged(Change.NodeId, Change.Node);
+            TArray<TSharedPtr<FJsonValue>> Pins = NodeObj->GetArrayField(TEXT("pins"));
+
+            const UEdGraphPin* Pin = Change.Node->FindPin(Change.PinName, EGPD_Input);
+            TSharedPtr<FJsonObject> PinObj = MakeShared<FJsonObject>();
+            PinObj->SetStringField(TEXT("pin"), Change.PinName.ToString());
+            PinObj->SetStringField(TEXT("from"), Pin ? DescribePinDefault(Pin) : FString());
+            PinObj->SetField(TEXT("to"), Change.Value);
+            Pins.Add(MakeShared<FJsonValueObject>(PinObj));
+            NodeObj->SetArrayField(TEXT("pins"), Pins);
+        }
+        TArray<TSharedPtr<FJsonValue>> ChangedArray;
+        for (const TPair<FString, TSharedPtr<FJsonObject>>& Pair : ChangedById)
+        {
+            ChangedArray.Add(MakeShared<FJsonValueObject>(Pair.Value));
+        }
+
+        TSharedPtr<FJsonObject> MatchedObj = MakeShared<FJsonObject>();
+        for (const TPair<FString, UEdGraphNode*>& Pair : Diff.Matched)
+        {
+            MatchedObj->SetStringField(Pair.Key, Pair.Value->NodeGuid.ToString());
+        }
+
+        TArray<TSharedPtr<FJsonValue>> LinksAdded;
+        for (const FGraphEdgeSpec* Edge : Diff.AddedEdges)
+        {
+            TSharedPtr<FJsonObject> LinkObj = MakeShared<FJsonObject>();
+            LinkObj->SetStringField(TEXT("source"), Edge->Source);
+            LinkObj->SetStringField(TEXT("source_pin"), Edge->SourcePin);
+            LinkObj->SetStringField(TEXT("target"), Edge->Target);
+            LinkObj->SetStringField(TEXT("target_pin"), Edge->TargetPin);
+            LinksAdded.Add(MakeShared<FJsonValueObject>(LinkObj));
+        }
+        TArray<TSharedPtr<FJsonValue>> LinksRemoved;
+        for (const TPair<UEdGraphPin*, UEdGraphPin*>& Link : Diff.RemovedLinks)
+        {
+            TSharedPtr<FJsonObject> LinkObj = MakeShared<FJsonObject>();
+            LinkObj->SetStringField(TEXT("source"), Link.Key->GetOwningNode()->NodeGuid.ToString());
+            LinkObj->SetStringField(TEXT("source_pin"), Link.Key->PinName.ToString());
+            LinkObj->SetStringField(TEXT("target"), Link.Value->GetOwningNode()->NodeGuid.ToString());
+            LinkObj->SetStringField(TEXT("target_pin"), Link.Value->PinName.ToString());
+            LinksRemoved.Add(MakeShared<FJsonValueObject>(LinkObj));
+        }
+
+        TSharedPtr<FJsonObject> SummaryObj = MakeShared<FJsonObject>();
+        SummaryObj->SetNumberField(TEXT("nodes_added"), Diff.Added.Num());
+        SummaryObj->SetNumberField(TEXT("nodes_removed"), Diff.Removed.Num());
+        SummaryObj->SetNumberField(TEXT("nodes_changed"), ChangedById.Num());
+        SummaryObj->SetNumberField(TEXT("nodes_matched"), Diff.Matched.Num());
+        SummaryObj->SetNumberField(TEXT("links_added"), Diff.AddedEdges.Num());
+        SummaryObj->SetNumberField(TEXT("links_removed"), Diff.RemovedLinks.Num());
+        SummaryObj->SetNumberField(TEXT("links_unchanged"), Diff.UnchangedLinks);
+        SummaryObj->SetBoolField(TEXT("structural"), Diff.IsStructural());
+
+        TSharedPtr<FJsonObject> NodesObj = MakeShared<FJsonObject>();
+        NodesObj->SetArrayField(TEXT("added"), AddedArray);
+        NodesObj->SetArrayField(TEXT("removed"), RemovedArray);
+        NodesObj->SetArrayField(TEXT("changed"), ChangedArray);
+        NodesObj->SetObjectField(TEXT("matched"), MatchedObj);
+
+        TSharedPtr<FJsonObject> LinksObj = MakeShared<FJsonObject>();
+        LinksObj->SetArrayField(TEXT("added"), LinksAdded);
+        LinksObj->SetArrayField(TEXT("removed"), LinksRemoved);
+
+        DiffObj->SetObjectField(TEXT("summary"), SummaryObj);
+        DiffObj->SetObjectField(TEXT("nodes"), NodesObj);
+        DiffObj->SetObjectField(TEXT("links"), LinksObj);
+        return DiffObj;
+    }
+}
+
+FSpirrowBridgeBlueprintNodeGraphCommands::FSpirrowBridgeBlueprintNodeGraphCommands()
+{
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeGraphCommands::HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params)
+{
+    if (CommandType == TEXT("apply_blueprint_graph"))
+    {
+        return HandleApplyBlueprintGraph(Params);
+    }
+    if (CommandType == TEXT("diff_blueprint_graph"))
+    {
+        return HandleDiffBlueprintGraph(Params);
+    }
+    if (CommandType == TEXT("patch_blueprint_graph"))
+    {
+        return HandlePatchBlueprintGraph(Params);
+    }
+    if (CommandType == TEXT("auto_layout_blueprint_graph"))
+    {
+        return HandleAutoLayoutBlueprintGraph(Params);
+    }
+
+    return nullptr;
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeGraphCommands::HandleApplyBlueprintGraph(const TSharedPtr<FJsonObject>& Params)
+{
+    // Parse and validate the whole description before touching the graph
+    TArray<FGraphNodeSpec> NodeSpecs;
+    TArray<FGraphEdgeSpec> EdgeSpecs;
+    if (auto Error = ParseGraphSpec(Params, NodeSpecs, EdgeSpecs))
+    {
+        return Error;
+    }
+
+    FString GraphName;
+    bool bCompile = true;
+    bool bContinueOnError = false;
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("graph_name"), GraphName, TEXT(""));
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("compile"), bCompile, true);
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("continue_on_error"), bContinueOnError, false);
+    const EAutoLayout AutoLayout = GetAutoLayoutMode(Params);
+
+    // Resolve target Blueprint (regular BP or Level Blueprint via target_type)
+    UBlueprint* Blueprint = nullptr;
+    if (auto Error = FSpirrowBridgeCommonUtils::ResolveTargetBlueprint(Params, Blueprint))
+    {
+        return Error;
+    }
+
+    UEdGraph* Graph = FindGraphByName(Blueprint, GraphName);
+    if (!Graph)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::GraphNotFound,
+            FString::Printf(TEXT("Graph not found: %s"), *GraphName));
+    }
+
+    TArray<TSharedPtr<FJsonValue>> ErrorsArray;
+    auto AddError = [&ErrorsArray](const FString& Where, const FString& Message)
+    {
+        ErrorsArray.Add(MakeShared<FJsonValueObject>(MakeGraphError(Where, Message)));
+    };
+
+    // Everything below is undone through this record unless continue_on_error is set
+    FGraphRollback Rollback(Graph);
+
+    // Pass 1: nodes
+    TMap<FString, UEdGraphNode*> TempToNode;
+    TArray<UEdGraphNode*> CreatedNodes;
+    int32 ReusedCount = 0;
+    for (const FGraphNodeSpec& Spec : NodeSpecs)
+    {
+        bool bCreated = false;
+        FString NodeError;
+        UEdGraphNode* Node = CreateNodeFromSpec(Blueprint, Graph, Spec, bCreated, NodeError);
+        if (!Node)
+        {
+            AddError(Spec.TempId, NodeError.IsEmpty() ? TEXT("Node creation failed") : NodeError);
+            continue;
+        }
+
+        TempToNode.Add(Spec.TempId, Node);
+        if (bCreated)
+        {
+            CreatedNodes.Add(Node);
+        }
+        else
+        {
+            ++ReusedCount;
+        }
+    }
+
+    // Pass 2: pin defaults (before wiring so class pins narrow their outputs first)
+    for (const FGraphNodeSpec& Spec : NodeSpecs)
+    {
+        UEdGraphNode* Node = TempToNode.FindRef(Spec.TempId);
+        if (!Node)
+        {
+            continue;
+        }
+
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& PinValue : GetSpecPinValues(Spec))
+        {
+            UEdGraphPin* Pin = FSpirrowBridgeCommonUtils::FindPin(Node, PinValue.Key, EGPD_Input);
+            FString PinError;
+            if (!Pin)
+            {
+                AddError(Spec.TempId + TEXT(".") + PinValue.Key, TEXT("Pin not found"));
+                continue;
+            }
+
+            Rollback.SnapshotNode(Node);
+            if (!ApplyPinDefault(Pin, PinValue.Value, PinError))
+            {
+                AddError(Spec.TempId + TEXT(".") + PinValue.Key, PinError);
+            }
+        }
+    }
+
+    // Pass 3: edges. Endpoints may be temp ids or GUIDs of nodes already in the graph.
+    FSpirrowBridgeNodeIndex& NodeIndex = FSpirrowBridgeNodeIndex::Get();
+    auto ResolveEndpoint = [&](const FString& Id) -> UEdGraphNode*
+    {
+        if (UEdGraphNode* const* Found = TempToNode.Find(Id))
+        {
+            return *Found;
+        }
+        FGuid Guid;
+        if (FGuid::Parse(Id, Guid))
+        {
+            UEdGraphNode* Existing = NodeIndex.FindNode(Blueprint, Guid);
+            return Existing && Existing->GetGraph() == Graph ? Existing : nullptr;
+        }
+        return nullptr;
+    };
+
+    int32 ConnectionCount = 0;
+    for (const FGraphEdgeSpec& Edge : EdgeSpecs)
+    {
+        const FString Where = FString::Printf(TEXT("%s.%s -> %s.%s"), *Edge.Source, *Edge.SourcePin, *Edge.Target, *Edge.TargetPin);
+        UEdGraphNode* SourceNode = ResolveEndpoint(Edge.Source);
+        UEdGraphNode* TargetNode = ResolveEndpoint(Edge.Target);
+        if (!SourceNode || !TargetNode)
+        {
+            AddError(Where, FString::Printf(TEXT("Unknown node: %s"), SourceNode ? *Edge.Target : *Edge.Source));
+            continue;
+        }
+
+        UEdGraphPin* SourcePin = FSpirrowBridgeCommonUtils::FindPin(SourceNode, Edge.SourcePin, EGPD_Output);
+        UEdGraphPin* TargetPin = FSpirrowBridgeCommonUtils::FindPin(TargetNode, Edge.TargetPin, EGPD_Input);
+        if (!SourcePin || !TargetPin)
+        {
+            AddError(Where, FString::Printf(TEXT("Pin not found: %s"), SourcePin ? *Edge.TargetPin : *Edge.SourcePin));
+            continue;
+        }
+
+        FString ConnectError;
+        Rollback.SnapshotForConnect(SourcePin, TargetPin);
+        if (ConnectPins(SourcePin, TargetPin, ConnectError))
+        {
+            ++ConnectionCount;
+        }
+        else
+        {
+            AddError(Where, ConnectError);
+        }
+    }
+
+    // All-or-nothing unless the caller opted into partial application
+    if (ErrorsArray.Num() > 0 && !bContinueOnError)
+    {
+        Rollback.Restore();
+        return MakeNotAppliedResult(MakeShared<FJsonObject>(), Graph, ErrorsArray);
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    if (AutoLayout != EAutoLayout::None)
+    {
+        RunAutoLayout(Graph, AutoLayout, CreatedNodes, ResultObj);
+    }
+
+    // One structural modification and (optionally) one compile for the whole batch
+    FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+
+    if (bCompile)
+    {
+        CompileAndReport(Blueprint, ResultObj);
+    }
+
+    TSharedPtr<FJsonObject> NodeMap = MakeShared<FJsonObject>();
+    for (const TPair<FString, UEdGraphNode*>& Pair : TempToNode)
+    {
+        NodeMap->SetStringField(Pair.Key, Pair.Value->NodeGuid.ToString());
+    }
+
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetBoolField(TEXT("applied"), true);
+    ResultObj->SetStringField(TEXT("graph"), Graph->GetName());
+    ResultObj->SetObjectField(TEXT("node_map"), NodeMap);
+    ResultObj->SetNumberField(TEXT("nodes_created"), CreatedNodes.Num());
+    ResultObj->SetNumberField(TEXT("nodes_reused"), ReusedCount);
+    ResultObj->SetNumberField(TEXT("connections_made"), ConnectionCount);
+    if (ErrorsArray.Num() > 0)
+    {
+        ResultObj->SetNumberField(TEXT("failed_count"), ErrorsArray.Num());
+        ResultObj->SetArrayField(TEXT("errors"), ErrorsArray);
+    }
+
+    UE_LOG(LogSpirrowBridgeNodeGraph, Log, TEXT("apply_blueprint_graph: %s/%s created %d nodes, %d connections, %d errors"),
+        *Blueprint->GetName(), *Graph->GetName(), CreatedNodes.Num(), ConnectionCount, ErrorsArray.Num());
+
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeGraphCommands::HandleDiffBlueprintGraph(const TSharedPtr<FJsonObject>& Params)
+{
+    TArray<FGraphNodeSpec> NodeSpecs;
+    TArray<FGraphEdgeSpec> EdgeSpecs;
+    if (auto Error = ParseGraphSpec(Params, NodeSpecs, EdgeSpecs))
+    {
+        return Error;
+    }
+
+    FString GraphName;
+    bool bRemoveUnmatched = true;
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("graph_name"), GraphName, TEXT(""));
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("remove_unmatched"), bRemoveUnmatched, true);
+
+    UBlueprint* Blueprint = nullptr;
+    if (auto Error = FSpirrowBridgeCommonUtils::ResolveTargetBlueprint(Params, Blueprint))
+    {
+        return Error;
+    }
+
+    UEdGraph* Graph = FindGraphByName(Blueprint, GraphName);
+    if (!Graph)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::GraphNotFound,
+            FString::Printf(TEXT("Graph not found: %s"), *GraphName));
+    }
+
+    FGraphDiff Diff;
+    ComputeGraphDiff(Blueprint, Graph, NodeSpecs, EdgeSpecs, bRemoveUnmatched, Diff);
+
+    TSharedPtr<FJsonObject> ResultObj = MakeDiffJson(Diff);
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetStringField(TEXT("graph"), Graph->GetName());
+    ResultObj->SetBoolField(TEXT("has_changes"), Diff.HasChanges());
+    if (Diff.Errors.Num() > 0)
+    {
+        ResultObj->SetArrayField(TEXT("errors"), Diff.Errors);
+    }
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeGraphCommands::HandlePatchBlueprintGraph(const TSharedPtr<FJsonObject>& Params)
+{
+    TArray<FGraphNodeSpec> NodeSpecs;
+    TArray<FGraphEdgeSpec> EdgeSpecs;
+    if (auto Error = ParseGraphSpec(Params, NodeSpecs, EdgeSpecs))
+    {
+        return Error;
+    }
+
+    FString GraphName;
+    bool bRemoveUnmatched = true;
+    bool bCompile = true;
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("graph_name"), GraphName, TEXT(""));
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("remove_unmatched"), bRemoveUnmatched, true);
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("compile"), bCompile, true);
+    const EAutoLayout AutoLayout = GetAutoLayoutMode(Params);
+
+    UBlueprint* Blueprint = nullptr;
+    if (auto Error = FSpirrowBridgeCommonUtils::ResolveTargetBlueprint(Params, Blueprint))
+    {
+        return Error;
+    }
+
+    UEdGraph* Graph = FindGraphByName(Blueprint, GraphName);
+    if (!Graph)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::GraphNotFound,
+            FString::Printf(TEXT("Graph not found: %s"), *GraphName));
+    }
+
+    // Everything that can be checked without mutating is checked by the diff
+    FGraphDiff Diff;
+    ComputeGraphDiff(Blueprint, Graph, NodeSpecs, EdgeSpecs, bRemoveUnmatched, Diff);
+    if (Diff.Errors.Num() > 0)
+    {
+        return MakeNotAppliedResult(MakeDiffJson(Diff), Graph, Diff.Errors);
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeDiffJson(Diff);
+    TArray<TSharedPtr<FJsonValue>> ErrorsArray;
+    auto AddError = [&ErrorsArray](const FString& Where, const FString& Message)
+    {
+        ErrorsArray.Add(MakeShared<FJsonValueObject>(MakeGraphError(Where, Message)));
+    };
+
+    // Failures while applying are undone like apply_blueprint_graph does
+    FGraphRollback Rollback(Graph);
+
+    // Unlink removals first so added links can take over freed single-link pins.
+    // Removed nodes leave the graph only once everything else has succeeded.
+    const UEdGraphSchema* Schema = Graph->GetSchema();
+    for (const TPair<UEdGraphPin*, UEdGraphPin*>& Link : Diff.RemovedLinks)
+    {
+        Rollback.SnapshotForConnect(Link.Key, Link.Value);
+        Schema->BreakSinglePinLink(Link.Key, Link.Value);
+    }
+    for (UEdGraphNode* Node : Diff.Removed)
+    {
+        for (UEdGraphPin* Pin : Node->Pins)
+        {
+            if (Pin)
+            {
+                Rollback.SnapshotLinks(Pin);
+            }
+        }
+        Node->BreakAllNodeLinks();
+    }
+
+    TMap<FString, UEdGraphNode*> NodeMap = Diff.Matched;
+    TArray<UEdGraphNode*> AddedNodes;
+    for (const FGraphNodeSpec* Spec : Diff.Added)
+    {
+        bool bCreated = false;
+        FString NodeError;
+        UEdGraphNode* Node = CreateNodeFromSpec(Blueprint, Graph, *Spec, bCreated, NodeError);
+        if (!Node)
+        {
+            AddError(Spec->TempId, NodeError.IsEmpty() ? TEXT("Node creation failed") : NodeError);
+            continue;
+        }
+        NodeMap.Add(Spec->TempId, Node);
+        if (bCreated)
+        {
+            AddedNodes.Add(Node);
+        }
+
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& PinValue : GetSpecPinValues(*Spec))
+        {
+            UEdGraphPin* Pin = FSpirrowBridgeCommonUtils::FindPin(Node, PinValue.Key, EGPD_Input);
+            FString PinError;
+            if (!Pin)
+            {
+                AddError(Spec->TempId + TEXT(".") + PinValue.Key, TEXT("Pin not found"));
+            }
+            else if (!ApplyPinDefault(Pin, PinValue.Value, PinError))
+            {
+                AddError(Spec->TempId + TEXT(".") + PinValue.Key, PinError);
+            }
+        }
+    }
+
+    for (const FGraphDiff::FPinChange& Change : Diff.PinChanges)
+    {
+        // Resolved now: an earlier change on the same node may have rebuilt its pins
+        const FString Where = Change.NodeId + TEXT(".") + Change.PinName.ToString();
+        UEdGraphPin* Pin = Change.Node->FindPin(Change.PinName, EGPD_Input);
+        FString PinError;
+        if (!Pin)
+        {
+            AddError(Where, TEXT("Pin not found"));
+            continue;
+        }
+
+        Rollback.SnapshotNode(Change.Node);
+        if (!ApplyPinDefault(Pin, Change.Value, PinError))
+        {
+            AddError(Where, PinError);
+        }
+    }
+
+    for (const FGraphDiff::FNodeMove& Move : Diff.Moves)
+    {
+        Rollback.SnapshotNode(Move.Node);
+        Move.Node->NodePosX = Move.To.X;
+        Move.Node->NodePosY = Move.To.Y;
+    }
+
+    int32 LinksAdded = 0;
+    for (const FGraphEdgeSpec* Edge : Diff.AddedEdges)
+    {
+        const FString Where = FString::Printf(TEXT("%s.%s -> %s.%s"), *Edge->Source, *Edge->SourcePin, *Edge->Target, *Edge->TargetPin);
+        UEdGraphNode* SourceNode = NodeMap.FindRef(Edge->Source);
+        UEdGraphNode* TargetNode = NodeMap.FindRef(Edge->Target);
+        UEdGraphPin* SourcePin = SourceNode ? FSpirrowBridgeCommonUtils::FindPin(SourceNode, Edge->SourcePin, EGPD_Output) : nullptr;
+        UEdGraphPin* TargetPin = TargetNode ? FSpirrowBridgeCommonUtils::FindPin(TargetNode, Edge->TargetPin, EGPD_Input) : nullptr;
+        if (!SourcePin || !TargetPin)
+        {
+            AddError(Where, (SourceNode && TargetNode) ? TEXT("Pin not found") : TEXT("Endpoint node was not created"));
+            continue;
+        }
+
+        FString ConnectError;
+        Rollback.SnapshotForConnect(SourcePin, TargetPin);
+        if (ConnectPins(SourcePin, TargetPin, ConnectError))
+        {
+            ++LinksAdded;
+        }
+        else
+        {
+            AddError(Where, ConnectError);
+        }
+    }
+
+    if (ErrorsArray.Num() > 0)
+    {
+        Rollback.Restore();
+        return MakeNotAppliedResult(ResultObj, Graph, ErrorsArray);
+    }
+
+    for (UEdGraphNode* Node : Diff.Removed)
+    {
+        Graph->RemoveNode(Node);
+    }
+
+    const bool bLayout = AutoLayout == EAutoLayout::All || (AutoLayout == EAutoLayout::New && AddedNodes.Num() > 0);
+    if (bLayout)
+    {
+        RunAutoLayout(Graph, AutoLayout, AddedNodes, ResultObj);
+    }
+
+    // Only structural edits pay for a structural refresh; pure pin edits still need a compile,
+    // moves need neither
+    const bool bStructural = Diff.IsStructural();
+    if (bStructural)
+    {
+        FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+    }
+    else if (Diff.HasChanges() || bLayout)
+    {
+        FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    }
+
+    if (bCompile && (bStructural || Diff.PinChanges.Num() > 0))
+    {
+        CompileAndReport(Blueprint, ResultObj);
+    }
+
+    TSharedPtr<FJsonObject> NodeMapObj = MakeShared<FJsonObject>();
+    for (const TPair<FString, UEdGraphNode*>& Pair : NodeMap)
+    {
+        NodeMapObj->SetStringField(Pair.Key, Pair.Value->NodeGuid.ToString());
+    }
+
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetBoolField(TEXT("applied"), true);
+    ResultObj->SetStringField(TEXT("graph"), Graph->GetName());
+    ResultObj->SetBoolField(TEXT("has_changes"), Diff.HasChanges());
+    ResultObj->SetObjectField(TEXT("node_map"), NodeMapObj);
+    ResultObj->SetNumberField(TEXT("links_made"), LinksAdded);
+
+    UE_LOG(LogSpirrowBridgeNodeGraph, Log, TEXT("patch_blueprint_graph: %s/%s +%d -%d nodes, +%d -%d links, %d pin edits"),
+        *Blueprint->GetName(), *Graph->GetName(), Diff.Added.Num(), Diff.Removed.Num(),
+        LinksAdded, Diff.RemovedLinks.Num(), Diff.PinChanges.Num());
+
+    return ResultObj;
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintNodeGraphCommands::HandleAutoLayoutBlueprintGraph(const TSharedPtr<FJsonObject>& Params)
+{
+    FString GraphName;
+    double HorizontalSpacing = 80.0;
+    double VerticalSpacing = 32.0;
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("graph_name"), GraphName, TEXT(""));
+    FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("horizontal_spacing"), HorizontalSpacing, 80.0);
+    FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("vertical_spacing"), VerticalSpacing, 32.0);
+
+    UBlueprint* Blueprint = nullptr;
+    if (auto Error = FSpirrowBridgeCommonUtils::ResolveTargetBlueprint(Params, Blueprint))
+    {
+        return Error;
+    }
+
+    UEdGraph* Graph = FindGraphByName(Blueprint, GraphName);
+    if (!Graph)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::GraphNotFound,
+            FString::Printf(TEXT("Graph not found: %s"), *GraphName));
+    }
+
+    // Optional subset; links to nodes outside it are ignored
+    TArray<UEdGraphNode*> Nodes;
+    const TArray<TSharedPtr<FJsonValue>>* NodeIds = nullptr;
+    if (Params->TryGetArrayField(TEXT("node_ids"), NodeIds) && NodeIds->Num() > 0)
+    {
+        for (const TSharedPtr<FJsonValue>& NodeIdValue : *NodeIds)
+        {
+            UEdGraphNode* Node = nullptr;
+            if (auto Error = FSpirrowBridgeNodeIndex::Get().ResolveNode(Blueprint, NodeIdValue->AsString(), Node))
+            {
+                return Error;
+            }
+            if (Node->GetGraph() == Graph)
+            {
+                Nodes.Add(Node);
+            }
+        }
+    }
+    else
+    {
+        Nodes = Graph->Nodes;
+    }
+
+    FSpirrowBridgeGraphLayout::FSettings Settings;
+    Settings.HorizontalSpacing = static_cast<int32>(HorizontalSpacing);
+    Settings.VerticalSpacing = static_cast<int32>(VerticalSpacing);
+    const FSpirrowBridgeGraphLayout::FResult Layout = FSpirrowBridgeGraphLayout::Layout(Nodes, Settings);
+
+    // Positions only: no structural refresh or compile needed, and nothing at all
+    // when the graph was already laid out
+    if (Layout.NumMoved > 0)
+    {
+        FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+    }
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetStringField(TEXT("graph"), Graph->GetName());
+    ResultObj->SetObjectField(TEXT("layout"), MakeLayoutJson(Layout));
+    return ResultObj;
+}
@@ -1,5 +1,6 @@
 #include "Commands/SpirrowBridgeBlueprintPropertyCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeClassHierarchyCache.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Engine/DataAsset.h"
@@ -83,215 +84,177 @@ TSharedPtr<FJsonObject> FSpirrowBridgeBlueprintPropertyCommands::HandleScanProje
     Params->TryGetStringField(TEXT("path_filter"), PathFilter);
     Params->TryGetStringField(TEXT("blueprint_type"), BlueprintTypeFilter);
 
-    bool bIncludeEngine, bExcludeReinst;
+    // exclude_reinst is kept for compatibility: REINST/transient classes are never
+    // part of the cached hierarchy, so they are always excluded.
+    bool bIncludeEngine;
     FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("include_engine"), bIncludeEngine, false);
-    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("exclude_reinst"), bExcludeReinst, true);
+
+    FSpirrowBridgeClassHierarchyCache& Hierarchy = FSpirrowBridgeClassHierarchyCache::Get();
+    Hierarchy.EnsureBuilt();
+    const TArray<FSpirrowBridgeClassHierarchyCache::FClassEntry>& Entries = Hierarchy.GetEntries();
 
     TArray<TSharedPtr<FJsonValue>> CppClassesArray;
     TArray<TSharedPtr<FJsonValue>> BlueprintsArray;
 
-    // === Scan C++ classes ===
-    if (ClassType == TEXT("all") || ClassType == TEXT("cpp"))
+    // Resolve the parent filter once; every class check below is an ID range test
+    int32 ParentId = INDEX_NONE;
+    if (!ParentClassFilter.IsEmpty())
     {
-        for (TObjectIterator<UClass> ClassIt; ClassIt; ++ClassIt)
+        ParentId = Hierarchy.FindClassId(ParentClassFilter);
+        if (ParentId == INDEX_NONE)
         {
-            UClass* TestClass = *ClassIt;
-            if (!TestClass || !TestClass->IsChildOf(AActor::StaticClass()))
-            {
-                continue;
-            }
-
-            FString ClassPath = TestClass->GetPathName();
-            FString ClassName = TestClass->GetName();
+            TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+            ResultObj->SetBoolField(TEXT("success"), true);
+            ResultObj->SetArrayField(TEXT("cpp_classes"), CppClassesArray);
+            ResultObj->SetArrayField(TEXT("blueprints"), BlueprintsArray);
+            ResultObj->SetNumberField(TEXT("total_cpp"), 0);
+            ResultObj->SetNumberField(TEXT("total_blueprints"), 0);
+            ResultObj->SetStringField(TEXT("warning"), FString::Printf(TEXT("Parent class not found: %s"), *ParentClassFilter));
+            return ResultObj;
+        }
+    }
 
-            if (!bIncludeEngine)
-            {
-                if (ClassPath.Contains(TEXT("/Script/Engine.")) ||
-                    ClassPath.Contains(TEXT("/Script/CoreUObject.")) ||
-                    ClassPath.Contains(TEXT("/Script/UMG.")) ||
-                    ClassPath.Contains(TEXT("/Script/AIModule.")) ||
-                    ClassPath.Contains(TEXT("/Script/NavigationSystem.")) ||
-                    ClassPath.Contains(TEXT("/Script/PhysicsCore.")) ||
-                    ClassPath.Contains(TEXT("/Script/EnhancedInput.")) ||
-                    ClassPath.Contains(TEXT("/Script/InputCore.")))
-                {
-                    continue;
-                }
-            }
+    // === Scan C++ classes (subtree walk under AActor, or under the parent filter) ===
+    if (ClassType == TEXT("all") || ClassType == TEXT("cpp"))
+    {
+        const int32 ActorId = Hierarchy.FindClassId(AActor::StaticClass());
+        const int32 ModuleId = ModuleFilter.IsEmpty() ? INDEX_NONE : Hierarchy.FindModuleId(FName(*ModuleFilter));
+        const bool bModuleFilterUnknown = !ModuleFilter.IsEmpty() && ModuleId == INDEX_NONE;
 
-            if (ClassName.EndsWith(TEXT("_C")))
-            {
-                continue;
-            }
+        // Walk the narrower of the two subtrees
+        int32 RootId = ActorId;
+        if (ParentId != INDEX_NONE && (ParentId == ActorId || Hierarchy.IsDescendantOf(ParentId, ActorId)))
+        {
+            RootId = ParentId;
+        }
 
-            if (bExcludeReinst)
+        if (RootId != INDEX_NONE && !bModuleFilterUnknown)
+        {
+            for (int32 Id = RootId + 1; Id < Entries[RootId].SubtreeEnd; ++Id)
             {
-                if (ClassName.StartsWith(TEXT("REINST_")) || ClassPath.Contains(TEXT("/Engine/Transient.")))
+                const FSpirrowBridgeClassHierarchyCache::FClassEntry& Entry = Entries[Id];
+                if (Entry.bIsBlueprint)
                 {
                     continue;
                 }
-            }
-
-            if (!ModuleFilter.IsEmpty())
-            {
-                if (!ClassPath.Contains(FString::Printf(TEXT("/Script/%s."), *ModuleFilter)))
+                if (!bIncludeEngine && Hierarchy.IsEngineModule(Entry.ModuleId))
                 {
                     continue;
                 }
-            }
-
-            if (!ParentClassFilter.IsEmpty())
-            {
-                UClass* ParentClass = TestClass->GetSuperClass();
-                bool bMatchesParent = false;
-                while (ParentClass)
+                if (ModuleId != INDEX_NONE && Entry.ModuleId != ModuleId)
                 {
-                    if (ParentClass->GetName() == ParentClassFilter ||
-                        ParentClass->GetName() == TEXT("A") + ParentClassFilter ||
-                        ParentClass->GetName() == ParentClassFilter.Mid(1))
-                    {
-                        bMatchesParent = true;
-                        break;
-                    }
-                    ParentClass = ParentClass->GetSuperClass();
+                    continue;
                 }
-                if (!bMatchesParent) continue;
-            }
-
-            FString ModuleName;
-            if (ClassPath.Contains(TEXT("/Script/")))
-            {
-                int32 ScriptIdx = ClassPath.Find(TEXT("/Script/"));
-                int32 DotIdx = ClassPath.Find(TEXT("."), ESearchCase::IgnoreCase, ESearchDir::FromStart, ScriptIdx + 8);
-                if (DotIdx != INDEX_NONE)
+                if (ParentId != INDEX_NONE && !Hierarchy.IsDescendantOf(Id, ParentId))
                 {
-                    ModuleName = ClassPath.Mid(ScriptIdx + 8, DotIdx - ScriptIdx - 8);
+                    continue;
                 }
-            }
 
-            FString ParentClassName;
-            if (TestClass->GetSuperClass())
-            {
-                ParentClassName = TestClass->GetSuperClass()->GetName();
-            }
+                const FName ParentName = Hierarchy.GetParentName(Id);
+                const FName ModuleName = Hierarchy.GetModuleName(Entry.ModuleId);
 
-            TSharedPtr<FJsonObject> ClassObj = MakeShared<FJsonObject>();
-            ClassObj->SetStringField(TEXT("name"), ClassName);
-            ClassObj->SetStringField(TEXT("path"), ClassPath);
-            ClassObj->SetStringField(TEXT("parent"), ParentClassName);
-            ClassObj->SetStringField(TEXT("module"), ModuleName);
+                TSharedPtr<FJsonObject> ClassObj = MakeShared<FJsonObject>();
+                ClassObj->SetStringField(TEXT("name"), Entry.Name.ToString());
+                ClassObj->SetStringField(TEXT("path"), Entry.Path);
+                ClassObj->SetStringField(TEXT("parent"), ParentName.IsNone() ? FString() : ParentName.ToString());
+                ClassObj->SetStringField(TEXT("module"), ModuleName.IsNone() ? FString() : ModuleName.ToString());
 
-            CppClassesArray.Add(MakeShared<FJsonValueObject>(ClassObj));
+                CppClassesArray.Add(MakeShared<FJsonValueObject>(ClassObj));
+            }
         }
     }
 
-    // === Scan Blueprint assets ===
+    // === Scan Blueprint assets (from the cached tree, no asset loads) ===
     if (ClassType == TEXT("all") || ClassType == TEXT("blueprint"))
     {
-        FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-        IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+        // blueprint_type maps to one (or two) native ancestor IDs
+        int32 TypeAncestorId = INDEX_NONE;
+        int32 TypeExcludedId = INDEX_NONE;
+        int32 TypeAlternateId = INDEX_NONE;
+        bool bTypeFilterResolved = true;
 
-        FARFilter Filter;
-        Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
-        Filter.bRecursiveClasses = true;
-        Filter.bRecursivePaths = true;
-
-        if (!PathFilter.IsEmpty())
-        {
-            Filter.PackagePaths.Add(FName(*PathFilter));
-        }
-        else
+        if (!BlueprintTypeFilter.IsEmpty())
         {
-            Filter.PackagePaths.Add(FName(TEXT("/Game")));
+            if (BlueprintTypeFilter == TEXT("actor"))
+            {
+                TypeAncestorId = Hierarchy.FindClassId(AActor::StaticClass());
+                TypeExcludedId = Hierarchy.FindClassId(UUserWidget::StaticClass());
+            }
+            else if (BlueprintTypeFilter == TEXT("widget"))
+            {
+                TypeAncestorId = Hierarchy.FindClassId(UUserWidget::StaticClass());
+            }
+            else if (BlueprintTypeFilter == TEXT("anim"))
+            {
+                TypeAncestorId = Hierarchy.FindClassId(UAnimInstance::StaticClass());
+            }
+            else if (BlueprintTypeFilter == TEXT("controlrig"))
+            {
+                TypeAncestorId = Hierarchy.FindClassId(TEXT("/Script/ControlRig.ControlRig"));
+            }
+            else if (BlueprintTypeFilter == TEXT("interface"))
+            {
+                TypeAncestorId = Hierarchy.FindClassId(UInterface::StaticClass());
+            }
+            else if (BlueprintTypeFilter == TEXT("gamemode"))
+            {
+                TypeAncestorId = Hierarchy.FindClassId(AGameModeBase::StaticClass());
+            }
+            else if (BlueprintTypeFilter == TEXT("controller"))
+            {
+                TypeAncestorId = Hierarchy.FindClassId(AController::StaticClass());
+            }
+            else if (BlueprintTypeFilter == TEXT("character"))
+            {
+                TypeAncestorId = Hierarchy.FindClassId(ACharacter::StaticClass());
+            }
+            else if (BlueprintTypeFilter == TEXT("pawn"))
+            {
+                TypeAncestorId = Hierarchy.FindClassId(APawn::StaticClass());
+            }
+            bTypeFilterResolved = TypeAncestorId != INDEX_NONE || BlueprintTypeFilter == TEXT("interface");
         }
 
-        TArray<FAssetData> AssetList;
-        AssetRegistry.GetAssets(Filter, AssetList);
+        // Walk only the parent's subtree when a parent filter is given
+        const int32 BeginId = ParentId != INDEX_NONE ? ParentId + 1 : 0;
+        const int32 EndId = ParentId != INDEX_NONE ? Entries[ParentId].SubtreeEnd : Entries.Num();
 
-        for (const FAssetData& Asset : AssetList)
+        FString PathPrefix = PathFilter;
+        if (!PathPrefix.IsEmpty() && !PathPrefix.EndsWith(TEXT("/")))
         {
-            UBlueprint* Blueprint = Cast<UBlueprint>(Asset.GetAsset());
-            if (!Blueprint) continue;
+            PathPrefix += TEXT("/");
+        }
 
-            if (!ParentClassFilter.IsEmpty() && Blueprint->ParentClass)
+        for (int32 Id = BeginId; Id < EndId && bTypeFilterResolved; ++Id)
+        {
+            const FSpirrowBridgeClassHierarchyCache::FClassEntry& Entry = Entries[Id];
+            if (!Entry.bIsBlueprint)
             {
-                UClass* ParentClass = Blueprint->ParentClass;
-                bool bMatchesParent = false;
-                while (ParentClass)
-                {
-                    if (ParentClass->GetName() == ParentClassFilter ||
-                        ParentClass->GetName() == TEXT("A") + ParentClassFilter ||
-                        ParentClass->GetName() == ParentClassFilter.Mid(1))
-                    {
-                        bMatchesParent = true;
-                        break;
-                    }
-                    ParentClass = ParentClass->GetSuperClass();
-                }
-                if (!bMatchesParent) continue;
+                continue;
             }
 
-            if (!BlueprintTypeFilter.IsEmpty() && Blueprint->ParentClass)
+            if (PathPrefix.IsEmpty() ? !Entry.bIsGameContent : !Entry.Path.StartsWith(PathPrefix))
             {
-                bool bMatchesType = false;
-                UClass* ParentClass = Blueprint->ParentClass;
+                continue;
+            }
 
-                if (BlueprintTypeFilter == TEXT("actor"))
-                {
-                    bMatchesType = ParentClass->IsChildOf(AActor::StaticClass()) &&
-                                   !ParentClass->IsChildOf(UUserWidget::StaticClass());
-                }
-                else if (BlueprintTypeFilter == TEXT("widget"))
-                {
-                    bMatchesType = ParentClass->IsChildOf(UUserWidget::StaticClass());
-                }
-                else if (BlueprintTypeFilter == TEXT("anim"))
-                {
-                    bMatchesType = ParentClass->IsChildOf(UAnimInstance::StaticClass());
-                }
-                else if (BlueprintTypeFilter == TEXT("controlrig"))
-                {
-                    static UClass* ControlRigClass = FindObject<UClass>(nullptr, TEXT("/Script/ControlRig.ControlRig"));
-                    if (ControlRigClass)
-                    {
-                        bMatchesType = ParentClass->IsChildOf(ControlRigClass);
-                    }
-                }
-                else if (BlueprintTypeFilter == TEXT("interface"))
-                {
-                    bMatchesType = ParentClass->IsChildOf(UInterface::StaticClass()) ||
-                                   Asset.AssetName.ToString().StartsWith(TEXT("BPI_"));
-                }
-                else if (BlueprintTypeFilter == TEXT("gamemode"))
-                {
-                    bMatchesType = ParentClass->IsChildOf(AGameModeBase::StaticClass());
-                }
-                else if (BlueprintTypeFilter == TEXT("controller"))
-                {
-                    bMatchesType = ParentClass->IsChildOf(AController::StaticClass());
-                }
-                else if (BlueprintTypeFilter == TEXT("character"))
-                {
-                    bMatchesType = ParentClass->IsChildOf(ACharacter::StaticClass());
-                }
-                else if (BlueprintTypeFilter == TEXT("pawn"))
+            if (!BlueprintTypeFilter.IsEmpty())
+            {
+                bool bMatchesType = Hierarchy.IsDescendantOf(Id, TypeAncestorId) &&
+                                    !Hierarchy.IsDescendantOf(Id, TypeExcludedId);
+                if (!bMatchesType && BlueprintTypeFilter == TEXT("interface"))
                 {
-                    bMatchesType = ParentClass->IsChildOf(APawn::StaticClass());
+                    bMatchesType = Entry.AssetName.ToString().StartsWith(TEXT("BPI_"));
                 }
-
                 if (!bMatchesType) continue;
             }
 
-            FString ParentClassName;
-            if (Blueprint->ParentClass)
-            {
-                ParentClassName = Blueprint->ParentClass->GetName();
-            }
+            const FName ParentName = Hierarchy.GetParentName(Id);
 
             TSharedPtr<FJsonObject> BPObj = MakeShared<FJsonObject>();
-            BPObj->SetStringField(TEXT("name"), Asset.AssetName.ToString());
-            BPObj->SetStringField(TEXT("path"), Asset.GetObjectPathString());
-            BPObj->SetStringField(TEXT("parent"), ParentClassName);
+            BPObj->SetStringField(TEXT("name"), Entry.AssetName.ToString());
+            BPObj->SetStringField(TEXT("path"), Entry.Path);
+            BPObj->SetStringField(TEXT("parent"), ParentName.IsNone() ? FString() : ParentName.ToString());
 
             BlueprintsArray.Add(MakeShared<FJsonValueObject>(BPObj));
         }
@@ -0,0 +1,492 @@
+#include "Commands/SpirrowBridgeBlueprintSearchIndex.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "K2Node_Event.h"
+#include "K2Node_CustomEvent.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_VariableGet.h"
+#include "K2Node_VariableSet.h"
+#include "K2Node_IfThenElse.h"
+#include "K2Node_ExecutionSequence.h"
+#include "K2Node_MacroInstance.h"
+#include "K2Node_InputAction.h"
+#include "K2Node_Self.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Editor.h"
+#include "Editor/EditorEngine.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+
+namespace
+{
+    const FName KindEvent(TEXT("Event"));
+    const FName KindFunction(TEXT("Function"));
+    const FName KindVariableGet(TEXT("VariableGet"));
+    const FName KindVariableSet(TEXT("VariableSet"));
+    const FName KindBranch(TEXT("Branch"));
+    const FName KindSequence(TEXT("Sequence"));
+    const FName KindMacro(TEXT("Macro"));
+    const FName KindInputAction(TEXT("InputAction"));
+    const FName KindSelf(TEXT("Self"));
+    const FName KindOther(TEXT("Other"));
+
+    /** Term field for the member a node kind refers to (nullptr if none) */
+    const TCHAR* GetMemberField(FName Kind)
+    {
+        if (Kind == KindEvent)          return TEXT("event");
+        if (Kind == KindFunction)       return TEXT("function");
+        if (Kind == KindVariableGet || Kind == KindVariableSet) return TEXT("variable");
+        if (Kind == KindMacro)          return TEXT("macro");
+        if (Kind == KindInputAction)    return TEXT("input_action");
+        return nullptr;
+    }
+}
+
+FSpirrowBridgeBlueprintSearchIndex& FSpirrowBridgeBlueprintSearchIndex::Get()
+{
+    static FSpirrowBridgeBlueprintSearchIndex Instance;
+    return Instance;
+}
+
+void FSpirrowBridgeBlueprintSearchIndex::Initialize()
+{
+    if (bInitialized)
+    {
+        return;
+    }
+    bInitialized = true;
+
+    PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &FSpirrowBridgeBlueprintSearchIndex::OnPackageSaved);
+
+    if (GEditor)
+    {
+        BlueprintPreCompileHandle = GEditor->OnBlueprintPreCompile().AddRaw(this, &FSpirrowBridgeBlueprintSearchIndex::OnBlueprintPreCompile);
+    }
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+    AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FSpirrowBridgeBlueprintSearchIndex::OnAssetRemoved);
+    AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FSpirrowBridgeBlueprintSearchIndex::OnAssetRenamed);
+}
+
+void FSpirrowBridgeBlueprintSearchIndex::Shutdown()
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+    bInitialized = false;
+
+    UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+
+    if (GEditor)
+    {
+        GEditor->OnBlueprintPreCompile().Remove(BlueprintPreCompileHandle);
+    }
+
+    if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+    {
+        IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+        AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+    }
+
+    Assets.Empty();
+    FreeAssetIds.Empty();
+    AssetByPath.Empty();
+    Records.Empty();
+    Postings.Empty();
+}
+
+FName FSpirrowBridgeBlueprintSearchIndex::MakeTerm(const TCHAR* Field, FName Value)
+{
+    return FName(*FString::Printf(TEXT("%s:%s"), Field, *Value.ToString()));
+}
+
+FName FSpirrowBridgeBlueprintSearchIndex::ParseTerm(const FString& Text)
+{
+    const FString Trimmed = Text.TrimStartAndEnd();
+    int32 ColonIdx = INDEX_NONE;
+    if (Trimmed.FindChar(TEXT(':'), ColonIdx) && ColonIdx > 0)
+    {
+        return FName(*Trimmed);
+    }
+    return MakeTerm(TEXT("name"), FName(*Trimmed));
+}
+
+void FSpirrowBridgeBlueprintSearchIndex::ClassifyNode(const UEdGraphNode* Node, FName& OutKind, FName& OutMember)
+{
+    OutKind = KindOther;
+    OutMember = NAME_None;
+
+    if (const UK2Node_CustomEvent* CustomEventNode = Cast<UK2Node_CustomEvent>(Node))
+    {
+        OutKind = KindEvent;
+        OutMember = CustomEventNode->CustomFunctionName;
+    }
+    else if (const UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
+    {
+        OutKind = KindEvent;
+        OutMember = EventNode->EventReference.GetMemberName();
+    }
+    else if (const UK2Node_CallFunction* FuncNode = Cast<UK2Node_CallFunction>(Node))
+    {
+        OutKind = KindFunction;
+        OutMember = FuncNode->FunctionReference.GetMemberName();
+    }
+    else if (const UK2Node_VariableGet* VarGetNode = Cast<UK2Node_VariableGet>(Node))
+    {
+        OutKind = KindVariableGet;
+        OutMember = VarGetNode->VariableReference.GetMemberName();
+    }
+    else if (const UK2Node_VariableSet* VarSetNode = Cast<UK2Node_VariableSet>(Node))
+    {
+        OutKind = KindVariableSet;
+        OutMember = VarSetNode->VariableReference.GetMemberName();
+    }
+    else if (Cast<UK2Node_IfThenElse>(Node))
+    {
+        OutKind = KindBranch;
+        OutMember = KindBranch;
+    }
+    else if (Cast<UK2Node_ExecutionSequence>(Node))
+    {
+        OutKind = KindSequence;
+        OutMember = KindSequence;
+    }
+    else if (const UK2Node_MacroInstance* MacroNode = Cast<UK2Node_MacroInstance>(Node))
+    {
+        OutKind = KindMacro;
+        if (const UEdGraph* MacroGraph = MacroNode->GetMacroGraph())
+        {
+            OutMember = MacroGraph->GetFName();
+        }
+    }
+    else if (const UK2Node_InputAction* InputNode = Cast<UK2Node_InputAction>(Node))
+    {
+        OutKind = KindInputAction;
+        OutMember = InputNode->InputActionName;
+    }
+    else if (Cast<UK2Node_Self>(Node))
+    {
+        OutKind = KindSelf;
+        OutMember = KindSelf;
+    }
+}
+
+void FSpirrowBridgeBlueprintSearchIndex::GatherTerms(const FNodeRecord& Record, TArray<FName, TInlineAllocator<6>>& OutTerms)
+{
+    OutTerms.Add(MakeTerm(TEXT("kind"), Record.Kind));
+    OutTerms.Add(MakeTerm(TEXT("class"), Record.NodeClass));
+    OutTerms.Add(MakeTerm(TEXT("graph"), Record.Graph));
+    if (!Record.Member.IsNone())
+    {
+        OutTerms.Add(MakeTerm(TEXT("name"), Record.Member));
+        if (const TCHAR* Field = GetMemberField(Record.Kind))
+        {
+            OutTerms.Add(MakeTerm(Field, Record.Member));
+        }
+    }
+}
+
+void FSpirrowBridgeBlueprintSearchIndex::RemoveRecords(FAssetEntry& Entry)
+{
+    TArray<FName, TInlineAllocator<6>> Terms;
+    for (const int32 RecordId : Entry.Records)
+    {
+        Terms.Reset();
+        GatherTerms(Records[RecordId], Terms);
+        for (const FName Term : Terms)
+        {
+            if (TSet<int32>* Posting = Postings.Find(Term))
+            {
+                Posting->Remove(RecordId);
+                if (Posting->Num() == 0)
+                {
+                    Postings.Remove(Term);
+                }
+            }
+        }
+        Records.RemoveAt(RecordId);
+    }
+    Entry.Records.Reset();
+}
+
+void FSpirrowBridgeBlueprintSearchIndex::RemoveAsset(FName ObjectPath)
+{
+    int32 AssetId = INDEX_NONE;
+    if (!AssetByPath.RemoveAndCopyValue(ObjectPath, AssetId))
+    {
+        return;
+    }
+
+    RemoveRecords(Assets[AssetId]);
+    Assets[AssetId] = FAssetEntry();
+    FreeAssetIds.Add(AssetId);
+}
+
+void FSpirrowBridgeBlueprintSearchIndex::IndexBlueprint(UBlueprint* Blueprint)
+{
+    const FName ObjectPath(*Blueprint->GetPathName());
+
+    int32 AssetId = INDEX_NONE;
+    if (const int32* Existing = AssetByPath.Find(ObjectPath))
+    {
+        AssetId = *Existing;
+        RemoveRecords(Assets[AssetId]);
+    }
+    else
+    {
+        AssetId = FreeAssetIds.Num() > 0 ? FreeAssetIds.Pop(EAllowShrinking::No) : Assets.AddDefaulted();
+        AssetByPath.Add(ObjectPath, AssetId);
+    }
+
+    FAssetEntry& Entry = Assets[AssetId];
+    Entry.ObjectPath = ObjectPath;
+    Entry.AssetName = Blueprint->GetFName();
+    Entry.bStale = false;
+
+    TArray<UEdGraph*> Graphs;
+    FBlueprintEditorUtils::GetAllGraphs(Blueprint, Graphs);
+
+    TArray<FName, TInlineAllocator<6>> Terms;
+    for (const UEdGraph* Graph : Graphs)
+    {
+        if (!Graph)
+        {
+            continue;
+        }
+
+        for (const UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (!Node)
+            {
+                continue;
+            }
+
+            FNodeRecord Record;
+            Record.AssetId = AssetId;
+            Record.Graph = Graph->GetFName();
+            Record.NodeGuid = Node->NodeGuid;
+            Record.NodeClass = Node->GetClass()->GetFName();
+            ClassifyNode(Node, Record.Kind, Record.Member);
+
+            Terms.Reset();
+            GatherTerms(Record, Terms);
+
+            const int32 RecordId = Records.Add(MoveTemp(Record));
+            Entry.Records.Add(RecordId);
+            for (const FName Term : Terms)
+            {
+                Postings.FindOrAdd(Term).Add(RecordId);
+            }
+        }
+    }
+}
+
+int32 FSpirrowBridgeBlueprintSearchIndex::EnsureIndexed(const FString& PathPrefix, bool bForceReindex)
+{
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+    FARFilter Filter;
+    Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+    Filter.bRecursiveClasses = true;
+    if (!PathPrefix.IsEmpty())
+    {
+        FString PackagePath = PathPrefix;
+        PackagePath.RemoveFromEnd(TEXT("/"));
+        Filter.PackagePaths.Add(FName(*PackagePath));
+        Filter.bRecursivePaths = true;
+    }
+
+    TArray<FAssetData> BlueprintAssets;
+    AssetRegistry.GetAssets(Filter, BlueprintAssets);
+
+    int32 NumIndexed = 0;
+    for (const FAssetData& AssetData : BlueprintAssets)
+    {
+        if (!bForceReindex)
+        {
+            const int32* AssetId = AssetByPath.Find(FName(*AssetData.GetObjectPathString()));
+            if (AssetId && !Assets[*AssetId].bStale)
+            {
+                continue;
+            }
+        }
+
+        // Loads the asset if it is not in memory yet
+        if (UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset()))
+        {
+            IndexBlueprint(Blueprint);
+            ++NumIndexed;
+        }
+    }
+    return NumIndexed;
+}
+
+FSpirrowBridgeBlueprintSearchIndex::FQueryResult FSpirrowBridgeBlueprintSearchIndex::Query(const FQuery& InQuery) const
+{
+    FQueryResult Result;
+
+    // Resolve each clause to its postings, smallest clause first
+    struct FClause
+    {
+        TArray<const TSet<int32>*, TInlineAllocator<4>> Sets;
+        int32 EstimatedSize = 0;
+    };
+    TArray<FClause> Clauses;
+    for (const TArray<FName>& Terms : InQuery.Clauses)
+    {
+        FClause& Clause = Clauses.AddDefaulted_GetRef();
+        for (const FName Term : Terms)
+        {
+            if (const TSet<int32>* Posting = Postings.Find(Term))
+            {
+                Clause.Sets.Add(Posting);
+                Clause.EstimatedSize += Posting->Num();
+            }
+        }
+        if (Clause.Sets.Num() == 0)
+        {
+            return Result;
+        }
+    }
+    Clauses.Sort([](const FClause& A, const FClause& B) { return A.EstimatedSize < B.EstimatedSize; });
+
+    auto ClauseContains = [](const FClause& Clause, int32 RecordId)
+    {
+        for (const TSet<int32>* Set : Clause.Sets)
+        {
+            if (Set->Contains(RecordId))
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    auto Accept = [&](int32 RecordId)
+    {
+        for (int32 ClauseIdx = 1; ClauseIdx < Clauses.Num(); ++ClauseIdx)
+        {
+            if (!ClauseContains(Clauses[ClauseIdx], RecordId))
+            {
+                return false;
+            }
+        }
+        for (const FName Term : InQuery.Excluded)
+        {
+            const TSet<int32>* Posting = Postings.Find(Term);
+            if (Posting && Posting->Contains(RecordId))
+            {
+                return false;
+            }
+        }
+        if (!InQuery.PathPrefix.IsEmpty())
+        {
+            const FAssetEntry& Asset = Assets[Records[RecordId].AssetId];
+            if (!Asset.ObjectPath.ToString().StartsWith(InQuery.PathPrefix))
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    TArray<int32> Matches;
+    if (Clauses.Num() > 0)
+    {
+        TSet<int32> Seen;
+        for (const TSet<int32>* Set : Clauses[0].Sets)
+        {
+            for (const int32 RecordId : *Set)
+            {
+                bool bAlreadySeen = false;
+                Seen.Add(RecordId, &bAlreadySeen);
+                if (!bAlreadySeen && Accept(RecordId))
+                {
+                    Matches.Add(RecordId);
+                }
+            }
+        }
+    }
+    else
+    {
+        for (auto It = Records.CreateConstIterator(); It; ++It)
+        {
+            if (Accept(It.GetIndex()))
+            {
+                Matches.Add(It.GetIndex());
+            }
+        }
+    }
+
+    // Stable order for pagination: asset path, then indexing order within the asset
+    Matches.Sort([this](int32 A, int32 B)
+    {
+        const int32 AssetA = Records[A].AssetId;
+        const int32 AssetB = Records[B].AssetId;
+        if (AssetA != AssetB)
+        {
+            return Assets[AssetA].ObjectPath.LexicalLess(Assets[AssetB].ObjectPath);
+        }
+        return A < B;
+    });
+
+    TSet<int32> MatchedAssets;
+    for (const int32 RecordId : Matches)
+    {
+        MatchedAssets.Add(Records[RecordId].AssetId);
+    }
+
+    Result.TotalMatches = Matches.Num();
+    Result.NumAssetsMatched = MatchedAssets.Num();
+
+    const int32 Start = FMath::Clamp(InQuery.Offset, 0, Matches.Num());
+    const int32 End = InQuery.Limit > 0 ? FMath::Min(Matches.Num(), Start + InQuery.Limit) : Matches.Num();
+    Result.Records.Append(Matches.GetData() + Start, End - Start);
+    return Result;
+}
+
+void FSpirrowBridgeBlueprintSearchIndex::OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext)
+{
+    if (!Package || SaveContext.IsProceduralSave())
+    {
+        return;
+    }
+
+    ForEachObjectWithPackage(Package, [this](UObject* Object)
+    {
+        UBlueprint* Blueprint = Cast<UBlueprint>(Object);
+        // Only Blueprints a query has already covered; the rest are picked up lazily
+        if (Blueprint && AssetByPath.Contains(FName(*Blueprint->GetPathName())))
+        {
+            IndexBlueprint(Blueprint);
+        }
+        return true;
+    }, false);
+}
+
+void FSpirrowBridgeBlueprintSearchIndex::OnBlueprintPreCompile(UBlueprint* Blueprint)
+{
+    if (!Blueprint)
+    {
+        return;
+    }
+    if (const int32* AssetId = AssetByPath.Find(FName(*Blueprint->GetPathName())))
+    {
+        Assets[*AssetId].bStale = true;
+    }
+}
+
+void FSpirrowBridgeBlueprintSearchIndex::OnAssetRemoved(const FAssetData& AssetData)
+{
+    RemoveAsset(FName(*AssetData.GetObjectPathString()));
+}
+
+void FSpirrowBridgeBlueprintSearchIndex::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    // The new path is indexed by the next query that covers it
+    RemoveAsset(FName(*OldObjectPath));
+}
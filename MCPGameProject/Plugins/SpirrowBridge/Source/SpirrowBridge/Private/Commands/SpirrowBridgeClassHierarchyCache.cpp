@@ -0,0 +1,375 @@
+#include "Commands/SpirrowBridgeClassHierarchyCache.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/Blueprint.h"
+#include "Editor.h"
+#include "Editor/EditorEngine.h"
+#include "Misc/PackageName.h"
+#include "UObject/UObjectIterator.h"
+
+namespace
+{
+    // Modules hidden by scan_project_classes unless include_engine is set
+    const TCHAR* const HiddenEngineModules[] = {
+        TEXT("Engine"),
+        TEXT("CoreUObject"),
+        TEXT("UMG"),
+        TEXT("AIModule"),
+        TEXT("NavigationSystem"),
+        TEXT("PhysicsCore"),
+        TEXT("EnhancedInput"),
+        TEXT("InputCore"),
+    };
+
+    struct FPendingEntry
+    {
+        FSpirrowBridgeClassHierarchyCache::FClassEntry Entry;
+        FName ParentPath;
+        TArray<int32> Children;
+    };
+
+    /** "/Script/Engine.Actor" -> "Engine" */
+    FName ExtractScriptModule(const FString& ClassPath)
+    {
+        static const FString ScriptPrefix = TEXT("/Script/");
+        if (!ClassPath.StartsWith(ScriptPrefix))
+        {
+            return NAME_None;
+        }
+
+        int32 DotIdx = INDEX_NONE;
+        if (!ClassPath.FindChar(TEXT('.'), DotIdx) || DotIdx <= ScriptPrefix.Len())
+        {
+            return NAME_None;
+        }
+        return FName(*ClassPath.Mid(ScriptPrefix.Len(), DotIdx - ScriptPrefix.Len()));
+    }
+}
+
+FSpirrowBridgeClassHierarchyCache& FSpirrowBridgeClassHierarchyCache::Get()
+{
+    static FSpirrowBridgeClassHierarchyCache Instance;
+    return Instance;
+}
+
+void FSpirrowBridgeClassHierarchyCache::Initialize()
+{
+    if (bInitialized)
+    {
+        return;
+    }
+    bInitialized = true;
+
+    ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddRaw(this, &FSpirrowBridgeClassHierarchyCache::OnModulesChanged);
+
+    if (GEditor)
+    {
+        BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(this, &FSpirrowBridgeClassHierarchyCache::OnBlueprintCompiled);
+    }
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+    AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FSpirrowBridgeClassHierarchyCache::OnAssetChanged);
+    AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FSpirrowBridgeClassHierarchyCache::OnAssetChanged);
+    AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FSpirrowBridgeClassHierarchyCache::OnAssetRenamed);
+}
+
+void FSpirrowBridgeClassHierarchyCache::Shutdown()
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+    bInitialized = false;
+
+    FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
+
+    if (GEditor)
+    {
+        GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+    }
+
+    if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>("AssetRegistry"))
+    {
+        IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+        AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+        AssetRegistry.OnAssetRemoved().Remove(AssetRemovedHandle);
+        AssetRegistry.OnAssetRenamed().Remove(AssetRenamedHandle);
+    }
+
+    Entries.Empty();
+    NameToId.Empty();
+    PathToId.Empty();
+    bDirty = true;
+}
+
+void FSpirrowBridgeClassHierarchyCache::OnModulesChanged(FName ModuleName, EModuleChangeReason Reason)
+{
+    if (Reason == EModuleChangeReason::ModuleLoaded || Reason == EModuleChangeReason::ModuleUnloaded)
+    {
+        bDirty = true;
+    }
+}
+
+void FSpirrowBridgeClassHierarchyCache::OnBlueprintCompiled()
+{
+    bDirty = true;
+}
+
+void FSpirrowBridgeClassHierarchyCache::OnAssetChanged(const FAssetData& AssetData)
+{
+    if (!bDirty && AssetData.IsInstanceOf(UBlueprint::StaticClass()))
+    {
+        bDirty = true;
+    }
+}
+
+void FSpirrowBridgeClassHierarchyCache::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    OnAssetChanged(AssetData);
+}
+
+void FSpirrowBridgeClassHierarchyCache::EnsureBuilt()
+{
+    if (bDirty)
+    {
+        Rebuild();
+    }
+}
+
+int32 FSpirrowBridgeClassHierarchyCache::FindClassId(const FString& NameOrPath) const
+{
+    if (NameOrPath.IsEmpty())
+    {
+        return INDEX_NONE;
+    }
+
+    if (NameOrPath.StartsWith(TEXT("/")))
+    {
+        const int32* Id = PathToId.Find(FName(*NameOrPath));
+        return Id ? *Id : INDEX_NONE;
+    }
+
+    // Accept "Actor", "AActor", "UserWidget", "UUserWidget" the same way the
+    // original scan did (exact, with an added A prefix, or with the prefix stripped)
+    const FString Candidates[] = { NameOrPath, TEXT("A") + NameOrPath, NameOrPath.Mid(1) };
+    for (const FString& Candidate : Candidates)
+    {
+        if (const int32* Id = NameToId.Find(FName(*Candidate)))
+        {
+            return *Id;
+        }
+    }
+    return INDEX_NONE;
+}
+
+int32 FSpirrowBridgeClassHierarchyCache::FindClassId(const UClass* Class) const
+{
+    if (!Class)
+    {
+        return INDEX_NONE;
+    }
+    const int32* Id = PathToId.Find(FName(*Class->GetPathName()));
+    return Id ? *Id : INDEX_NONE;
+}
+
+int32 FSpirrowBridgeClassHierarchyCache::FindModuleId(FName ModuleName) const
+{
+    const int32* Id = ModuleToId.Find(ModuleName);
+    return Id ? *Id : INDEX_NONE;
+}
+
+FName FSpirrowBridgeClassHierarchyCache::GetModuleName(int32 ModuleId) const
+{
+    return Modules.IsValidIndex(ModuleId) ? Modules[ModuleId] : NAME_None;
+}
+
+bool FSpirrowBridgeClassHierarchyCache::IsEngineModule(int32 ModuleId) const
+{
+    return EngineModules.IsValidIndex(ModuleId) && EngineModules[ModuleId];
+}
+
+void FSpirrowBridgeClassHierarchyCache::Rebuild()
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    TArray<FPendingEntry> Pending;
+    TMap<FName, int32> PendingByPath;
+
+    Modules.Reset();
+    ModuleToId.Reset();
+    EngineModules.Reset();
+
+    auto InternModule = [this](FName ModuleName) -> int32
+    {
+        if (ModuleName.IsNone())
+        {
+            return INDEX_NONE;
+        }
+        if (const int32* Existing = ModuleToId.Find(ModuleName))
+        {
+            return *Existing;
+        }
+
+        const int32 NewId = Modules.Add(ModuleName);
+        ModuleToId.Add(ModuleName, NewId);
+
+        bool bHidden = false;
+        for (const TCHAR* HiddenModule : HiddenEngineModules)
+        {
+            if (ModuleName == FName(HiddenModule))
+            {
+                bHidden = true;
+                break;
+            }
+        }
+        EngineModules.Add(bHidden);
+        return NewId;
+    };
+
+    // === Native classes ===
+    // Blueprint generated, skeleton and REINST classes are never CLASS_Native,
+    // so they are excluded here and Blueprints come from the asset registry instead.
+    for (TObjectIterator<UClass> ClassIt; ClassIt; ++ClassIt)
+    {
+        UClass* Class = *ClassIt;
+        if (!Class || !Class->HasAnyClassFlags(CLASS_Native) || Class->HasAnyClassFlags(CLASS_NewerVersionExists))
+        {
+            continue;
+        }
+
+        FPendingEntry& Item = Pending.AddDefaulted_GetRef();
+        Item.Entry.Name = Class->GetFName();
+        Item.Entry.Path = Class->GetPathName();
+        Item.Entry.ModuleId = InternModule(ExtractScriptModule(Item.Entry.Path));
+        if (UClass* SuperClass = Class->GetSuperClass())
+        {
+            Item.ParentPath = FName(*SuperClass->GetPathName());
+        }
+        PendingByPath.Add(FName(*Item.Entry.Path), Pending.Num() - 1);
+    }
+
+    // === Blueprint assets (tag data only, nothing is loaded) ===
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+    FARFilter Filter;
+    Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+    Filter.bRecursiveClasses = true;
+
+    TArray<FAssetData> BlueprintAssets;
+    AssetRegistry.GetAssets(Filter, BlueprintAssets);
+
+    static const FString GameRoot = TEXT("/Game/");
+    for (const FAssetData& Asset : BlueprintAssets)
+    {
+        FString GeneratedClassPath;
+        if (!Asset.GetTagValue(FBlueprintTags::GeneratedClassPath, GeneratedClassPath))
+        {
+            // Fall back to the conventional generated class path
+            GeneratedClassPath = FString::Printf(TEXT("%s_C"), *Asset.GetObjectPathString());
+        }
+        GeneratedClassPath = FPackageName::ExportTextPathToObjectPath(GeneratedClassPath);
+
+        const FName GeneratedPathName(*GeneratedClassPath);
+        if (PendingByPath.Contains(GeneratedPathName))
+        {
+            continue;
+        }
+
+        FString ParentClassPath;
+        Asset.GetTagValue(FBlueprintTags::ParentClassPath, ParentClassPath);
+
+        FPendingEntry& Item = Pending.AddDefaulted_GetRef();
+        Item.Entry.Name = FName(*FPackageName::ObjectPathToObjectName(GeneratedClassPath));
+        Item.Entry.Path = Asset.GetObjectPathString();
+        Item.Entry.AssetName = Asset.AssetName;
+        Item.Entry.bIsBlueprint = true;
+        Item.Entry.bIsGameContent = Item.Entry.Path.StartsWith(GameRoot);
+        if (!ParentClassPath.IsEmpty())
+        {
+            Item.ParentPath = FName(*FPackageName::ExportTextPathToObjectPath(ParentClassPath));
+        }
+        PendingByPath.Add(GeneratedPathName, Pending.Num() - 1);
+    }
+
+    // === Link children to parents ===
+    TArray<int32> Roots;
+    for (int32 Index = 0; Index < Pending.Num(); ++Index)
+    {
+        const int32* ParentIndex = Pending[Index].ParentPath.IsNone() ? nullptr : PendingByPath.Find(Pending[Index].ParentPath);
+        if (ParentIndex && *ParentIndex != Index)
+        {
+            Pending[*ParentIndex].Children.Add(Index);
+        }
+        else
+        {
+            Roots.Add(Index);
+        }
+    }
+
+    // === Assign pre-order IDs (iterative DFS) ===
+    Entries.Reset(Pending.Num());
+    NameToId.Reset();
+    PathToId.Reset();
+
+    struct FStackFrame
+    {
+        int32 PendingIndex;
+        int32 ParentId;
+        int32 NextChild;
+        int32 Id;
+    };
+
+    TArray<FStackFrame> Stack;
+    for (const int32 RootIndex : Roots)
+    {
+        Stack.Add({ RootIndex, INDEX_NONE, 0, INDEX_NONE });
+        while (Stack.Num() > 0)
+        {
+            FStackFrame& Frame = Stack.Last();
+            if (Frame.Id == INDEX_NONE)
+            {
+                FClassEntry& Entry = Entries.Add_GetRef(Pending[Frame.PendingIndex].Entry);
+                Frame.Id = Entries.Num() - 1;
+                Entry.ParentId = Frame.ParentId;
+
+                NameToId.FindOrAdd(Entry.Name, Frame.Id);
+                PathToId.Add(FName(*Entry.Path), Frame.Id);
+                if (Entry.bIsBlueprint)
+                {
+                    NameToId.FindOrAdd(Entry.AssetName, Frame.Id);
+                }
+            }
+
+            const TArray<int32>& Children = Pending[Frame.PendingIndex].Children;
+            if (Frame.NextChild < Children.Num())
+            {
+                const int32 ChildIndex = Children[Frame.NextChild++];
+                const int32 ParentId = Frame.Id;
+                Stack.Add({ ChildIndex, ParentId, 0, INDEX_NONE });  // may invalidate Frame
+            }
+            else
+            {
+                Entries[Frame.Id].SubtreeEnd = Entries.Num();
+                Stack.Pop(EAllowShrinking::No);
+            }
+        }
+    }
+
+    // Blueprint generated class paths resolve to their asset entry as well
+    for (const TPair<FName, int32>& Pair : PendingByPath)
+    {
+        if (Pending[Pair.Value].Entry.bIsBlueprint)
+        {
+            if (const int32* Id = PathToId.Find(FName(*Pending[Pair.Value].Entry.Path)))
+            {
+                PathToId.Add(Pair.Key, *Id);
+            }
+        }
+    }
+
+    bDirty = false;
+    ++BuildCount;
+    LastBuildTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+    UE_LOG(LogTemp, Log, TEXT("SpirrowBridge: Class hierarchy rebuilt (%d classes, %d modules) in %.2f ms"),
+        Entries.Num(), Modules.Num(), LastBuildTimeMs);
+}
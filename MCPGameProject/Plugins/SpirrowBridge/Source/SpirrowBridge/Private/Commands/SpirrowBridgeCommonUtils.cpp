@@ -1,4 +1,6 @@
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeCompileQueue.h"
+#include "Commands/SpirrowBridgeNodeTemplateCache.h"
 #include "GameFramework/Actor.h"
 #include "Engine/Blueprint.h"
 #include "Engine/LevelScriptBlueprint.h"
@@ -15,6 +17,7 @@
 #include "K2Node_VariableSet.h"
 #include "K2Node_InputAction.h"
 #include "K2Node_Self.h"
+#include "K2Node_MacroInstance.h"
 #include "EdGraphSchema_K2.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/KismetEditorUtilities.h"
@@ -243,7 +246,9 @@ void FSpirrowBridgeCommonUtils::SafeCompileBlueprint(UBlueprint* Blueprint)
     else
     {
         // 既にコンパイル済みの場合はDirtyマークのみ（再コンパイルはクラッシュの原因になる）
+        // コンパイルは flush_compile_queue でまとめて行う
         Blueprint->MarkPackageDirty();
+        FSpirrowBridgeCompileQueue::Get().Enqueue(Blueprint);
     }
 }
 
@@ -434,58 +439,189 @@ bool FSpirrowBridgeCommonUtils::ConnectGraphNodes(UEdGraph* Graph, UEdGraphNode*
     return false;
 }
 
+DEFINE_LOG_CATEGORY_STATIC(LogSpirrowBridgePins, Log, All);
+
+namespace
+{
+    /**
+     * Pin layouts keyed by node class + the object/name that shapes its pins
+     * (target function, macro graph, variable). Entries only hint an index into
+     * Node->Pins and are validated on every hit, so a stale layout costs one
+     * rescan, never a wrong pin.
+     */
+    struct FPinLayoutKey
+    {
+        const UClass* NodeClass = nullptr;
+        const UObject* SignatureObject = nullptr;
+        FName SignatureName;
+        int32 NumPins = 0;
+
+        bool operator==(const FPinLayoutKey& Other) const
+        {
+            return NodeClass == Other.NodeClass && SignatureObject == Other.SignatureObject
+                && SignatureName == Other.SignatureName && NumPins == Other.NumPins;
+        }
+
+        friend uint32 GetTypeHash(const FPinLayoutKey& Key)
+        {
+            uint32 Hash = HashCombine(PointerHash(Key.NodeClass), PointerHash(Key.SignatureObject));
+            return HashCombine(HashCombine(Hash, GetTypeHash(Key.SignatureName)), ::GetTypeHash(Key.NumPins));
+        }
+    };
+
+    /** Pin name + direction (EGPD_MAX = either) -> index of the first matching pin */
+    using FPinLayout = TMap<TPair<FName, uint8>, int32>;
+
+    constexpr int32 MaxCachedPinLayouts = 4096;
+    TMap<FPinLayoutKey, FPinLayout> GPinLayouts;
+
+    FPinLayoutKey MakePinLayoutKey(const UEdGraphNode* Node)
+    {
+        FPinLayoutKey Key;
+        Key.NodeClass = Node->GetClass();
+        Key.NumPins = Node->Pins.Num();
+
+        if (const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+        {
+            Key.SignatureObject = CallNode->GetTargetFunction();
+        }
+        else if (const UK2Node_MacroInstance* MacroNode = Cast<UK2Node_MacroInstance>(Node))
+        {
+            Key.SignatureObject = MacroNode->GetMacroGraph();
+        }
+        else if (const UK2Node_Variable* VariableNode = Cast<UK2Node_Variable>(Node))
+        {
+            Key.SignatureObject = VariableNode->VariableReference.GetMemberParentClass();
+            Key.SignatureName = VariableNode->GetVarName();
+        }
+        else if (const UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
+        {
+            Key.SignatureObject = EventNode->EventReference.GetMemberParentClass();
+            Key.SignatureName = EventNode->GetFunctionName();
+        }
+        return Key;
+    }
+
+    FPinLayout BuildPinLayout(const UEdGraphNode* Node)
+    {
+        FPinLayout Layout;
+        Layout.Reserve(Node->Pins.Num() * 2);
+        for (int32 Index = 0; Index < Node->Pins.Num(); ++Index)
+        {
+            if (const UEdGraphPin* Pin = Node->Pins[Index])
+            {
+                // Keep the first pin per key: by-ref params have an input and an
+                // output pin with the same name, and the old scan returned the input
+                const TPair<FName, uint8> DirectionKey(Pin->PinName, static_cast<uint8>(Pin->Direction));
+                const TPair<FName, uint8> AnyKey(Pin->PinName, static_cast<uint8>(EGPD_MAX));
+                if (!Layout.Contains(DirectionKey))
+                {
+                    Layout.Add(DirectionKey, Index);
+                }
+                if (!Layout.Contains(AnyKey))
+                {
+                    Layout.Add(AnyKey, Index);
+                }
+            }
+        }
+        return Layout;
+    }
+
+    bool PinMatches(const UEdGraphPin* Pin, FName PinName, EEdGraphPinDirection Direction)
+    {
+        // FName equality is case-insensitive, matching the old exact + IgnoreCase passes
+        return Pin && Pin->PinName == PinName && (Direction == EGPD_MAX || Pin->Direction == Direction);
+    }
+
+    void LogAvailablePins(const UEdGraphNode* Node, const TCHAR* RequestedName, EEdGraphPinDirection Direction)
+    {
+        if (!UE_LOG_ACTIVE(LogSpirrowBridgePins, Verbose))
+        {
+            return;
+        }
+        UE_LOG(LogSpirrowBridgePins, Verbose, TEXT("FindPin: no pin '%s' (Direction: %d) in node '%s'"),
+            RequestedName, static_cast<int32>(Direction), *Node->GetName());
+        for (const UEdGraphPin* Pin : Node->Pins)
+        {
+            if (Pin)
+            {
+                UE_LOG(LogSpirrowBridgePins, Verbose, TEXT("  - Available pin: '%s', Direction: %d, Category: %s"),
+                    *Pin->PinName.ToString(), static_cast<int32>(Pin->Direction), *Pin->PinType.PinCategory.ToString());
+            }
+        }
+    }
+}
+
 UEdGraphPin* FSpirrowBridgeCommonUtils::FindPin(UEdGraphNode* Node, const FString& PinName, EEdGraphPinDirection Direction)
 {
     if (!Node)
     {
         return nullptr;
     }
-    
-    // Log all pins for debugging
-    UE_LOG(LogTemp, Display, TEXT("FindPin: Looking for pin '%s' (Direction: %d) in node '%s'"), 
-           *PinName, (int32)Direction, *Node->GetName());
-    
-    for (UEdGraphPin* Pin : Node->Pins)
+
+    // FNAME_Find: a name that was never registered cannot be a pin name, and
+    // lookups must not grow the name table
+    const FName Name(*PinName, FNAME_Find);
+    UEdGraphPin* Pin = Name.IsNone() ? nullptr : FindPinByName(Node, Name, Direction);
+    if (Pin)
     {
-        UE_LOG(LogTemp, Display, TEXT("  - Available pin: '%s', Direction: %d, Category: %s"), 
-               *Pin->PinName.ToString(), (int32)Pin->Direction, *Pin->PinType.PinCategory.ToString());
+        return Pin;
     }
-    
-    // First try exact match
-    for (UEdGraphPin* Pin : Node->Pins)
+
+    // Component / variable getters: fall back to the first data output pin
+    if (Direction == EGPD_Output && Cast<UK2Node_VariableGet>(Node) != nullptr)
     {
-        if (Pin->PinName.ToString() == PinName && (Direction == EGPD_MAX || Pin->Direction == Direction))
+        for (UEdGraphPin* Candidate : Node->Pins)
         {
-            UE_LOG(LogTemp, Display, TEXT("  - Found exact matching pin: '%s'"), *Pin->PinName.ToString());
-            return Pin;
+            if (Candidate && Candidate->Direction == EGPD_Output && Candidate->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec)
+            {
+                UE_LOG(LogSpirrowBridgePins, Verbose, TEXT("FindPin: '%s' resolved to fallback data output pin '%s'"),
+                    *PinName, *Candidate->PinName.ToString());
+                return Candidate;
+            }
         }
     }
-    
-    // If no exact match and we're looking for a component reference, try case-insensitive match
-    for (UEdGraphPin* Pin : Node->Pins)
+
+    LogAvailablePins(Node, *PinName, Direction);
+    return nullptr;
+}
+
+UEdGraphPin* FSpirrowBridgeCommonUtils::FindPinByName(UEdGraphNode* Node, FName PinName, EEdGraphPinDirection Direction)
+{
+    if (!Node || PinName.IsNone())
+    {
+        return nullptr;
+    }
+
+    const FPinLayoutKey Key = MakePinLayoutKey(Node);
+    FPinLayout* Layout = GPinLayouts.Find(Key);
+    if (!Layout)
+    {
+        if (GPinLayouts.Num() >= MaxCachedPinLayouts)
+        {
+            GPinLayouts.Reset();
+        }
+        Layout = &GPinLayouts.Add(Key, BuildPinLayout(Node));
+    }
+
+    if (const int32* Index = Layout->Find(TPair<FName, uint8>(PinName, static_cast<uint8>(Direction))))
     {
-        if (Pin->PinName.ToString().Equals(PinName, ESearchCase::IgnoreCase) && 
-            (Direction == EGPD_MAX || Pin->Direction == Direction))
+        UEdGraphPin* Pin = Node->Pins.IsValidIndex(*Index) ? Node->Pins[*Index] : nullptr;
+        if (PinMatches(Pin, PinName, Direction))
         {
-            UE_LOG(LogTemp, Display, TEXT("  - Found case-insensitive matching pin: '%s'"), *Pin->PinName.ToString());
             return Pin;
         }
     }
-    
-    // If we're looking for a component output and didn't find it by name, try to find the first data output pin
-    if (Direction == EGPD_Output && Cast<UK2Node_VariableGet>(Node) != nullptr)
+
+    // Layout miss or stale hint (e.g. split struct pins): scan and refresh
+    for (UEdGraphPin* Pin : Node->Pins)
     {
-        for (UEdGraphPin* Pin : Node->Pins)
+        if (PinMatches(Pin, PinName, Direction))
         {
-            if (Pin->Direction == EGPD_Output && Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec)
-            {
-                UE_LOG(LogTemp, Display, TEXT("  - Found fallback data output pin: '%s'"), *Pin->PinName.ToString());
-                return Pin;
-            }
+            *Layout = BuildPinLayout(Node);
+            return Pin;
         }
     }
-    
-    UE_LOG(LogTemp, Warning, TEXT("  - No matching pin found for '%s'"), *PinName);
     return nullptr;
 }
 
@@ -1526,7 +1662,7 @@ UK2Node_VariableSet* FSpirrowBridgeCommonUtils::SpawnExternalPropertySetNode(
         return nullptr;
     }
 
-    FProperty* Prop = OwnerClass->FindPropertyByName(PropertyName);
+    FProperty* Prop = FSpirrowBridgeNodeTemplateCache::Get().FindProperty(OwnerClass, PropertyName);
     if (!Prop)
     {
         OutError = FString::Printf(TEXT("Property not found: %s on %s"), *PropertyName.ToString(), *OwnerClass->GetName());
@@ -1577,7 +1713,7 @@ UK2Node_VariableGet* FSpirrowBridgeCommonUtils::SpawnExternalPropertyGetNode(
         return nullptr;
     }
 
-    FProperty* Prop = OwnerClass->FindPropertyByName(PropertyName);
+    FProperty* Prop = FSpirrowBridgeNodeTemplateCache::Get().FindProperty(OwnerClass, PropertyName);
     if (!Prop)
     {
         OutError = FString::Printf(TEXT("Property not found: %s on %s"), *PropertyName.ToString(), *OwnerClass->GetName());
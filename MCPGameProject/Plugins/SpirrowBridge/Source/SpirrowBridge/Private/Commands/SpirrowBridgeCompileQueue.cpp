@@ -0,0 +1,328 @@
+#include "Commands/SpirrowBridgeCompileQueue.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "BlueprintCompilationManager.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Kismet2/CompilerResultsLog.h"
+#include "EditorAssetLibrary.h"
+#include "UObject/UObjectGlobals.h"
+#include "HAL/PlatformTime.h"
+
+FSpirrowBridgeCompileQueue& FSpirrowBridgeCompileQueue::Get()
+{
+    static FSpirrowBridgeCompileQueue Instance;
+    return Instance;
+}
+
+void FSpirrowBridgeCompileQueue::Shutdown()
+{
+    Pending.Empty();
+    PendingSaves.Empty();
+    bBatchOpen = false;
+}
+
+void FSpirrowBridgeCompileQueue::Enqueue(UBlueprint* Blueprint)
+{
+    if (!Blueprint)
+    {
+        return;
+    }
+
+    Pending.RemoveAll([](const TWeakObjectPtr<UBlueprint>& Entry) { return !Entry.IsValid(); });
+    Pending.AddUnique(Blueprint);
+}
+
+bool FSpirrowBridgeCompileQueue::RequestCompile(UBlueprint* Blueprint, bool bSaveAfterCompile)
+{
+    if (!Blueprint)
+    {
+        return false;
+    }
+
+    if (bBatchOpen)
+    {
+        Enqueue(Blueprint);
+        if (bSaveAfterCompile)
+        {
+            PendingSaves.AddUnique(Blueprint);
+        }
+        return true;
+    }
+
+    FKismetEditorUtilities::CompileBlueprint(Blueprint);
+    Pending.Remove(Blueprint);
+    if (bSaveAfterCompile)
+    {
+        UEditorAssetLibrary::SaveLoadedAsset(Blueprint, /*bOnlyIfIsDirty=*/false);
+    }
+    return false;
+}
+
+int32 FSpirrowBridgeCompileQueue::CancelBatch(bool bDiscardPending)
+{
+    bBatchOpen = false;
+    if (!bDiscardPending)
+    {
+        return 0;
+    }
+
+    const int32 NumDropped = GetPending().Num();
+    Pending.Reset();
+    PendingSaves.Reset();
+    return NumDropped;
+}
+
+TArray<UBlueprint*> FSpirrowBridgeCompileQueue::GetPending() const
+{
+    TArray<UBlueprint*> Blueprints;
+    Blueprints.Reserve(Pending.Num());
+    for (const TWeakObjectPtr<UBlueprint>& Entry : Pending)
+    {
+        if (UBlueprint* Blueprint = Entry.Get())
+        {
+            Blueprints.Add(Blueprint);
+        }
+    }
+    return Blueprints;
+}
+
+TArray<UBlueprint*> FSpirrowBridgeCompileQueue::SortByDependency(const TArray<UBlueprint*>& Blueprints)
+{
+    const int32 Num = Blueprints.Num();
+    TMap<const UBlueprint*, int32> IndexOf;
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        IndexOf.Add(Blueprints[Index], Index);
+    }
+
+    TArray<TArray<int32>> Dependents;
+    TArray<int32> InDegree;
+    TArray<int32> HierarchyDepth;
+    Dependents.SetNum(Num);
+    InDegree.SetNumZeroed(Num);
+    HierarchyDepth.SetNumZeroed(Num);
+
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        UBlueprint* Blueprint = Blueprints[Index];
+        TSet<const UBlueprint*> Dependencies;
+
+        for (UClass* Parent = Blueprint->ParentClass; Parent; Parent = Parent->GetSuperClass())
+        {
+            if (const UBlueprint* ParentBlueprint = UBlueprint::GetBlueprintFromClass(Parent))
+            {
+                Dependencies.Add(ParentBlueprint);
+                ++HierarchyDepth[Index];
+            }
+        }
+
+        // Function calls, variable types, casts... into other Blueprints
+        TSet<TWeakObjectPtr<UBlueprint>> BlueprintDependencies;
+        TSet<TWeakObjectPtr<UStruct>> StructDependencies;
+        FBlueprintEditorUtils::GatherDependencies(Blueprint, BlueprintDependencies, StructDependencies);
+        for (const TWeakObjectPtr<UBlueprint>& Dependency : BlueprintDependencies)
+        {
+            Dependencies.Add(Dependency.Get());
+        }
+
+        for (const UBlueprint* Dependency : Dependencies)
+        {
+            const int32* DependencyIndex = IndexOf.Find(Dependency);
+            if (DependencyIndex && *DependencyIndex != Index)
+            {
+                Dependents[*DependencyIndex].Add(Index);
+                ++InDegree[Index];
+            }
+        }
+    }
+
+    // Kahn's algorithm, stable with respect to queue order
+    TArray<UBlueprint*> Sorted;
+    Sorted.Reserve(Num);
+    TArray<bool> Emitted;
+    Emitted.SetNumZeroed(Num);
+    TArray<int32> Ready;
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        if (InDegree[Index] == 0)
+        {
+            Ready.Add(Index);
+        }
+    }
+    for (int32 Cursor = 0; Cursor < Ready.Num(); ++Cursor)
+    {
+        const int32 Index = Ready[Cursor];
+        Sorted.Add(Blueprints[Index]);
+        Emitted[Index] = true;
+        for (const int32 Dependent : Dependents[Index])
+        {
+            if (--InDegree[Dependent] == 0)
+            {
+                Ready.Add(Dependent);
+            }
+        }
+    }
+
+    // Mutually dependent Blueprints (A calls B, B calls A): parents first, then queue order
+    TArray<int32> Remaining;
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        if (!Emitted[Index])
+        {
+            Remaining.Add(Index);
+        }
+    }
+    Remaining.StableSort([&HierarchyDepth](int32 A, int32 B)
+    {
+        return HierarchyDepth[A] < HierarchyDepth[B];
+    });
+    for (const int32 Index : Remaining)
+    {
+        Sorted.Add(Blueprints[Index]);
+    }
+    return Sorted;
+}
+
+FString FSpirrowBridgeCompileQueue::StatusToString(const UBlueprint* Blueprint)
+{
+    switch (Blueprint->Status)
+    {
+        case BS_Dirty:                  return TEXT("dirty");
+        case BS_Error:                  return TEXT("error");
+        case BS_UpToDate:               return TEXT("up_to_date");
+        case BS_BeingCreated:           return TEXT("being_created");
+        case BS_UpToDateWithWarnings:   return TEXT("up_to_date_with_warnings");
+        default:                        return TEXT("unknown");
+    }
+}
+
+void FSpirrowBridgeCompileQueue::CollectNodeErrors(UBlueprint* Blueprint, FCompileEntryResult& OutEntry)
+{
+    TArray<UEdGraph*> Graphs;
+    Blueprint->GetAllGraphs(Graphs);
+    for (const UEdGraph* Graph : Graphs)
+    {
+        for (const UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (!Node || !Node->bHasCompilerMessage)
+            {
+                continue;
+            }
+            if (Node->ErrorType <= EMessageSeverity::Error)
+            {
+                OutEntry.Errors.Add(FString::Printf(TEXT("%s: %s"),
+                    *Node->GetNodeTitle(ENodeTitleType::ListView).ToString(), *Node->ErrorMsg));
+            }
+            else if (Node->ErrorType == EMessageSeverity::Warning)
+            {
+                ++OutEntry.NumWarnings;
+            }
+        }
+    }
+}
+
+FSpirrowBridgeCompileQueue::FFlushResult FSpirrowBridgeCompileQueue::Flush(EFlushMode Mode)
+{
+    FFlushResult Result;
+    const TArray<UBlueprint*> Blueprints = SortByDependency(GetPending());
+    const TArray<TWeakObjectPtr<UBlueprint>> ToSave = MoveTemp(PendingSaves);
+    Pending.Reset();
+    PendingSaves.Reset();
+    bBatchOpen = false;
+
+    if (Blueprints.Num() == 0)
+    {
+        return Result;
+    }
+
+    const double FlushStart = FPlatformTime::Seconds();
+    auto IsUpToDate = [](const UBlueprint* Blueprint)
+    {
+        return Blueprint->Status == BS_UpToDate || Blueprint->Status == BS_UpToDateWithWarnings;
+    };
+
+    if (Mode == EFlushMode::Batch)
+    {
+        // The compilation manager orders the batch itself and compiles each class once
+        for (UBlueprint* Blueprint : Blueprints)
+        {
+            FBlueprintCompilationManager::QueueForCompilation(Blueprint);
+        }
+        FBlueprintCompilationManager::FlushCompilationQueueAndReinstance();
+
+        for (UBlueprint* Blueprint : Blueprints)
+        {
+            FCompileEntryResult& Entry = Result.Entries.AddDefaulted_GetRef();
+            Entry.Name = Blueprint->GetName();
+            Entry.Path = Blueprint->GetPathName();
+            Entry.Status = StatusToString(Blueprint);
+            CollectNodeErrors(Blueprint, Entry);
+            ++Result.NumCompiled;
+            Result.NumFailed += Blueprint->Status == BS_Error ? 1 : 0;
+        }
+    }
+    else
+    {
+        TSet<const UBlueprint*> DirtyAtStart;
+        for (const UBlueprint* Blueprint : Blueprints)
+        {
+            if (!IsUpToDate(Blueprint))
+            {
+                DirtyAtStart.Add(Blueprint);
+            }
+        }
+
+        for (UBlueprint* Blueprint : Blueprints)
+        {
+            FCompileEntryResult& Entry = Result.Entries.AddDefaulted_GetRef();
+            Entry.Name = Blueprint->GetName();
+            Entry.Path = Blueprint->GetPathName();
+
+            // Recompiled as a dependent of an earlier entry: don't compile it twice
+            if (DirtyAtStart.Contains(Blueprint) && IsUpToDate(Blueprint))
+            {
+                Entry.Status = TEXT("compiled_as_dependent");
+                continue;
+            }
+
+            FCompilerResultsLog CompileLog;
+            const double Start = FPlatformTime::Seconds();
+            FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::SkipGarbageCollection, &CompileLog);
+            Entry.TimeMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+            for (const TSharedRef<FTokenizedMessage>& Message : CompileLog.Messages)
+            {
+                if (Message->GetSeverity() == EMessageSeverity::Error)
+                {
+                    Entry.Errors.Add(Message->ToText().ToString());
+                }
+            }
+            Entry.NumWarnings = CompileLog.NumWarnings;
+            Entry.Status = StatusToString(Blueprint);
+            ++Result.NumCompiled;
+            Result.NumFailed += Blueprint->Status == BS_Error ? 1 : 0;
+        }
+
+        // One GC for the whole batch instead of one per compile
+        if (Result.NumCompiled > 0)
+        {
+            CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+        }
+    }
+
+    // Saves requested while the batch was open, now that the compiled state is final
+    for (const TWeakObjectPtr<UBlueprint>& Entry : ToSave)
+    {
+        if (UBlueprint* Blueprint = Entry.Get())
+        {
+            Result.NumSaved += UEditorAssetLibrary::SaveLoadedAsset(Blueprint, /*bOnlyIfIsDirty=*/false) ? 1 : 0;
+        }
+    }
+
+    Result.TotalTimeMs = (FPlatformTime::Seconds() - FlushStart) * 1000.0;
+    UE_LOG(LogTemp, Log, TEXT("SpirrowBridge: Compile queue flushed %d Blueprint(s), %d failed, %.1f ms"),
+        Result.NumCompiled, Result.NumFailed, Result.TotalTimeMs);
+    return Result;
+}
@@ -64,6 +64,14 @@ TSharedPtr<FJsonObject> FSpirrowBridgeEQSCommands::HandleCommand(const FString&
 	{
 		return HandleListEQSAssets(Params);
 	}
+	else if (CommandType == TEXT("run_eqs_query"))
+	{
+		return HandleRunEQSQuery(Params);
+	}
+	else if (CommandType == TEXT("analyze_eqs_query"))
+	{
+		return HandleAnalyzeEQSQuery(Params);
+	}
 
 	return FSpirrowBridgeCommonUtils::CreateErrorResponse(
 		ESpirrowErrorCode::UnknownCommand,
@@ -662,6 +670,32 @@ EEnvTestPurpose::Type FSpirrowBridgeEQSCommands::GetTestPurpose(const FString& P
 	return EEnvTestPurpose::Score;
 }
 
+FString FSpirrowBridgeEQSCommands::GetTestPurposeString(EEnvTestPurpose::Type Purpose)
+{
+	switch (Purpose)
+	{
+	case EEnvTestPurpose::Filter:
+		return TEXT("Filter");
+	case EEnvTestPurpose::FilterAndScore:
+		return TEXT("FilterAndScore");
+	default:
+		return TEXT("Score");
+	}
+}
+
+FString FSpirrowBridgeEQSCommands::GetTestCostString(EEnvTestCost::Type Cost)
+{
+	switch (Cost)
+	{
+	case EEnvTestCost::Low:
+		return TEXT("Low");
+	case EEnvTestCost::Medium:
+		return TEXT("Medium");
+	default:
+		return TEXT("High");
+	}
+}
+
 TSharedPtr<FJsonObject> FSpirrowBridgeEQSCommands::EQSQueryToJson(UEnvQuery* Query)
 {
 	if (!Query)
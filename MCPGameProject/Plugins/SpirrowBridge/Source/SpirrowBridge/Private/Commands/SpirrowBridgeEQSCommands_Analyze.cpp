@@ -0,0 +1,465 @@
+#include "Commands/SpirrowBridgeEQSCommands.h"
+#include "Commands/SpirrowBridgeCommonUtils.h"
+
+// Editor / asset includes
+#include "Editor.h"
+#include "EngineUtils.h"
+#include "UObject/SavePackage.h"
+
+// EQS includes
+#include "EnvironmentQuery/EnvQuery.h"
+#include "EnvironmentQuery/EnvQueryOption.h"
+#include "EnvironmentQuery/EnvQueryGenerator.h"
+#include "EnvironmentQuery/EnvQueryTest.h"
+#include "EnvironmentQuery/EnvQueryManager.h"
+#include "EnvironmentQuery/EnvQueryTypes.h"
+
+// Generator includes
+#include "EnvironmentQuery/Generators/EnvQueryGenerator_SimpleGrid.h"
+#include "EnvironmentQuery/Generators/EnvQueryGenerator_Donut.h"
+#include "EnvironmentQuery/Generators/EnvQueryGenerator_OnCircle.h"
+#include "EnvironmentQuery/Generators/EnvQueryGenerator_ActorsOfClass.h"
+#include "EnvironmentQuery/Generators/EnvQueryGenerator_CurrentLocation.h"
+#include "EnvironmentQuery/Generators/EnvQueryGenerator_PathingGrid.h"
+
+// ===== analyze_eqs_query =====
+//
+// Static analysis of the asset: item counts come from the generator's default parameter
+// values (per context location), test cost from each test's own cost class.
+//
+// The authored array order is not the execution order. When the engine builds a query
+// instance it stable-sorts the tests by cost class, then filters before scoring tests,
+// then TestOrder, so a cheap filter authored last still runs first. Findings and cost
+// figures use that order.
+//
+// Filters commute and summed scores do not depend on test order, but a scoring test
+// normalizes over the items still valid when it runs unless both its clamps are set.
+// The hazard is therefore the engine's sort moving a filter across such a test, which
+// changes its scores relative to the authored order.
+//
+// Applying rewrites the array and TestOrder to the execution order. Nothing runs
+// differently afterwards; the asset just reads in the order it runs.
+
+namespace
+{
+	/** Relative per-item weight of a cost class, used for the estimated_cost_units figures */
+	double GetCostWeight(EEnvTestCost::Type Cost)
+	{
+		switch (Cost)
+		{
+		case EEnvTestCost::Low: return 1.0;
+		case EEnvTestCost::Medium: return 5.0;
+		case EEnvTestCost::High: return 25.0;
+		default: return 1.0;
+		}
+	}
+
+	bool IsFilteringTest(const UEnvQueryTest* Test)
+	{
+		return Test->TestPurpose != EEnvTestPurpose::Score;
+	}
+
+	/** True when the test's normalized score depends on which items are still valid */
+	bool HasItemDependentNormalization(const UEnvQueryTest* Test)
+	{
+		return Test->TestPurpose != EEnvTestPurpose::Filter
+			&& (Test->ClampMinType == EEnvQueryTestClamping::None || Test->ClampMaxType == EEnvQueryTestClamping::None);
+	}
+
+	/** True when swapping the two tests could change the query's scores */
+	bool MustKeepRelativeOrder(const UEnvQueryTest* A, const UEnvQueryTest* B)
+	{
+		return (IsFilteringTest(A) && HasItemDependentNormalization(B))
+			|| (IsFilteringTest(B) && HasItemDependentNormalization(A));
+	}
+
+	struct FGeneratorEstimate
+	{
+		/** Items per context location; INDEX_NONE when it cannot be known from the asset */
+		int32 Items = INDEX_NONE;
+
+		/** exact, upper_bound, world_upper_bound or unknown */
+		FString Kind = TEXT("unknown");
+
+		/** A parameter is bound to a query param, so the default value was used */
+		bool bUsesDynamicParams = false;
+	};
+
+	FGeneratorEstimate EstimateGeneratorItems(const UEnvQueryGenerator* Generator)
+	{
+		FGeneratorEstimate Estimate;
+
+		if (const UEnvQueryGenerator_SimpleGrid* Grid = Cast<UEnvQueryGenerator_SimpleGrid>(Generator))
+		{
+			// Same item count as the generator: one row per SpaceBetween across the full extent
+			const float Spacing = FMath::Max(Grid->SpaceBetween.DefaultValue, 1.0f);
+			const int32 ItemsPerRow = FMath::TruncToInt((Grid->GridSize.DefaultValue * 2.0f / Spacing) + 1);
+			Estimate.Items = ItemsPerRow * ItemsPerRow;
+			Estimate.bUsesDynamicParams = Grid->GridSize.IsDynamic() || Grid->SpaceBetween.IsDynamic();
+
+			// Pathing grid drops points beyond the path distance after generation
+			Estimate.Kind = Generator->IsA<UEnvQueryGenerator_PathingGrid>() ? TEXT("upper_bound") : TEXT("exact");
+		}
+		else if (const UEnvQueryGenerator_Donut* Donut = Cast<UEnvQueryGenerator_Donut>(Generator))
+		{
+			Estimate.Items = FMath::Max(Donut->NumberOfRings.DefaultValue, 0) * FMath::Max(Donut->PointsPerRing.DefaultValue, 0);
+			Estimate.Kind = TEXT("exact");
+			Estimate.bUsesDynamicParams = Donut->NumberOfRings.IsDynamic() || Donut->PointsPerRing.IsDynamic();
+		}
+		else if (const UEnvQueryGenerator_OnCircle* Circle = Cast<UEnvQueryGenerator_OnCircle>(Generator))
+		{
+			if (Circle->PointOnCircleSpacingMethod == EPointOnCircleSpacingMethod::ByNumberOfPoints)
+			{
+				Estimate.Items = FMath::Max(Circle->NumberOfPoints.DefaultValue, 0);
+				Estimate.bUsesDynamicParams = Circle->NumberOfPoints.IsDynamic();
+			}
+			else
+			{
+				const float ArcFraction = Circle->bDefineArc ? FMath::Clamp(Circle->ArcAngle.DefaultValue / 360.0f, 0.0f, 1.0f) : 1.0f;
+				const float Circumference = 2.0f * PI * Circle->CircleRadius.DefaultValue * ArcFraction;
+				Estimate.Items = FMath::CeilToInt(Circumference / FMath::Max(Circle->SpaceBetween.DefaultValue, 1.0f));
+				Estimate.bUsesDynamicParams = Circle->CircleRadius.IsDynamic() || Circle->SpaceBetween.IsDynamic();
+			}
+			Estimate.Kind = TEXT("exact");
+		}
+		else if (Generator->IsA<UEnvQueryGenerator_CurrentLocation>())
+		{
+			Estimate.Items = 1;
+			Estimate.Kind = TEXT("exact");
+		}
+		else if (const UEnvQueryGenerator_ActorsOfClass* ActorsOfClass = Cast<UEnvQueryGenerator_ActorsOfClass>(Generator))
+		{
+			// Radius and context are runtime data; count every actor of the class in the editor world
+			UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+			if (World && ActorsOfClass->SearchedActorClass)
+			{
+				int32 NumActors = 0;
+				for (TActorIterator<AActor> It(World, ActorsOfClass->SearchedActorClass); It; ++It)
+				{
+					++NumActors;
+				}
+				Estimate.Items = NumActors;
+				Estimate.Kind = TEXT("world_upper_bound");
+			}
+		}
+
+		return Estimate;
+	}
+
+	/** The order the engine runs the tests in: cost class, then filters first, then TestOrder */
+	TArray<int32> ComputeExecutionOrder(const TArray<UEnvQueryTest*>& Tests)
+	{
+		TArray<int32> Order;
+		for (int32 LocalIndex = 0; LocalIndex < Tests.Num(); LocalIndex++)
+		{
+			Order.Add(LocalIndex);
+		}
+
+		Order.StableSort([&Tests](int32 A, int32 B)
+		{
+			const UEnvQueryTest* TestA = Tests[A];
+			const UEnvQueryTest* TestB = Tests[B];
+			if (TestA->Cost.GetValue() != TestB->Cost.GetValue())
+			{
+				return TestA->Cost.GetValue() < TestB->Cost.GetValue();
+			}
+			if (IsFilteringTest(TestA) != IsFilteringTest(TestB))
+			{
+				return IsFilteringTest(TestA);
+			}
+			return TestA->TestOrder < TestB->TestOrder;
+		});
+
+		return Order;
+	}
+
+	/** Sum of items reaching each test times its cost weight, assuming each filter keeps PassRate of its input */
+	double EstimateCostUnits(const TArray<UEnvQueryTest*>& Tests, const TArray<int32>& Order, int32 NumItems, double PassRate)
+	{
+		double Items = FMath::Max(NumItems, 1);
+		double Units = 0.0;
+		for (int32 TestIndex : Order)
+		{
+			Units += Items * GetCostWeight(Tests[TestIndex]->Cost);
+			if (IsFilteringTest(Tests[TestIndex]))
+			{
+				Items *= PassRate;
+			}
+		}
+		return Units;
+	}
+
+	TSharedPtr<FJsonObject> MakeFinding(const FString& Type, const FString& Severity, int32 TestIndex, int32 OtherTestIndex, const FString& Message)
+	{
+		TSharedPtr<FJsonObject> Finding = MakeShareable(new FJsonObject);
+		Finding->SetStringField(TEXT("type"), Type);
+		Finding->SetStringField(TEXT("severity"), Severity);
+		Finding->SetNumberField(TEXT("test_index"), TestIndex);
+		if (OtherTestIndex != INDEX_NONE)
+		{
+			Finding->SetNumberField(TEXT("other_test_index"), OtherTestIndex);
+		}
+		Finding->SetStringField(TEXT("message"), Message);
+		return Finding;
+	}
+
+	TArray<TSharedPtr<FJsonValue>> IndicesToJsonArray(const TArray<int32>& Indices)
+	{
+		TArray<TSharedPtr<FJsonValue>> Array;
+		for (int32 Index : Indices)
+		{
+			Array.Add(MakeShareable(new FJsonValueNumber(Index)));
+		}
+		return Array;
+	}
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeEQSCommands::HandleAnalyzeEQSQuery(const TSharedPtr<FJsonObject>& Params)
+{
+	// Validate required parameters
+	FString QueryName;
+	if (auto Error = FSpirrowBridgeCommonUtils::ValidateRequiredString(Params, TEXT("query_name"), QueryName))
+	{
+		return Error;
+	}
+
+	FString Path;
+	FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("path"), Path, TEXT("/Game/AI/EQS"));
+	bool bApply = false;
+	FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("apply"), bApply, false);
+
+	double PassRate = 0.5;
+	FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("filter_pass_rate"), PassRate, 0.5);
+	PassRate = FMath::Clamp(PassRate, 0.0, 1.0);
+
+	double LargeItemCountDouble = 500.0;
+	FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("large_item_count"), LargeItemCountDouble, 500.0);
+	const int32 LargeItemCount = FMath::Max(1, static_cast<int32>(LargeItemCountDouble));
+
+	// Find the EQS Query
+	UEnvQuery* Query = FindEQSQueryAsset(QueryName, Path);
+	if (!Query)
+	{
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::AssetNotFound,
+			FString::Printf(TEXT("EQS Query not found: %s at %s"), *QueryName, *Path)
+		);
+	}
+
+	TArray<TSharedPtr<FJsonValue>> OptionsArray;
+	TArray<TPair<int32, TArray<int32>>> Reorders;
+	int32 NumFindings = 0;
+	int32 NumErrors = 0;
+
+	const TArray<UEnvQueryOption*>& Options = Query->GetOptions();
+	for (int32 OptionIndex = 0; OptionIndex < Options.Num(); OptionIndex++)
+	{
+		const UEnvQueryOption* Option = Options[OptionIndex];
+		TSharedPtr<FJsonObject> OptionObj = MakeShareable(new FJsonObject);
+		OptionObj->SetNumberField(TEXT("generator_index"), OptionIndex);
+		TArray<TSharedPtr<FJsonValue>> FindingsArray;
+
+		if (!Option || !Option->Generator)
+		{
+			FindingsArray.Add(MakeShareable(new FJsonValueObject(
+				MakeFinding(TEXT("missing_generator"), TEXT("error"), INDEX_NONE, INDEX_NONE, TEXT("Option has no generator; the engine skips it")))));
+			OptionObj->SetArrayField(TEXT("findings"), FindingsArray);
+			OptionsArray.Add(MakeShareable(new FJsonValueObject(OptionObj)));
+			NumFindings++;
+			NumErrors++;
+			continue;
+		}
+
+		const UEnvQueryGenerator* Generator = Option->Generator;
+		const FGeneratorEstimate Estimate = EstimateGeneratorItems(Generator);
+		OptionObj->SetStringField(TEXT("generator_class"), Generator->GetClass()->GetName());
+		if (Estimate.Items != INDEX_NONE)
+		{
+			OptionObj->SetNumberField(TEXT("estimated_items"), Estimate.Items);
+		}
+		else
+		{
+			OptionObj->SetField(TEXT("estimated_items"), MakeShareable(new FJsonValueNull()));
+		}
+		OptionObj->SetStringField(TEXT("estimate_kind"), Estimate.Kind);
+		OptionObj->SetBoolField(TEXT("uses_dynamic_params"), Estimate.bUsesDynamicParams);
+
+		// Tests the engine would drop (null or unsupported item type) are reported and left out of the ordering
+		TArray<UEnvQueryTest*> Tests;
+		TArray<int32> AssetIndices;
+		TArray<TSharedPtr<FJsonValue>> TestsArray;
+		for (int32 TestIndex = 0; TestIndex < Option->Tests.Num(); TestIndex++)
+		{
+			UEnvQueryTest* Test = Option->Tests[TestIndex];
+			if (!Test)
+			{
+				FindingsArray.Add(MakeShareable(new FJsonValueObject(
+					MakeFinding(TEXT("missing_test"), TEXT("error"), TestIndex, INDEX_NONE, TEXT("Empty test slot; the engine removes it")))));
+				continue;
+			}
+
+			TSharedPtr<FJsonObject> TestObj = MakeShareable(new FJsonObject);
+			TestObj->SetNumberField(TEXT("test_index"), TestIndex);
+			TestObj->SetStringField(TEXT("test_class"), Test->GetClass()->GetName());
+			TestObj->SetStringField(TEXT("purpose"), GetTestPurposeString(Test->TestPurpose));
+			TestObj->SetStringField(TEXT("cost"), GetTestCostString(Test->Cost));
+			TestObj->SetBoolField(TEXT("item_dependent_normalization"), HasItemDependentNormalization(Test));
+			TestsArray.Add(MakeShareable(new FJsonValueObject(TestObj)));
+
+			if (!Test->IsSupportedItem(Generator->ItemType))
+			{
+				FindingsArray.Add(MakeShareable(new FJsonValueObject(
+					MakeFinding(TEXT("unsupported_item_type"), TEXT("error"), TestIndex, INDEX_NONE,
+						FString::Printf(TEXT("%s cannot test items of %s; the engine removes it at runtime"),
+							*Test->GetClass()->GetName(), *Generator->GetClass()->GetName())))));
+				continue;
+			}
+
+			Tests.Add(Test);
+			AssetIndices.Add(TestIndex);
+		}
+		OptionObj->SetArrayField(TEXT("tests"), TestsArray);
+
+		const TArray<int32> ExecutionLocal = ComputeExecutionOrder(Tests);
+		TArray<int32> AuthoredLocal;
+		TArray<int32> ExecutionOrder;
+		TArray<int32> ExecutionPosition;
+		ExecutionPosition.SetNum(Tests.Num());
+		for (int32 Position = 0; Position < Tests.Num(); Position++)
+		{
+			AuthoredLocal.Add(Position);
+			ExecutionOrder.Add(AssetIndices[ExecutionLocal[Position]]);
+			ExecutionPosition[ExecutionLocal[Position]] = Position;
+		}
+
+		// The engine's sort moved a filter across a test whose normalization depends on it
+		for (int32 Earlier = 0; Earlier < Tests.Num(); Earlier++)
+		{
+			for (int32 Later = Earlier + 1; Later < Tests.Num(); Later++)
+			{
+				const UEnvQueryTest* EarlierTest = Tests[Earlier];
+				const UEnvQueryTest* LaterTest = Tests[Later];
+				if (ExecutionPosition[Earlier] < ExecutionPosition[Later] || !MustKeepRelativeOrder(EarlierTest, LaterTest))
+				{
+					continue;
+				}
+
+				const bool bFilterMovedAhead = IsFilteringTest(LaterTest) && HasItemDependentNormalization(EarlierTest);
+				const UEnvQueryTest* ScoringTest = bFilterMovedAhead ? EarlierTest : LaterTest;
+				const FString Message = bFilterMovedAhead
+					? FString::Printf(TEXT("The engine runs the filter %s (%s) before %s (%s), so %s normalizes over only the items the filter keeps"),
+						*LaterTest->GetClass()->GetName(), *GetTestCostString(LaterTest->Cost),
+						*EarlierTest->GetClass()->GetName(), *GetTestCostString(EarlierTest->Cost), *EarlierTest->GetClass()->GetName())
+					: FString::Printf(TEXT("The engine runs %s (%s) before the filter %s (%s), so %s normalizes over items the filter drops afterwards"),
+						*LaterTest->GetClass()->GetName(), *GetTestCostString(LaterTest->Cost),
+						*EarlierTest->GetClass()->GetName(), *GetTestCostString(EarlierTest->Cost), *LaterTest->GetClass()->GetName());
+				FindingsArray.Add(MakeShareable(new FJsonValueObject(
+					MakeFinding(TEXT("normalization_reordered"), TEXT("warning"), AssetIndices[Earlier], AssetIndices[Later],
+						FString::Printf(TEXT("%s; set both clamps on %s if its scores must not depend on the order"),
+							*Message, *ScoringTest->GetClass()->GetName())))));
+			}
+		}
+
+		// High-cost test running on a large set with no filter ahead of it in execution order
+		if (Estimate.Items >= LargeItemCount)
+		{
+			bool bFilteredBefore = false;
+			for (int32 LocalIndex : ExecutionLocal)
+			{
+				const UEnvQueryTest* Test = Tests[LocalIndex];
+				if (Test->Cost == EEnvTestCost::High && !bFilteredBefore)
+				{
+					FindingsArray.Add(MakeShareable(new FJsonValueObject(
+						MakeFinding(TEXT("unfiltered_expensive_test"), TEXT("warning"), AssetIndices[LocalIndex], INDEX_NONE,
+							FString::Printf(TEXT("%s (High) runs on ~%d items with no filter ahead of it; add a cheap Distance or Dot filter or shrink the generator"),
+								*Test->GetClass()->GetName(), Estimate.Items)))));
+				}
+				bFilteredBefore |= IsFilteringTest(Test);
+			}
+		}
+
+		const bool bOrderChanged = ExecutionLocal != AuthoredLocal;
+		OptionObj->SetArrayField(TEXT("execution_order"), IndicesToJsonArray(ExecutionOrder));
+		OptionObj->SetBoolField(TEXT("order_changed"), bOrderChanged);
+
+		const int32 CostItems = Estimate.Items != INDEX_NONE ? Estimate.Items : 1;
+		OptionObj->SetNumberField(TEXT("estimated_cost_units"), EstimateCostUnits(Tests, ExecutionLocal, CostItems, PassRate));
+
+		for (const TSharedPtr<FJsonValue>& Finding : FindingsArray)
+		{
+			NumErrors += Finding->AsObject()->GetStringField(TEXT("severity")) == TEXT("error") ? 1 : 0;
+		}
+		NumFindings += FindingsArray.Num();
+		OptionObj->SetArrayField(TEXT("findings"), FindingsArray);
+		OptionsArray.Add(MakeShareable(new FJsonValueObject(OptionObj)));
+
+		if (bOrderChanged)
+		{
+			Reorders.Add(TPair<int32, TArray<int32>>(OptionIndex, ExecutionOrder));
+		}
+	}
+
+	// Apply: write the execution order back to the array and TestOrder, which keeps the same run order
+	bool bApplied = false;
+	if (bApply && Reorders.Num() > 0)
+	{
+		for (const TPair<int32, TArray<int32>>& Reorder : Reorders)
+		{
+			UEnvQueryOption* Option = Query->GetOptionsMutable()[Reorder.Key];
+
+			// Dropped tests (null or unsupported) keep their slots at the end
+			TArray<UEnvQueryTest*> NewTests;
+			for (int32 TestIndex : Reorder.Value)
+			{
+				NewTests.Add(Option->Tests[TestIndex]);
+			}
+			for (int32 TestIndex = 0; TestIndex < Option->Tests.Num(); TestIndex++)
+			{
+				if (!Reorder.Value.Contains(TestIndex))
+				{
+					NewTests.Add(Option->Tests[TestIndex]);
+				}
+			}
+
+			Option->Tests = NewTests;
+			for (int32 TestIndex = 0; TestIndex < Option->Tests.Num(); TestIndex++)
+			{
+				if (Option->Tests[TestIndex])
+				{
+					Option->Tests[TestIndex]->TestOrder = TestIndex;
+				}
+			}
+		}
+
+		// Mark as dirty and save
+		Query->MarkPackageDirty();
+
+		FString PackagePath = FString::Printf(TEXT("%s/%s"), *Path, *QueryName);
+		FString PackageFileName = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+		UPackage::SavePackage(Query->GetOutermost(), Query, *PackageFileName, SaveArgs);
+
+		UEnvQueryManager::NotifyAssetUpdate(Query);
+		bApplied = true;
+	}
+
+	// Build response
+	TSharedPtr<FJsonObject> Response = FSpirrowBridgeCommonUtils::CreateSuccessResponse();
+	Response->SetStringField(TEXT("query_name"), QueryName);
+	Response->SetArrayField(TEXT("options"), OptionsArray);
+	Response->SetNumberField(TEXT("finding_count"), NumFindings);
+	Response->SetNumberField(TEXT("error_count"), NumErrors);
+	Response->SetNumberField(TEXT("reorderable_options"), Reorders.Num());
+	Response->SetBoolField(TEXT("applied"), bApplied);
+
+#if WITH_EDITORONLY_DATA
+	if (bApplied && Query->EdGraph)
+	{
+		Response->SetStringField(TEXT("warning"),
+			TEXT("The query has an EQS editor graph; saving it from the EQS editor rebuilds the test order from the graph"));
+	}
+#endif
+
+	return Response;
+}
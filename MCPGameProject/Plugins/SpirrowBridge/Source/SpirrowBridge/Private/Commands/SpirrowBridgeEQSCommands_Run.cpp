@@ -0,0 +1,428 @@
+#include "Commands/SpirrowBridgeEQSCommands.h"
+#include "Commands/SpirrowBridgeCommonUtils.h"
+
+// Editor / world includes
+#include "Editor.h"
+#include "EngineUtils.h"
+#include "Components/SceneComponent.h"
+
+// EQS includes
+#include "EnvironmentQuery/EnvQuery.h"
+#include "EnvironmentQuery/EnvQueryOption.h"
+#include "EnvironmentQuery/EnvQueryGenerator.h"
+#include "EnvironmentQuery/EnvQueryTest.h"
+#include "EnvironmentQuery/EnvQueryManager.h"
+#include "EnvironmentQuery/EnvQueryTypes.h"
+#include "EnvironmentQuery/Items/EnvQueryItemType_ActorBase.h"
+
+// ===== run_eqs_query =====
+//
+// The query is driven step by step (generator, then one test at a time) through
+// FEnvQueryInstance::ExecuteOneStep with no time limit, the same way the EQS testing
+// pawn steps a query, so every step can be timed and its surviving item count read.
+// Tests run in the engine's execution order (cheaper and filtering tests first), not
+// necessarily the authored order; each step reports both.
+
+namespace
+{
+	struct FEQSStepStats
+	{
+		int32 OptionIndex = INDEX_NONE;
+
+		/** Position in the option's execution order; INDEX_NONE for the generator step */
+		int32 Step = INDEX_NONE;
+
+		/** Index of the test in the asset (authored order) */
+		int32 TestIndex = INDEX_NONE;
+		FString ClassName;
+		FString Purpose;
+		FString Cost;
+
+		int32 ItemsIn = 0;
+		int32 ItemsOut = 0;
+		int32 Runs = 0;
+		double TotalMs = 0.0;
+		double MaxMs = 0.0;
+	};
+
+	int32 CountValidItems(const FEnvQueryInstance& QueryInstance)
+	{
+		int32 NumValid = 0;
+		for (const FEnvQueryItem& Item : QueryInstance.Items)
+		{
+			NumValid += Item.IsValid() ? 1 : 0;
+		}
+		return NumValid;
+	}
+
+	bool ParseRunMode(const FString& RunModeString, EEnvQueryRunMode::Type& OutRunMode)
+	{
+		if (RunModeString.Equals(TEXT("AllMatching"), ESearchCase::IgnoreCase) || RunModeString.Equals(TEXT("all"), ESearchCase::IgnoreCase))
+		{
+			OutRunMode = EEnvQueryRunMode::AllMatching;
+		}
+		else if (RunModeString.Equals(TEXT("SingleResult"), ESearchCase::IgnoreCase) || RunModeString.Equals(TEXT("best"), ESearchCase::IgnoreCase))
+		{
+			OutRunMode = EEnvQueryRunMode::SingleResult;
+		}
+		else if (RunModeString.Equals(TEXT("RandomBest5Pct"), ESearchCase::IgnoreCase))
+		{
+			OutRunMode = EEnvQueryRunMode::RandomBest5Pct;
+		}
+		else if (RunModeString.Equals(TEXT("RandomBest25Pct"), ESearchCase::IgnoreCase))
+		{
+			OutRunMode = EEnvQueryRunMode::RandomBest25Pct;
+		}
+		else
+		{
+			return false;
+		}
+		return true;
+	}
+
+	TArray<TSharedPtr<FJsonValue>> VectorToJsonArray(const FVector& Vector)
+	{
+		TArray<TSharedPtr<FJsonValue>> Array;
+		Array.Add(MakeShareable(new FJsonValueNumber(Vector.X)));
+		Array.Add(MakeShareable(new FJsonValueNumber(Vector.Y)));
+		Array.Add(MakeShareable(new FJsonValueNumber(Vector.Z)));
+		return Array;
+	}
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeEQSCommands::HandleRunEQSQuery(const TSharedPtr<FJsonObject>& Params)
+{
+	// Validate required parameters
+	FString QueryName;
+	if (auto Error = FSpirrowBridgeCommonUtils::ValidateRequiredString(Params, TEXT("query_name"), QueryName))
+	{
+		return Error;
+	}
+
+	FString Path;
+	FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("path"), Path, TEXT("/Game/AI/EQS"));
+	FString Target;
+	FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("target"), Target, TEXT("auto"));
+	FString QuerierName;
+	FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("querier"), QuerierName, TEXT(""));
+	FString RunModeString;
+	FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("run_mode"), RunModeString, TEXT("AllMatching"));
+
+	double IterationsDouble = 1.0;
+	FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("iterations"), IterationsDouble, 1.0);
+	const int32 Iterations = FMath::Clamp(static_cast<int32>(IterationsDouble), 1, 100);
+
+	double MaxItemsDouble = 20.0;
+	FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("max_items"), MaxItemsDouble, 20.0);
+	const int32 MaxItems = FMath::Max(0, static_cast<int32>(MaxItemsDouble));
+
+	EEnvQueryRunMode::Type RunMode = EEnvQueryRunMode::AllMatching;
+	if (!ParseRunMode(RunModeString, RunMode))
+	{
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::InvalidParamValue,
+			FString::Printf(TEXT("Invalid run_mode: %s. Valid modes: AllMatching, SingleResult, RandomBest5Pct, RandomBest25Pct"), *RunModeString)
+		);
+	}
+
+	// Find the EQS Query
+	UEnvQuery* Query = FindEQSQueryAsset(QueryName, Path);
+	if (!Query)
+	{
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::AssetNotFound,
+			FString::Printf(TEXT("EQS Query not found: %s at %s"), *QueryName, *Path)
+		);
+	}
+
+	if (Query->GetOptions().Num() == 0)
+	{
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::InvalidOperation,
+			FString::Printf(TEXT("EQS Query '%s' has no generators"), *QueryName)
+		);
+	}
+
+	// Resolve the world: auto prefers PIE if running, else editor
+	UWorld* World = nullptr;
+	FString ResolvedTarget;
+	UWorld* PIEWorld = GEditor ? GEditor->PlayWorld.Get() : nullptr;
+	if (Target.Equals(TEXT("pie"), ESearchCase::IgnoreCase) || (Target.Equals(TEXT("auto"), ESearchCase::IgnoreCase) && PIEWorld))
+	{
+		World = PIEWorld;
+		ResolvedTarget = TEXT("pie");
+	}
+	else if (Target.Equals(TEXT("editor"), ESearchCase::IgnoreCase) || Target.Equals(TEXT("auto"), ESearchCase::IgnoreCase))
+	{
+		World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+		ResolvedTarget = TEXT("editor");
+	}
+	else
+	{
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::InvalidParamValue,
+			FString::Printf(TEXT("Invalid target: %s. Valid targets: auto, editor, pie"), *Target)
+		);
+	}
+
+	if (!World)
+	{
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::InvalidOperation,
+			FString::Printf(TEXT("Target world '%s' not available"), *Target)
+		);
+	}
+
+	UEnvQueryManager* QueryManager = UEnvQueryManager::GetCurrent(World);
+	if (!QueryManager)
+	{
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::InvalidOperation,
+			FString::Printf(TEXT("No EQS manager in the %s world (AI system disabled?)"), *ResolvedTarget)
+		);
+	}
+
+	// Resolve the querier: an existing actor, or a temporary actor at 'location'
+	AActor* Querier = nullptr;
+	bool bSpawnedQuerier = false;
+	if (!QuerierName.IsEmpty())
+	{
+		for (TActorIterator<AActor> It(World); It; ++It)
+		{
+			if (It->GetName() == QuerierName || It->GetActorLabel() == QuerierName)
+			{
+				Querier = *It;
+				break;
+			}
+		}
+		if (!Querier)
+		{
+			return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+				ESpirrowErrorCode::ActorNotFound,
+				FString::Printf(TEXT("Querier actor not found in %s world: %s"), *ResolvedTarget, *QuerierName)
+			);
+		}
+	}
+	else
+	{
+		const FVector Location = FSpirrowBridgeCommonUtils::GetVectorFromJson(Params, TEXT("location"));
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.ObjectFlags |= RF_Transient;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		SpawnParams.bTemporaryEditorActor = true;
+		SpawnParams.bHideFromSceneOutliner = true;
+
+		Querier = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Location), SpawnParams);
+		if (!Querier)
+		{
+			return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+				ESpirrowErrorCode::ActorSpawnFailed,
+				TEXT("Failed to spawn temporary querier actor")
+			);
+		}
+
+		// A bare actor has no location without a root component
+		USceneComponent* Root = NewObject<USceneComponent>(Querier, TEXT("QuerierRoot"), RF_Transient);
+		Querier->SetRootComponent(Root);
+		Root->RegisterComponent();
+		Querier->SetActorLocation(Location);
+		bSpawnedQuerier = true;
+	}
+
+	// Drop cached query templates so edits made since the last run are picked up
+	UEnvQueryManager::NotifyAssetUpdate(Query);
+
+	FEnvQueryRequest Request(Query, Querier);
+	const TSharedPtr<FJsonObject>* QueryParamsObj = nullptr;
+	if (Params->TryGetObjectField(TEXT("query_params"), QueryParamsObj) && QueryParamsObj && (*QueryParamsObj).IsValid())
+	{
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*QueryParamsObj)->Values)
+		{
+			double Value = 0.0;
+			if (Pair.Value.IsValid() && Pair.Value->TryGetNumber(Value))
+			{
+				Request.SetFloatParam(FName(*Pair.Key), static_cast<float>(Value));
+			}
+		}
+	}
+
+	// Run the query, timing every step
+	TArray<FEQSStepStats> Steps;
+	TSharedPtr<FEnvQueryInstance> QueryInstance;
+	double TotalMs = 0.0;
+	int32 GeneratedCount = 0;
+
+	for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		QueryInstance = QueryManager->PrepareQueryInstance(Request, RunMode);
+		if (!QueryInstance.IsValid())
+		{
+			break;
+		}
+
+		GeneratedCount = 0;
+		const double RunStart = FPlatformTime::Seconds();
+
+		while (!QueryInstance->IsFinished())
+		{
+			const int32 StepOption = QueryInstance->OptionIndex;
+			const int32 StepTest = QueryInstance->CurrentTest;
+			const int32 ItemsIn = StepTest < 0 ? 0 : CountValidItems(*QueryInstance);
+
+			const double StepStart = FPlatformTime::Seconds();
+			QueryInstance->ExecuteOneStep(UE_MAX_FLT);
+			const double StepMs = (FPlatformTime::Seconds() - StepStart) * 1000.0;
+
+			if (!QueryInstance->Options.IsValidIndex(StepOption))
+			{
+				continue;
+			}
+			const FEnvQueryOptionInstance& OptionInstance = QueryInstance->Options[StepOption];
+
+			FEQSStepStats* Stats = Steps.FindByPredicate([StepOption, StepTest](const FEQSStepStats& Existing)
+			{
+				return Existing.OptionIndex == StepOption && Existing.Step == StepTest;
+			});
+			if (!Stats)
+			{
+				Stats = &Steps.AddDefaulted_GetRef();
+				Stats->OptionIndex = StepOption;
+				Stats->Step = StepTest;
+				if (StepTest < 0)
+				{
+					Stats->ClassName = OptionInstance.Generator ? OptionInstance.Generator->GetClass()->GetName() : TEXT("None");
+				}
+				else if (const UEnvQueryTest* StepTestObject = OptionInstance.Tests.IsValidIndex(StepTest) ? OptionInstance.Tests[StepTest] : nullptr)
+				{
+					Stats->ClassName = StepTestObject->GetClass()->GetName();
+					Stats->Purpose = GetTestPurposeString(StepTestObject->TestPurpose);
+					Stats->Cost = GetTestCostString(StepTestObject->Cost);
+
+					// The instance holds sorted duplicates; map back to the authored test by name
+					const UEnvQueryOption* AssetOption = Query->GetOptions().IsValidIndex(StepOption) ? Query->GetOptions()[StepOption] : nullptr;
+					if (AssetOption)
+					{
+						Stats->TestIndex = AssetOption->Tests.IndexOfByPredicate([StepTestObject](const UEnvQueryTest* AssetTest)
+						{
+							return AssetTest && AssetTest->GetFName() == StepTestObject->GetFName();
+						});
+					}
+				}
+			}
+			Stats->TotalMs += StepMs;
+			Stats->MaxMs = FMath::Max(Stats->MaxMs, StepMs);
+
+			// A time-sliced step continues on the next call; count it once it completes
+			const bool bStepDone = QueryInstance->IsFinished() || QueryInstance->OptionIndex != StepOption || QueryInstance->CurrentTest != StepTest;
+			if (bStepDone)
+			{
+				Stats->Runs++;
+				Stats->ItemsIn = ItemsIn;
+				Stats->ItemsOut = StepTest < 0 ? QueryInstance->Items.Num() : CountValidItems(*QueryInstance);
+				if (StepTest < 0)
+				{
+					GeneratedCount += QueryInstance->Items.Num();
+				}
+			}
+		}
+
+		TotalMs += (FPlatformTime::Seconds() - RunStart) * 1000.0;
+	}
+
+	if (bSpawnedQuerier)
+	{
+		Querier->Destroy();
+	}
+
+	if (!QueryInstance.IsValid())
+	{
+		return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+			ESpirrowErrorCode::OperationFailed,
+			FString::Printf(TEXT("Failed to create a query instance for '%s'"), *QueryName)
+		);
+	}
+
+	// Steps in execution order
+	Steps.StableSort([](const FEQSStepStats& A, const FEQSStepStats& B)
+	{
+		return A.OptionIndex != B.OptionIndex ? A.OptionIndex < B.OptionIndex : A.Step < B.Step;
+	});
+
+	TArray<TSharedPtr<FJsonValue>> StepsArray;
+	for (const FEQSStepStats& Stats : Steps)
+	{
+		TSharedPtr<FJsonObject> StepJson = MakeShareable(new FJsonObject);
+		StepJson->SetNumberField(TEXT("generator_index"), Stats.OptionIndex);
+		if (Stats.Step >= 0)
+		{
+			StepJson->SetStringField(TEXT("step"), TEXT("test"));
+			StepJson->SetNumberField(TEXT("execution_order"), Stats.Step);
+			StepJson->SetNumberField(TEXT("test_index"), Stats.TestIndex);
+			StepJson->SetStringField(TEXT("test_class"), Stats.ClassName);
+			StepJson->SetStringField(TEXT("test_purpose"), Stats.Purpose);
+			StepJson->SetStringField(TEXT("cost"), Stats.Cost);
+			StepJson->SetNumberField(TEXT("items_in"), Stats.ItemsIn);
+			StepJson->SetNumberField(TEXT("items_filtered"), Stats.ItemsIn - Stats.ItemsOut);
+		}
+		else
+		{
+			StepJson->SetStringField(TEXT("step"), TEXT("generator"));
+			StepJson->SetStringField(TEXT("generator_class"), Stats.ClassName);
+		}
+		StepJson->SetNumberField(TEXT("items_out"), Stats.ItemsOut);
+		StepJson->SetNumberField(TEXT("runs"), Stats.Runs);
+		StepJson->SetNumberField(TEXT("avg_ms"), Stats.Runs > 0 ? Stats.TotalMs / Stats.Runs : Stats.TotalMs);
+		StepJson->SetNumberField(TEXT("max_ms"), Stats.MaxMs);
+		StepsArray.Add(MakeShareable(new FJsonValueObject(StepJson)));
+	}
+
+	// Scored items of the last run
+	const bool bActorItems = QueryInstance->ItemType && QueryInstance->ItemType->IsChildOf(UEnvQueryItemType_ActorBase::StaticClass());
+	TArray<TSharedPtr<FJsonValue>> ItemsArray;
+	for (int32 ItemIndex = 0; ItemIndex < QueryInstance->Items.Num() && ItemIndex < MaxItems; ++ItemIndex)
+	{
+		TSharedPtr<FJsonObject> ItemJson = MakeShareable(new FJsonObject);
+		ItemJson->SetNumberField(TEXT("rank"), ItemIndex);
+		ItemJson->SetNumberField(TEXT("score"), QueryInstance->GetItemScore(ItemIndex));
+		ItemJson->SetArrayField(TEXT("location"), VectorToJsonArray(QueryInstance->GetItemAsLocation(ItemIndex)));
+		if (bActorItems)
+		{
+			if (AActor* ItemActor = QueryInstance->GetItemAsActor(ItemIndex))
+			{
+				ItemJson->SetStringField(TEXT("actor"), ItemActor->GetName());
+			}
+		}
+		ItemsArray.Add(MakeShareable(new FJsonValueObject(ItemJson)));
+	}
+
+	FString Status = TEXT("failed");
+	if (QueryInstance->IsSuccessful())
+	{
+		Status = TEXT("success");
+	}
+	else if (QueryInstance->IsAborted())
+	{
+		Status = TEXT("aborted");
+	}
+
+	// Build response
+	TSharedPtr<FJsonObject> Response = FSpirrowBridgeCommonUtils::CreateSuccessResponse();
+	Response->SetStringField(TEXT("query_name"), QueryName);
+	Response->SetStringField(TEXT("target"), ResolvedTarget);
+	Response->SetStringField(TEXT("querier"), bSpawnedQuerier ? FString() : Querier->GetName());
+	Response->SetBoolField(TEXT("querier_spawned"), bSpawnedQuerier);
+	Response->SetStringField(TEXT("run_mode"), RunModeString);
+	Response->SetNumberField(TEXT("iterations"), Iterations);
+	Response->SetStringField(TEXT("status"), Status);
+	Response->SetNumberField(TEXT("option_used"), QueryInstance->OptionIndex);
+	Response->SetStringField(TEXT("item_type"), QueryInstance->ItemType ? QueryInstance->ItemType->GetName() : TEXT("None"));
+	Response->SetNumberField(TEXT("generated_count"), GeneratedCount);
+	Response->SetNumberField(TEXT("result_count"), QueryInstance->Items.Num());
+	Response->SetArrayField(TEXT("items"), ItemsArray);
+	Response->SetBoolField(TEXT("items_truncated"), QueryInstance->Items.Num() > MaxItems);
+	Response->SetArrayField(TEXT("steps"), StepsArray);
+	Response->SetNumberField(TEXT("avg_ms"), TotalMs / Iterations);
+
+	return Response;
+}
@@ -0,0 +1,475 @@
+#include "Commands/SpirrowBridgeGraphLayout.h"
+#include "Commands/SpirrowBridgeBlueprintSearchIndex.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EdGraphSchema_K2.h"
+#include "EdGraphNode_Comment.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+    struct FNodeSizeKey
+    {
+        const UClass* NodeClass = nullptr;
+        FName Member;
+        int32 NumPins = 0;
+
+        bool operator==(const FNodeSizeKey& Other) const
+        {
+            return NodeClass == Other.NodeClass && Member == Other.Member && NumPins == Other.NumPins;
+        }
+
+        friend uint32 GetTypeHash(const FNodeSizeKey& Key)
+        {
+            return HashCombine(HashCombine(::GetTypeHash(Key.NodeClass), GetTypeHash(Key.Member)), ::GetTypeHash(Key.NumPins));
+        }
+    };
+
+    // Rough metrics of the default graph node widget
+    constexpr int32 CharWidth = 7;
+    constexpr int32 HeaderHeight = 32;
+    constexpr int32 PinRowHeight = 24;
+    constexpr int32 MinNodeWidth = 80;
+    constexpr int32 MaxNodeWidth = 600;
+    constexpr int32 GridSnap = 16;
+    constexpr int32 MaxSizeCacheEntries = 4096;
+
+    TMap<FNodeSizeKey, FIntPoint> GNodeSizes;
+
+    struct FLayoutNode
+    {
+        UEdGraphNode* Node = nullptr;
+        FIntPoint Size;
+        TArray<int32> Preds;
+        TArray<int32> Succs;
+        int32 Component = INDEX_NONE;
+        int32 Layer = 0;
+        int32 Order = 0;
+        int32 Y = 0;
+        bool bPure = false;
+    };
+
+    bool HasExecPins(const UEdGraphNode* Node)
+    {
+        for (const UEdGraphPin* Pin : Node->Pins)
+        {
+            if (Pin && Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    int32 Snap(int32 Value)
+    {
+        return FMath::RoundToInt(static_cast<float>(Value) / GridSnap) * GridSnap;
+    }
+}
+
+FIntPoint FSpirrowBridgeGraphLayout::EstimateNodeSize(const UEdGraphNode* Node, bool* bOutCacheHit)
+{
+    if (bOutCacheHit)
+    {
+        *bOutCacheHit = false;
+    }
+
+    // Resizable nodes know their size
+    if (Node->NodeWidth > 0 && Node->NodeHeight > 0)
+    {
+        return FIntPoint(Node->NodeWidth, Node->NodeHeight);
+    }
+
+    FNodeSizeKey Key;
+    Key.NodeClass = Node->GetClass();
+    Key.NumPins = Node->Pins.Num();
+    FName Kind;
+    FSpirrowBridgeBlueprintSearchIndex::ClassifyNode(Node, Kind, Key.Member);
+
+    if (const FIntPoint* Cached = GNodeSizes.Find(Key))
+    {
+        if (bOutCacheHit)
+        {
+            *bOutCacheHit = true;
+        }
+        return *Cached;
+    }
+
+    int32 NumInputs = 0;
+    int32 NumOutputs = 0;
+    int32 MaxInputChars = 0;
+    int32 MaxOutputChars = 0;
+    for (const UEdGraphPin* Pin : Node->Pins)
+    {
+        if (!Pin || Pin->bHidden)
+        {
+            continue;
+        }
+        const int32 Chars = Pin->PinName.GetStringLength();
+        if (Pin->Direction == EGPD_Input)
+        {
+            ++NumInputs;
+            MaxInputChars = FMath::Max(MaxInputChars, Chars);
+        }
+        else
+        {
+            ++NumOutputs;
+            MaxOutputChars = FMath::Max(MaxOutputChars, Chars);
+        }
+    }
+
+    const int32 TitleChars = Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString().Len();
+    // Inputs may show an inline default value box next to the pin name
+    const int32 PinsWidth = (MaxInputChars + MaxOutputChars) * CharWidth + 110;
+    const int32 Width = FMath::Clamp(FMath::Max(TitleChars * CharWidth + 48, PinsWidth), MinNodeWidth, MaxNodeWidth);
+    const int32 Height = HeaderHeight + FMath::Max(NumInputs, NumOutputs) * PinRowHeight + 8;
+
+    if (GNodeSizes.Num() >= MaxSizeCacheEntries)
+    {
+        GNodeSizes.Reset();
+    }
+    const FIntPoint Size(Width, Height);
+    GNodeSizes.Add(Key, Size);
+    return Size;
+}
+
+void FSpirrowBridgeGraphLayout::ResetSizeCache()
+{
+    GNodeSizes.Empty();
+}
+
+FSpirrowBridgeGraphLayout::FResult FSpirrowBridgeGraphLayout::Layout(const TArray<UEdGraphNode*>& InNodes, const FSettings& Settings)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    FResult Result;
+
+    // === Gather nodes, sizes and edges in one pass ===
+    TArray<FLayoutNode> Nodes;
+    TMap<const UEdGraphNode*, int32> IndexOf;
+    FIntPoint Origin(MAX_int32, MAX_int32);
+    for (UEdGraphNode* Node : InNodes)
+    {
+        if (!Node || Node->IsA<UEdGraphNode_Comment>() || IndexOf.Contains(Node))
+        {
+            continue;
+        }
+        bool bCacheHit = false;
+        FLayoutNode& LayoutNode = Nodes.AddDefaulted_GetRef();
+        LayoutNode.Node = Node;
+        LayoutNode.Size = EstimateNodeSize(Node, &bCacheHit);
+        LayoutNode.bPure = !HasExecPins(Node);
+        Result.NumSizeCacheHits += bCacheHit ? 1 : 0;
+        IndexOf.Add(Node, Nodes.Num() - 1);
+        Origin.X = FMath::Min(Origin.X, Node->NodePosX);
+        Origin.Y = FMath::Min(Origin.Y, Node->NodePosY);
+    }
+
+    const int32 Num = Nodes.Num();
+    Result.NumNodes = Num;
+    if (Num == 0)
+    {
+        return Result;
+    }
+    if (Settings.bUseOrigin)
+    {
+        Origin = Settings.Origin;
+    }
+
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        for (const UEdGraphPin* Pin : Nodes[Index].Node->Pins)
+        {
+            if (!Pin || Pin->Direction != EGPD_Output)
+            {
+                continue;
+            }
+            for (const UEdGraphPin* Linked : Pin->LinkedTo)
+            {
+                const int32* Target = Linked ? IndexOf.Find(Linked->GetOwningNode()) : nullptr;
+                if (Target && *Target != Index && !Nodes[Index].Succs.Contains(*Target))
+                {
+                    Nodes[Index].Succs.Add(*Target);
+                    Nodes[*Target].Preds.Add(Index);
+                }
+            }
+        }
+    }
+
+    // === Connected components, in order of their top-most node ===
+    TArray<int32> ComponentOrder;
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        ComponentOrder.Add(Index);
+    }
+    ComponentOrder.StableSort([&Nodes](int32 A, int32 B)
+    {
+        return Nodes[A].Node->NodePosY < Nodes[B].Node->NodePosY;
+    });
+
+    TArray<TArray<int32>> Components;
+    for (const int32 Seed : ComponentOrder)
+    {
+        if (Nodes[Seed].Component != INDEX_NONE)
+        {
+            continue;
+        }
+        const int32 ComponentId = Components.Num();
+        TArray<int32>& Members = Components.AddDefaulted_GetRef();
+        Nodes[Seed].Component = ComponentId;
+        Members.Add(Seed);
+        for (int32 Cursor = 0; Cursor < Members.Num(); ++Cursor)
+        {
+            const FLayoutNode& Current = Nodes[Members[Cursor]];
+            for (const TArray<int32>* Neighbours : { &Current.Preds, &Current.Succs })
+            {
+                for (const int32 Neighbour : *Neighbours)
+                {
+                    if (Nodes[Neighbour].Component == INDEX_NONE)
+                    {
+                        Nodes[Neighbour].Component = ComponentId;
+                        Members.Add(Neighbour);
+                    }
+                }
+            }
+        }
+    }
+    Result.NumComponents = Components.Num();
+
+    // === Break cycles: reverse back edges found by DFS from the sources ===
+    {
+        TArray<uint8> State;  // 0 = unvisited, 1 = on stack, 2 = done
+        State.SetNumZeroed(Num);
+        TArray<TPair<int32, int32>> Reversed;
+
+        auto Visit = [&](int32 Root)
+        {
+            TArray<TPair<int32, int32>> Stack;  // node, next successor index
+            Stack.Emplace(Root, 0);
+            State[Root] = 1;
+            while (Stack.Num() > 0)
+            {
+                TPair<int32, int32>& Top = Stack.Last();
+                const TArray<int32>& Succs = Nodes[Top.Key].Succs;
+                if (Top.Value >= Succs.Num())
+                {
+                    State[Top.Key] = 2;
+                    Stack.Pop(EAllowShrinking::No);
+                    continue;
+                }
+                const int32 From = Top.Key;
+                const int32 To = Succs[Top.Value++];
+                if (State[To] == 1)
+                {
+                    Reversed.Emplace(From, To);
+                }
+                else if (State[To] == 0)
+                {
+                    State[To] = 1;
+                    Stack.Emplace(To, 0);
+                }
+            }
+        };
+
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            if (State[Index] == 0 && Nodes[Index].Preds.Num() == 0)
+            {
+                Visit(Index);
+            }
+        }
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            if (State[Index] == 0)
+            {
+                Visit(Index);
+            }
+        }
+
+        for (const TPair<int32, int32>& Edge : Reversed)
+        {
+            Nodes[Edge.Key].Succs.Remove(Edge.Value);
+            Nodes[Edge.Value].Preds.Remove(Edge.Key);
+            Nodes[Edge.Value].Succs.AddUnique(Edge.Key);
+            Nodes[Edge.Key].Preds.AddUnique(Edge.Value);
+        }
+        Result.NumReversedEdges = Reversed.Num();
+    }
+
+    // === Layers: longest path from the sources, pure nodes right before their first consumer ===
+    TArray<int32> Topo;
+    {
+        TArray<int32> InDegree;
+        InDegree.SetNumZeroed(Num);
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            InDegree[Index] = Nodes[Index].Preds.Num();
+            if (InDegree[Index] == 0)
+            {
+                Topo.Add(Index);
+            }
+        }
+        for (int32 Cursor = 0; Cursor < Topo.Num(); ++Cursor)
+        {
+            FLayoutNode& Current = Nodes[Topo[Cursor]];
+            for (const int32 Succ : Current.Succs)
+            {
+                Nodes[Succ].Layer = FMath::Max(Nodes[Succ].Layer, Current.Layer + 1);
+                if (--InDegree[Succ] == 0)
+                {
+                    Topo.Add(Succ);
+                }
+            }
+        }
+    }
+    for (int32 Cursor = Topo.Num() - 1; Cursor >= 0; --Cursor)
+    {
+        FLayoutNode& Current = Nodes[Topo[Cursor]];
+        if (Current.bPure && Current.Succs.Num() > 0)
+        {
+            int32 MinSuccLayer = MAX_int32;
+            for (const int32 Succ : Current.Succs)
+            {
+                MinSuccLayer = FMath::Min(MinSuccLayer, Nodes[Succ].Layer);
+            }
+            Current.Layer = MinSuccLayer - 1;
+        }
+    }
+
+    // === Per component: order within layers, then coordinates ===
+    int32 ComponentTop = 0;
+    int32 TotalWidth = 0;
+    for (const TArray<int32>& Members : Components)
+    {
+        int32 NumLayers = 0;
+        for (const int32 Index : Members)
+        {
+            NumLayers = FMath::Max(NumLayers, Nodes[Index].Layer + 1);
+        }
+        Result.NumLayers = FMath::Max(Result.NumLayers, NumLayers);
+
+        TArray<TArray<int32>> Layers;
+        Layers.SetNum(NumLayers);
+        for (const int32 Index : Members)
+        {
+            Layers[Nodes[Index].Layer].Add(Index);
+        }
+
+        // Start from the current vertical order so re-running the layout is stable
+        for (TArray<int32>& Layer : Layers)
+        {
+            Layer.StableSort([&Nodes](int32 A, int32 B)
+            {
+                return Nodes[A].Node->NodePosY < Nodes[B].Node->NodePosY;
+            });
+            for (int32 Order = 0; Order < Layer.Num(); ++Order)
+            {
+                Nodes[Layer[Order]].Order = Order;
+            }
+        }
+
+        auto SortByBarycenter = [&Nodes](TArray<int32>& Layer, bool bUsePreds)
+        {
+            TMap<int32, double> Barycenter;
+            for (const int32 Index : Layer)
+            {
+                const TArray<int32>& Neighbours = bUsePreds ? Nodes[Index].Preds : Nodes[Index].Succs;
+                double Sum = 0.0;
+                for (const int32 Neighbour : Neighbours)
+                {
+                    Sum += Nodes[Neighbour].Order;
+                }
+                Barycenter.Add(Index, Neighbours.Num() > 0 ? Sum / Neighbours.Num() : static_cast<double>(Nodes[Index].Order));
+            }
+            Layer.StableSort([&Barycenter](int32 A, int32 B)
+            {
+                return Barycenter[A] < Barycenter[B];
+            });
+            for (int32 Order = 0; Order < Layer.Num(); ++Order)
+            {
+                Nodes[Layer[Order]].Order = Order;
+            }
+        };
+
+        for (int32 Sweep = 0; Sweep < Settings.OrderingSweeps; ++Sweep)
+        {
+            for (int32 LayerIdx = 1; LayerIdx < NumLayers; ++LayerIdx)
+            {
+                SortByBarycenter(Layers[LayerIdx], true);
+            }
+            for (int32 LayerIdx = NumLayers - 2; LayerIdx >= 0; --LayerIdx)
+            {
+                SortByBarycenter(Layers[LayerIdx], false);
+            }
+        }
+
+        // X: one column per layer, as wide as its widest node
+        TArray<int32> LayerX;
+        LayerX.SetNumZeroed(NumLayers);
+        int32 CursorX = 0;
+        for (int32 LayerIdx = 0; LayerIdx < NumLayers; ++LayerIdx)
+        {
+            LayerX[LayerIdx] = CursorX;
+            int32 LayerWidth = 0;
+            for (const int32 Index : Layers[LayerIdx])
+            {
+                LayerWidth = FMath::Max(LayerWidth, Nodes[Index].Size.X);
+            }
+            CursorX += LayerWidth + Settings.HorizontalSpacing;
+        }
+        TotalWidth = FMath::Max(TotalWidth, CursorX - Settings.HorizontalSpacing);
+
+        // Y: follow the average of placed neighbours without breaking the layer order
+        auto PlaceLayer = [&](const TArray<int32>& Layer, bool bFromPreds)
+        {
+            int32 CursorY = 0;
+            for (const int32 Index : Layer)
+            {
+                FLayoutNode& Current = Nodes[Index];
+                const TArray<int32>& Neighbours = bFromPreds ? Current.Preds : Current.Succs;
+                int32 Desired = bFromPreds ? CursorY : Current.Y;
+                if (Neighbours.Num() > 0 && (bFromPreds || Current.Preds.Num() == 0))
+                {
+                    int64 Sum = 0;
+                    for (const int32 Neighbour : Neighbours)
+                    {
+                        Sum += Nodes[Neighbour].Y;
+                    }
+                    Desired = static_cast<int32>(Sum / Neighbours.Num());
+                }
+                Current.Y = FMath::Max(Desired, CursorY);
+                CursorY = Current.Y + Current.Size.Y + Settings.VerticalSpacing;
+            }
+        };
+        for (int32 LayerIdx = 0; LayerIdx < NumLayers; ++LayerIdx)
+        {
+            PlaceLayer(Layers[LayerIdx], true);
+        }
+        // Sources (pure inputs, events) line up with what they feed
+        for (int32 LayerIdx = NumLayers - 2; LayerIdx >= 0; --LayerIdx)
+        {
+            PlaceLayer(Layers[LayerIdx], false);
+        }
+
+        int32 ComponentHeight = 0;
+        for (const int32 Index : Members)
+        {
+            FLayoutNode& Current = Nodes[Index];
+            const int32 NewX = Snap(Origin.X + LayerX[Current.Layer]);
+            const int32 NewY = Snap(Origin.Y + ComponentTop + Current.Y);
+            if (Current.Node->NodePosX != NewX || Current.Node->NodePosY != NewY)
+            {
+                Current.Node->Modify();
+                Current.Node->NodePosX = NewX;
+                Current.Node->NodePosY = NewY;
+                ++Result.NumMoved;
+            }
+            ComponentHeight = FMath::Max(ComponentHeight, Current.Y + Current.Size.Y);
+        }
+        ComponentTop += ComponentHeight + Settings.ComponentSpacing;
+    }
+
+    Result.Size = FIntPoint(TotalWidth, FMath::Max(0, ComponentTop - Settings.ComponentSpacing));
+    Result.TimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    return Result;
+}
@@ -0,0 +1,221 @@
+#include "Commands/SpirrowBridgeNodeIndex.h"
+#include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+
+FSpirrowBridgeNodeIndex& FSpirrowBridgeNodeIndex::Get()
+{
+    static FSpirrowBridgeNodeIndex Instance;
+    return Instance;
+}
+
+void FSpirrowBridgeNodeIndex::Shutdown()
+{
+    for (TPair<FObjectKey, FBlueprintIndex>& Pair : Indices)
+    {
+        UnbindGraphs(Pair.Value);
+        if (UBlueprint* Blueprint = Pair.Value.Blueprint.Get())
+        {
+            Blueprint->OnChanged().Remove(Pair.Value.BlueprintChangedHandle);
+        }
+    }
+    Indices.Empty();
+}
+
+FSpirrowBridgeNodeIndex::FBlueprintIndex& FSpirrowBridgeNodeIndex::FindOrAddIndex(UBlueprint* Blueprint)
+{
+    const FObjectKey Key(Blueprint);
+    if (FBlueprintIndex* Existing = Indices.Find(Key))
+    {
+        return *Existing;
+    }
+
+    // Drop indices of Blueprints that have been garbage collected
+    for (auto It = Indices.CreateIterator(); It; ++It)
+    {
+        if (!It.Value().Blueprint.IsValid())
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    FBlueprintIndex& Index = Indices.Add(Key);
+    Index.Blueprint = Blueprint;
+    Index.BlueprintChangedHandle = Blueprint->OnChanged().AddRaw(this, &FSpirrowBridgeNodeIndex::OnBlueprintChanged);
+    return Index;
+}
+
+void FSpirrowBridgeNodeIndex::UnbindGraphs(FBlueprintIndex& Index)
+{
+    for (const TPair<TWeakObjectPtr<UEdGraph>, FDelegateHandle>& GraphHandle : Index.GraphHandles)
+    {
+        if (UEdGraph* Graph = GraphHandle.Key.Get())
+        {
+            Graph->RemoveOnGraphChangedHandler(GraphHandle.Value);
+        }
+    }
+    Index.GraphHandles.Reset();
+}
+
+void FSpirrowBridgeNodeIndex::Rebuild(FBlueprintIndex& Index)
+{
+    UnbindGraphs(Index);
+    Index.Nodes.Reset();
+    Index.PendingAdds.Reset();
+    Index.bDirty = false;
+
+    UBlueprint* Blueprint = Index.Blueprint.Get();
+    if (!Blueprint)
+    {
+        return;
+    }
+
+    TArray<UEdGraph*> Graphs;
+    FBlueprintEditorUtils::GetAllGraphs(Blueprint, Graphs);
+
+    const FObjectKey BlueprintKey(Blueprint);
+    for (UEdGraph* Graph : Graphs)
+    {
+        if (!Graph)
+        {
+            continue;
+        }
+
+        Index.Nodes.Reserve(Index.Nodes.Num() + Graph->Nodes.Num());
+        for (UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (Node)
+            {
+                Index.Nodes.Add(Node->NodeGuid, Node);
+            }
+        }
+
+        const FDelegateHandle Handle = Graph->AddOnGraphChangedHandler(
+            FOnGraphChanged::FDelegate::CreateRaw(this, &FSpirrowBridgeNodeIndex::OnGraphChanged, BlueprintKey));
+        Index.GraphHandles.Emplace(Graph, Handle);
+    }
+}
+
+void FSpirrowBridgeNodeIndex::FlushPendingAdds(FBlueprintIndex& Index)
+{
+    for (const TWeakObjectPtr<UEdGraphNode>& WeakNode : Index.PendingAdds)
+    {
+        if (UEdGraphNode* Node = WeakNode.Get())
+        {
+            Index.Nodes.Add(Node->NodeGuid, Node);
+        }
+    }
+    Index.PendingAdds.Reset();
+}
+
+void FSpirrowBridgeNodeIndex::OnGraphChanged(const FEdGraphEditAction& Action, FObjectKey BlueprintKey)
+{
+    FBlueprintIndex* Index = Indices.Find(BlueprintKey);
+    if (!Index || Index->bDirty)
+    {
+        return;
+    }
+
+    if (Action.Action == GRAPHACTION_AddNode)
+    {
+        for (const UEdGraphNode* Node : Action.Nodes)
+        {
+            Index->PendingAdds.Add(const_cast<UEdGraphNode*>(Node));
+        }
+    }
+    else if (Action.Action == GRAPHACTION_RemoveNode)
+    {
+        for (const UEdGraphNode* Node : Action.Nodes)
+        {
+            if (Node)
+            {
+                Index->Nodes.Remove(Node->NodeGuid);
+            }
+        }
+    }
+    else if (Action.Action != GRAPHACTION_SelectNode)
+    {
+        // Generic "graph changed" (paste, reconstruct, collapse...): rebuild lazily
+        Index->bDirty = true;
+    }
+}
+
+void FSpirrowBridgeNodeIndex::OnBlueprintChanged(UBlueprint* Blueprint)
+{
+    // Graphs may have been added or removed
+    if (FBlueprintIndex* Index = Indices.Find(FObjectKey(Blueprint)))
+    {
+        Index->bDirty = true;
+    }
+}
+
+void FSpirrowBridgeNodeIndex::Invalidate(UBlueprint* Blueprint)
+{
+    if (FBlueprintIndex* Index = Indices.Find(FObjectKey(Blueprint)))
+    {
+        Index->bDirty = true;
+    }
+}
+
+UEdGraphNode* FSpirrowBridgeNodeIndex::FindNode(UBlueprint* Blueprint, const FGuid& NodeGuid)
+{
+    if (!Blueprint || !NodeGuid.IsValid())
+    {
+        return nullptr;
+    }
+
+    FBlueprintIndex& Index = FindOrAddIndex(Blueprint);
+    bool bRebuilt = false;
+    if (Index.bDirty)
+    {
+        Rebuild(Index);
+        bRebuilt = true;
+    }
+    FlushPendingAdds(Index);
+
+    if (const TWeakObjectPtr<UEdGraphNode>* Found = Index.Nodes.Find(NodeGuid))
+    {
+        UEdGraphNode* Node = Found->Get();
+        if (Node && Node->NodeGuid == NodeGuid && Node->GetGraph())
+        {
+            return Node;
+        }
+    }
+
+    // Miss: the index may be stale (e.g. a graph added without notification)
+    if (!bRebuilt)
+    {
+        Rebuild(Index);
+        if (const TWeakObjectPtr<UEdGraphNode>* Found = Index.Nodes.Find(NodeGuid))
+        {
+            return Found->Get();
+        }
+    }
+
+    return nullptr;
+}
+
+TSharedPtr<FJsonObject> FSpirrowBridgeNodeIndex::ResolveNode(UBlueprint* Blueprint, const FString& NodeId, UEdGraphNode*& OutNode, const TCHAR* Label)
+{
+    OutNode = nullptr;
+
+    FGuid NodeGuid;
+    if (!FGuid::Parse(NodeId, NodeGuid))
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::InvalidParamValue,
+            FString::Printf(TEXT("%s id is not a valid GUID: %s"), Label, *NodeId));
+    }
+
+    OutNode = FindNode(Blueprint, NodeGuid);
+    if (!OutNode)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::NodeNotFound,
+            FString::Printf(TEXT("%s not found: %s"), Label, *NodeId));
+    }
+
+    return nullptr;
+}
@@ -0,0 +1,150 @@
+#include "Commands/SpirrowBridgeNodeTemplateCache.h"
+#include "Commands/SpirrowBridgeCommonUtils.h"
+#include "UObject/Class.h"
+#include "UObject/UnrealType.h"
+
+FSpirrowBridgeNodeTemplateCache& FSpirrowBridgeNodeTemplateCache::Get()
+{
+    static FSpirrowBridgeNodeTemplateCache Instance;
+    return Instance;
+}
+
+void FSpirrowBridgeNodeTemplateCache::Initialize()
+{
+    if (bInitialized)
+    {
+        return;
+    }
+    bInitialized = true;
+
+    ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddRaw(this, &FSpirrowBridgeNodeTemplateCache::OnModulesChanged);
+}
+
+void FSpirrowBridgeNodeTemplateCache::Shutdown()
+{
+    if (!bInitialized)
+    {
+        return;
+    }
+    bInitialized = false;
+
+    FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
+    Reset();
+}
+
+void FSpirrowBridgeNodeTemplateCache::Reset()
+{
+    Classes.Empty();
+    Functions.Empty();
+    Properties.Empty();
+}
+
+void FSpirrowBridgeNodeTemplateCache::OnModulesChanged(FName ModuleName, EModuleChangeReason Reason)
+{
+    // Hot reload replaces native classes and their fields
+    if (Reason == EModuleChangeReason::ModuleLoaded || Reason == EModuleChangeReason::ModuleUnloaded)
+    {
+        Reset();
+    }
+}
+
+bool FSpirrowBridgeNodeTemplateCache::IsCacheable(const UStruct* Owner)
+{
+    const UClass* Class = Cast<UClass>(Owner);
+    return Owner && (!Class || Class->HasAnyClassFlags(CLASS_Native)) && !Owner->HasAnyFlags(RF_NewerVersionExists);
+}
+
+UClass* FSpirrowBridgeNodeTemplateCache::FindClass(const FString& ClassName)
+{
+    if (ClassName.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    if (const TWeakObjectPtr<UClass>* Cached = Classes.Find(ClassName))
+    {
+        UClass* Class = Cached->Get();
+        if (Class && !Class->HasAnyClassFlags(CLASS_NewerVersionExists))
+        {
+            return Class;
+        }
+        Classes.Remove(ClassName);
+    }
+
+    UClass* Class = FSpirrowBridgeCommonUtils::FindClassByNameAnywhere(ClassName);
+    if (Class)
+    {
+        Classes.Add(ClassName, Class);
+    }
+    return Class;
+}
+
+UFunction* FSpirrowBridgeNodeTemplateCache::FindFunction(UClass* Class, const FString& FunctionName)
+{
+    if (!Class || FunctionName.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    const bool bCacheable = IsCacheable(Class);
+    const FMemberKey Key{ Class, FName(*FunctionName) };
+    if (bCacheable)
+    {
+        if (const TWeakObjectPtr<UFunction>* Cached = Functions.Find(Key))
+        {
+            if (UFunction* Function = Cached->Get())
+            {
+                return Function;
+            }
+            Functions.Remove(Key);
+        }
+    }
+
+    UFunction* Function = Class->FindFunctionByName(Key.Name);
+    if (!Function)
+    {
+        for (TFieldIterator<UFunction> FuncIt(Class); FuncIt; ++FuncIt)
+        {
+            if ((*FuncIt)->GetName().Equals(FunctionName, ESearchCase::IgnoreCase))
+            {
+                Function = *FuncIt;
+                break;
+            }
+        }
+    }
+
+    if (Function && bCacheable)
+    {
+        Functions.Add(Key, Function);
+    }
+    return Function;
+}
+
+FProperty* FSpirrowBridgeNodeTemplateCache::FindProperty(UStruct* Owner, FName PropertyName)
+{
+    if (!Owner || PropertyName.IsNone())
+    {
+        return nullptr;
+    }
+
+    const bool bCacheable = IsCacheable(Owner);
+    const FMemberKey Key{ Owner, PropertyName };
+    if (bCacheable)
+    {
+        if (const TFieldPath<FProperty>* Cached = Properties.Find(Key))
+        {
+            if (FProperty* Property = Cached->Get())
+            {
+                return Property;
+            }
+            Properties.Remove(Key);
+        }
+    }
+
+    FProperty* Property = FindFProperty<FProperty>(Owner, PropertyName);
+    if (Property && bCacheable)
+    {
+        Properties.Add(Key, TFieldPath<FProperty>(Property));
+    }
+    return Property;
+}
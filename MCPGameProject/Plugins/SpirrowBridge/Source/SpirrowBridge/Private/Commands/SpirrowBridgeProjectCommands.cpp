@@ -1,5 +1,7 @@
 #include "Commands/SpirrowBridgeProjectCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeClassHierarchyCache.h"
+#include "Commands/SpirrowBridgeAssetPrefetcher.h"
 #include "GameFramework/InputSettings.h"
 #include "GameFramework/Pawn.h"
 #include "GameFramework/PlayerController.h"
@@ -10,6 +12,7 @@
 #include "EnhancedInputSubsystems.h"
 #include "AssetToolsModule.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Misc/PackageName.h"
 #include "UObject/SavePackage.h"
 #include "EditorAssetLibrary.h"
 #include "Engine/Blueprint.h"
@@ -104,6 +107,26 @@ TSharedPtr<FJsonObject> FSpirrowBridgeProjectCommands::HandleCommand(const FStri
     {
         return HandleFindFunctionCallers(Params);
     }
+    else if (CommandType == TEXT("prefetch_assets"))
+    {
+        return HandlePrefetchAssets(Params);
+    }
+    else if (CommandType == TEXT("get_prefetch_status"))
+    {
+        return HandleGetPrefetchStatus(Params);
+    }
+    else if (CommandType == TEXT("get_working_set"))
+    {
+        return HandleGetWorkingSet(Params);
+    }
+    else if (CommandType == TEXT("configure_working_set"))
+    {
+        return HandleConfigureWorkingSet(Params);
+    }
+    else if (CommandType == TEXT("trim_working_set"))
+    {
+        return HandleTrimWorkingSet(Params);
+    }
 
     return FSpirrowBridgeCommonUtils::CreateErrorResponse(
         ESpirrowErrorCode::UnknownCommand,
@@ -1032,6 +1055,52 @@ TSharedPtr<FJsonObject> FSpirrowBridgeProjectCommands::HandleCreateContentFolder
 }
 
 // ===== List Assets In Folder =====
+namespace
+{
+    /** Package flag names accepted by with_package_flags / without_package_flags */
+    bool ParsePackageFlagName(const FString& FlagName, uint32& OutFlag)
+    {
+        static const TPair<const TCHAR*, uint32> KnownFlags[] = {
+            { TEXT("EditorOnly"),       PKG_EditorOnly },
+            { TEXT("UncookedOnly"),     PKG_UncookedOnly },
+            { TEXT("ContainsMap"),      PKG_ContainsMap },
+            { TEXT("ContainsMapData"),  PKG_ContainsMapData },
+            { TEXT("Cooked"),           PKG_Cooked },
+            { TEXT("CompiledIn"),       PKG_CompiledIn },
+            { TEXT("RuntimeGenerated"), PKG_RuntimeGenerated },
+            { TEXT("NewlyCreated"),     PKG_NewlyCreated },
+        };
+
+        for (const TPair<const TCHAR*, uint32>& Known : KnownFlags)
+        {
+            if (FlagName.Equals(Known.Key, ESearchCase::IgnoreCase))
+            {
+                OutFlag = Known.Value;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /** Resolve a class name ("Blueprint", "UWidgetBlueprint") or path to a registry class path */
+    FTopLevelAssetPath ResolveAssetClassPath(const FString& ClassNameOrPath)
+    {
+        if (ClassNameOrPath.StartsWith(TEXT("/")))
+        {
+            return FTopLevelAssetPath(ClassNameOrPath);
+        }
+
+        FSpirrowBridgeClassHierarchyCache& Hierarchy = FSpirrowBridgeClassHierarchyCache::Get();
+        Hierarchy.EnsureBuilt();
+        const int32 ClassId = Hierarchy.FindClassId(ClassNameOrPath);
+        if (ClassId == INDEX_NONE || Hierarchy.GetEntries()[ClassId].bIsBlueprint)
+        {
+            return FTopLevelAssetPath();
+        }
+        return FTopLevelAssetPath(Hierarchy.GetEntries()[ClassId].Path);
+    }
+}
+
 TSharedPtr<FJsonObject> FSpirrowBridgeProjectCommands::HandleListAssetsInFolder(const TSharedPtr<FJsonObject>& Params)
 {
     FString FolderPath;
@@ -1042,24 +1111,166 @@ TSharedPtr<FJsonObject> FSpirrowBridgeProjectCommands::HandleListAssetsInFolder(
 
     FString ClassFilter;
     bool bRecursive = false;
+    bool bIncludeSubclasses = true;
     FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("class_filter"), ClassFilter, TEXT(""));
     FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("recursive"), bRecursive, false);
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("include_subclasses"), bIncludeSubclasses, true);
+
+    // Everything below is pushed into FARFilter so the registry's indexed
+    // lookup does the filtering instead of a folder scan plus string matching.
+    FARFilter Filter;
+    Filter.PackagePaths.Add(FName(*FolderPath));
+    Filter.bRecursivePaths = bRecursive;
+    Filter.bRecursiveClasses = bIncludeSubclasses;
+
+    TArray<FString> ClassNames;
+    if (!ClassFilter.IsEmpty())
+    {
+        ClassNames.Add(ClassFilter);
+    }
+    const TArray<TSharedPtr<FJsonValue>>* ClassPathsArray = nullptr;
+    if (Params->TryGetArrayField(TEXT("class_paths"), ClassPathsArray))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *ClassPathsArray)
+        {
+            ClassNames.Add(Value->AsString());
+        }
+    }
+
+    // Unresolvable class names fall back to the legacy substring match
+    TArray<FString> SubstringClassFilters;
+    TArray<FTopLevelAssetPath> ResolvedClassPaths;
+    TArray<TSharedPtr<FJsonValue>> ResolvedClassesArray;
+    for (const FString& ClassName : ClassNames)
+    {
+        const FTopLevelAssetPath ClassPath = ResolveAssetClassPath(ClassName);
+        if (ClassPath.IsValid())
+        {
+            ResolvedClassPaths.Add(ClassPath);
+            ResolvedClassesArray.Add(MakeShared<FJsonValueString>(ClassPath.ToString()));
+        }
+        else
+        {
+            SubstringClassFilters.Add(ClassName);
+        }
+    }
+
+    // Class names are OR'ed. FARFilter ANDs its class paths with any post-filter, so the
+    // registry only filters by class when every name resolved; otherwise all class matching
+    // happens in one post-filter below.
+    if (SubstringClassFilters.Num() == 0)
+    {
+        Filter.ClassPaths = ResolvedClassPaths;
+    }
+
+    // Tag/value predicates, e.g. {"ParentClass": "/Script/UMG.UserWidget"}.
+    // Values may be a string or an array of strings (OR semantics per tag).
+    const TSharedPtr<FJsonObject>* TagsObj = nullptr;
+    if (Params->TryGetObjectField(TEXT("tags"), TagsObj))
+    {
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& TagPair : (*TagsObj)->Values)
+        {
+            const FName TagName(*TagPair.Key);
+
+            TArray<FString> TagValues;
+            if (TagPair.Value->Type == EJson::Array)
+            {
+                for (const TSharedPtr<FJsonValue>& Value : TagPair.Value->AsArray())
+                {
+                    TagValues.Add(Value->AsString());
+                }
+            }
+            else if (TagPair.Value->Type == EJson::Null)
+            {
+                // Tag presence only
+                Filter.TagsAndValues.Add(TagName, TOptional<FString>());
+                continue;
+            }
+            else
+            {
+                TagValues.Add(TagPair.Value->AsString());
+            }
+
+            const bool bIsClassTag = TagName == FBlueprintTags::ParentClassPath || TagName == FBlueprintTags::NativeParentClassPath;
+            for (FString TagValue : TagValues)
+            {
+                if (bIsClassTag && !TagValue.StartsWith(TEXT("/")) && !TagValue.Contains(TEXT("'")))
+                {
+                    const FTopLevelAssetPath ClassPath = ResolveAssetClassPath(TagValue);
+                    if (ClassPath.IsValid())
+                    {
+                        TagValue = ClassPath.ToString();
+                    }
+                }
+
+                Filter.TagsAndValues.Add(TagName, TagValue);
+
+                // Class tags are stored as export text ("/Script/CoreUObject.Class'/Script/UMG.UserWidget'")
+                if (bIsClassTag && !TagValue.Contains(TEXT("'")))
+                {
+                    Filter.TagsAndValues.Add(TagName, FString::Printf(TEXT("/Script/CoreUObject.Class'%s'"), *TagValue));
+                }
+            }
+        }
+    }
+
+    // Package flag predicates
+    auto ParseFlagArray = [&Params](const TCHAR* FieldName, uint32& OutFlags, FString& OutUnknown) -> bool
+    {
+        const TArray<TSharedPtr<FJsonValue>>* FlagsArray = nullptr;
+        if (!Params->TryGetArrayField(FieldName, FlagsArray))
+        {
+            return true;
+        }
+        for (const TSharedPtr<FJsonValue>& Value : *FlagsArray)
+        {
+            uint32 Flag = 0;
+            if (!ParsePackageFlagName(Value->AsString(), Flag))
+            {
+                OutUnknown = Value->AsString();
+                return false;
+            }
+            OutFlags |= Flag;
+        }
+        return true;
+    };
+
+    FString UnknownFlag;
+    if (!ParseFlagArray(TEXT("with_package_flags"), Filter.WithPackageFlags, UnknownFlag) ||
+        !ParseFlagArray(TEXT("without_package_flags"), Filter.WithoutPackageFlags, UnknownFlag))
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::InvalidParamValue,
+            FString::Printf(TEXT("Unknown package flag: %s (EditorOnly, UncookedOnly, ContainsMap, ContainsMapData, Cooked, CompiledIn, RuntimeGenerated, NewlyCreated)"), *UnknownFlag));
+    }
 
     FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
     IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
 
     TArray<FAssetData> AssetList;
-    AssetRegistry.GetAssetsByPath(FName(*FolderPath), AssetList, bRecursive);
+    AssetRegistry.GetAssets(Filter, AssetList);
+
+    // Resolved classes for the post-filter, expanded to subclasses like bRecursiveClasses would
+    TSet<FTopLevelAssetPath> PostFilterClasses(ResolvedClassPaths);
+    if (SubstringClassFilters.Num() > 0 && bIncludeSubclasses && ResolvedClassPaths.Num() > 0)
+    {
+        AssetRegistry.GetDerivedClassNames(ResolvedClassPaths, TSet<FTopLevelAssetPath>(), PostFilterClasses);
+    }
 
     TArray<TSharedPtr<FJsonValue>> AssetsArray;
+    AssetsArray.Reserve(AssetList.Num());
     for (const FAssetData& Asset : AssetList)
     {
         FString AssetClassName = Asset.AssetClassPath.GetAssetName().ToString();
 
-        // Apply class filter if specified
-        if (!ClassFilter.IsEmpty())
+        if (SubstringClassFilters.Num() > 0)
         {
-            if (!AssetClassName.Contains(ClassFilter))
+            bool bMatched = PostFilterClasses.Contains(Asset.AssetClassPath);
+            for (int32 FilterIndex = 0; !bMatched && FilterIndex < SubstringClassFilters.Num(); ++FilterIndex)
+            {
+                bMatched = AssetClassName.Contains(SubstringClassFilters[FilterIndex]);
+            }
+            if (!bMatched)
             {
                 continue;
             }
@@ -1077,6 +1288,10 @@ TSharedPtr<FJsonObject> FSpirrowBridgeProjectCommands::HandleListAssetsInFolder(
     ResultObj->SetArrayField(TEXT("assets"), AssetsArray);
     ResultObj->SetNumberField(TEXT("count"), AssetsArray.Num());
     ResultObj->SetStringField(TEXT("folder_path"), FolderPath);
+    if (ResolvedClassesArray.Num() > 0)
+    {
+        ResultObj->SetArrayField(TEXT("class_paths"), ResolvedClassesArray);
+    }
     return ResultObj;
 }
 
@@ -1323,6 +1538,59 @@ TSharedPtr<FJsonObject> FSpirrowBridgeProjectCommands::HandleGetProjectInfo(cons
 }
 
 // ===== Find Asset References =====
+namespace
+{
+    /**
+     * Breadth-first walk over the asset registry's package dependency graph.
+     * Nodes are interned into a dense index so the visited set is a bitset and
+     * the result can be emitted as integer adjacency lists instead of strings.
+     */
+    struct FAssetReferenceGraph
+    {
+        TArray<FName> Packages;
+        TArray<int32> Depths;
+        TArray<int32> ClassIndices;
+        TArray<TArray<int32>> ReferencerEdges;
+        TArray<TArray<int32>> DependencyEdges;
+        TArray<FName> ClassTable;
+        TMap<FName, int32> PackageToIndex;
+        TMap<FName, int32> ClassToIndex;
+        bool bTruncated = false;
+
+        int32 FindOrAddNode(IAssetRegistry& AssetRegistry, FName PackageName, int32 Depth, bool& bOutAdded)
+        {
+            bOutAdded = false;
+            if (const int32* Existing = PackageToIndex.Find(PackageName))
+            {
+                // Reached again by the other direction's walk: keep the shorter distance
+                Depths[*Existing] = FMath::Min(Depths[*Existing], Depth);
+                return *Existing;
+            }
+
+            const int32 Index = Packages.Add(PackageName);
+            PackageToIndex.Add(PackageName, Index);
+            Depths.Add(Depth);
+            ReferencerEdges.AddDefaulted();
+            DependencyEdges.AddDefaulted();
+
+            // Resolve the primary asset class from cached registry data (no load)
+            FName ClassName = NAME_None;
+            TArray<FAssetData> PackageAssets;
+            AssetRegistry.GetAssetsByPackageName(PackageName, PackageAssets, /*bIncludeOnlyOnDiskAssets=*/true);
+            if (PackageAssets.Num() > 0)
+            {
+                ClassName = PackageAssets[0].AssetClassPath.GetAssetName();
+            }
+
+            int32* ClassIndex = ClassToIndex.Find(ClassName);
+            ClassIndices.Add(ClassIndex ? *ClassIndex : ClassToIndex.Add(ClassName, ClassTable.Add(ClassName)));
+
+            bOutAdded = true;
+            return Index;
+        }
+    };
+}
+
 TSharedPtr<FJsonObject> FSpirrowBridgeProjectCommands::HandleFindAssetReferences(const TSharedPtr<FJsonObject>& Params)
 {
     FString AssetPath;
@@ -1331,28 +1599,168 @@ TSharedPtr<FJsonObject> FSpirrowBridgeProjectCommands::HandleFindAssetReferences
         return Error;
     }
 
+    // Traversal options. Defaults keep the original direct-only depth, but only Package-category
+    // edges are followed and /Script packages are skipped unless include_script_packages is set.
+    double MaxDepthValue = 1.0;
+    double MaxNodesValue = 5000.0;
+    FString Direction;
+    bool bIncludeHard = true;
+    bool bIncludeSoft = true;
+    bool bIncludeScriptPackages = false;
+    FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("max_depth"), MaxDepthValue, 1.0);
+    FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("max_nodes"), MaxNodesValue, 5000.0);
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("direction"), Direction, TEXT("both"));
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("include_hard"), bIncludeHard, true);
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("include_soft"), bIncludeSoft, true);
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("include_script_packages"), bIncludeScriptPackages, false);
+
+    const int32 MaxDepth = FMath::Max(0, static_cast<int32>(MaxDepthValue));  // 0 = unlimited
+    const int32 MaxNodes = FMath::Max(1, static_cast<int32>(MaxNodesValue));
+
+    const bool bWalkReferencers = Direction.Equals(TEXT("both"), ESearchCase::IgnoreCase) || Direction.Equals(TEXT("referencers"), ESearchCase::IgnoreCase);
+    const bool bWalkDependencies = Direction.Equals(TEXT("both"), ESearchCase::IgnoreCase) || Direction.Equals(TEXT("dependencies"), ESearchCase::IgnoreCase);
+    if (!bWalkReferencers && !bWalkDependencies)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::InvalidParamValue,
+            FString::Printf(TEXT("Invalid direction '%s'. Use 'referencers', 'dependencies' or 'both'"), *Direction));
+    }
+    if (!bIncludeHard && !bIncludeSoft)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::InvalidParamValue,
+            TEXT("include_hard and include_soft cannot both be false"));
+    }
+
+    // Optional class filter (matched against the asset class short name, e.g. "Blueprint")
+    TSet<FName> ClassFilter;
+    const TArray<TSharedPtr<FJsonValue>>* ClassFilterArray = nullptr;
+    if (Params->TryGetArrayField(TEXT("class_filter"), ClassFilterArray))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *ClassFilterArray)
+        {
+            ClassFilter.Add(FName(*Value->AsString()));
+        }
+    }
+    else if (Params->HasTypedField<EJson::String>(TEXT("class_filter")))
+    {
+        ClassFilter.Add(FName(*Params->GetStringField(TEXT("class_filter"))));
+    }
+
     FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
     IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
 
-    // Get referencers (assets that reference this asset)
-    TArray<FAssetIdentifier> Referencers;
-    FAssetIdentifier AssetId = FAssetIdentifier(FName(*AssetPath));
-    AssetRegistry.GetReferencers(AssetId, Referencers);
+    // Accept both "/Game/Foo/Bar" and "/Game/Foo/Bar.Bar"
+    const FName RootPackage(*FPackageName::ObjectPathToPackageName(AssetPath));
 
-    TArray<TSharedPtr<FJsonValue>> ReferencersArray;
-    for (const FAssetIdentifier& Ref : Referencers)
+    UE::AssetRegistry::EDependencyQuery QueryFlags = UE::AssetRegistry::EDependencyQuery::NoRequirements;
+    if (bIncludeHard && !bIncludeSoft)
     {
-        ReferencersArray.Add(MakeShared<FJsonValueString>(Ref.ToString()));
+        QueryFlags = UE::AssetRegistry::EDependencyQuery::Hard;
     }
+    else if (bIncludeSoft && !bIncludeHard)
+    {
+        QueryFlags = UE::AssetRegistry::EDependencyQuery::Soft;
+    }
+    const UE::AssetRegistry::FDependencyQuery Query(QueryFlags);
+
+    FAssetReferenceGraph Graph;
+    bool bAdded = false;
+    Graph.FindOrAddNode(AssetRegistry, RootPackage, 0, bAdded);
 
-    // Get dependencies (assets that this asset references)
-    TArray<FAssetIdentifier> Dependencies;
-    AssetRegistry.GetDependencies(AssetId, Dependencies);
+    TArray<FName> Neighbours;
+
+    // Expand one edge list for a node, interning neighbours and queuing the ones this walk has not seen
+    auto ExpandEdges = [&](int32 NodeIndex, int32 Depth, bool bReferencers, TBitArray<>& Queued, TArray<int32>& NextFrontier)
+    {
+        Neighbours.Reset();
+        if (bReferencers)
+        {
+            AssetRegistry.GetReferencers(Graph.Packages[NodeIndex], Neighbours, UE::AssetRegistry::EDependencyCategory::Package, Query);
+        }
+        else
+        {
+            AssetRegistry.GetDependencies(Graph.Packages[NodeIndex], Neighbours, UE::AssetRegistry::EDependencyCategory::Package, Query);
+        }
+
+        const int32 ChildDepth = Depth + 1;
+        for (const FName& Neighbour : Neighbours)
+        {
+            if (!bIncludeScriptPackages && FPackageName::IsScriptPackage(Neighbour.ToString()))
+            {
+                continue;
+            }
+            if (!Graph.PackageToIndex.Contains(Neighbour) && Graph.Packages.Num() >= MaxNodes)
+            {
+                Graph.bTruncated = true;
+                continue;
+            }
+
+            bool bNewNode = false;
+            const int32 NeighbourIndex = Graph.FindOrAddNode(AssetRegistry, Neighbour, ChildDepth, bNewNode);
+            (bReferencers ? Graph.ReferencerEdges : Graph.DependencyEdges)[NodeIndex].Add(NeighbourIndex);
+            if (NeighbourIndex >= Queued.Num())
+            {
+                Queued.Add(false, Graph.Packages.Num() - Queued.Num());
+            }
+            if (!Queued[NeighbourIndex])
+            {
+                Queued[NeighbourIndex] = true;
+                NextFrontier.Add(NeighbourIndex);
+            }
+        }
+    };
+
+    // One level-synchronous BFS per direction. Each walk only follows its own edge kind, so a
+    // referencer's other dependencies (the root's siblings) are never pulled in. Within a walk
+    // every package is queued at most once, which also makes reference cycles terminate.
+    auto Walk = [&](bool bReferencers)
+    {
+        TBitArray<> Queued(false, Graph.Packages.Num());
+        Queued[0] = true;
+        TArray<int32> Frontier;
+        Frontier.Add(0);
+        for (int32 Depth = 0; Frontier.Num() > 0 && (MaxDepth == 0 || Depth < MaxDepth); ++Depth)
+        {
+            TArray<int32> NextFrontier;
+            for (const int32 NodeIndex : Frontier)
+            {
+                ExpandEdges(NodeIndex, Depth, bReferencers, Queued, NextFrontier);
+            }
+            Frontier = MoveTemp(NextFrontier);
+        }
+    };
+    if (bWalkReferencers)
+    {
+        Walk(true);
+    }
+    if (bWalkDependencies)
+    {
+        Walk(false);
+    }
+
+    auto MatchesClassFilter = [&](int32 NodeIndex)
+    {
+        return ClassFilter.Num() == 0 || ClassFilter.Contains(Graph.ClassTable[Graph.ClassIndices[NodeIndex]]);
+    };
+
+    // Direct neighbours keep the original flat string arrays for backwards compatibility
+    TArray<TSharedPtr<FJsonValue>> ReferencersArray;
+    for (const int32 Index : Graph.ReferencerEdges[0])
+    {
+        if (MatchesClassFilter(Index))
+        {
+            ReferencersArray.Add(MakeShared<FJsonValueString>(Graph.Packages[Index].ToString()));
+        }
+    }
 
     TArray<TSharedPtr<FJsonValue>> DependenciesArray;
-    for (const FAssetIdentifier& Dep : Dependencies)
+    for (const int32 Index : Graph.DependencyEdges[0])
     {
-        DependenciesArray.Add(MakeShared<FJsonValueString>(Dep.ToString()));
+        if (MatchesClassFilter(Index))
+        {
+            DependenciesArray.Add(MakeShared<FJsonValueString>(Graph.Packages[Index].ToString()));
+        }
     }
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
@@ -1362,6 +1770,75 @@ TSharedPtr<FJsonObject> FSpirrowBridgeProjectCommands::HandleFindAssetReferences
     ResultObj->SetNumberField(TEXT("referencers_count"), ReferencersArray.Num());
     ResultObj->SetArrayField(TEXT("dependencies"), DependenciesArray);
     ResultObj->SetNumberField(TEXT("dependencies_count"), DependenciesArray.Num());
+
+    if (MaxDepth == 1)
+    {
+        return ResultObj;
+    }
+
+    // Compact adjacency list: nodes are indices into "nodes", classes into "classes"
+    auto MakeIndexArray = [](const TArray<int32>& Indices)
+    {
+        TArray<TSharedPtr<FJsonValue>> Values;
+        Values.Reserve(Indices.Num());
+        for (const int32 Index : Indices)
+        {
+            Values.Add(MakeShared<FJsonValueNumber>(Index));
+        }
+        return Values;
+    };
+
+    TArray<TSharedPtr<FJsonValue>> NodesArray;
+    TArray<TSharedPtr<FJsonValue>> NodeClassArray;
+    TArray<TSharedPtr<FJsonValue>> DepthArray;
+    TArray<TSharedPtr<FJsonValue>> ReferencerAdjacency;
+    TArray<TSharedPtr<FJsonValue>> DependencyAdjacency;
+    TArray<int32> MatchedIndices;
+    for (int32 Index = 0; Index < Graph.Packages.Num(); ++Index)
+    {
+        NodesArray.Add(MakeShared<FJsonValueString>(Graph.Packages[Index].ToString()));
+        NodeClassArray.Add(MakeShared<FJsonValueNumber>(Graph.ClassIndices[Index]));
+        DepthArray.Add(MakeShared<FJsonValueNumber>(Graph.Depths[Index]));
+        if (bWalkReferencers)
+        {
+            ReferencerAdjacency.Add(MakeShared<FJsonValueArray>(MakeIndexArray(Graph.ReferencerEdges[Index])));
+        }
+        if (bWalkDependencies)
+        {
+            DependencyAdjacency.Add(MakeShared<FJsonValueArray>(MakeIndexArray(Graph.DependencyEdges[Index])));
+        }
+        if (Index > 0 && MatchesClassFilter(Index))
+        {
+            MatchedIndices.Add(Index);
+        }
+    }
+
+    TArray<TSharedPtr<FJsonValue>> ClassesArray;
+    for (const FName& ClassName : Graph.ClassTable)
+    {
+        ClassesArray.Add(MakeShared<FJsonValueString>(ClassName.IsNone() ? FString() : ClassName.ToString()));
+    }
+
+    TSharedPtr<FJsonObject> GraphObj = MakeShared<FJsonObject>();
+    GraphObj->SetArrayField(TEXT("nodes"), NodesArray);
+    GraphObj->SetArrayField(TEXT("classes"), ClassesArray);
+    GraphObj->SetArrayField(TEXT("node_class"), NodeClassArray);
+    GraphObj->SetArrayField(TEXT("depth"), DepthArray);
+    if (bWalkReferencers)
+    {
+        GraphObj->SetArrayField(TEXT("referencers"), ReferencerAdjacency);
+    }
+    if (bWalkDependencies)
+    {
+        GraphObj->SetArrayField(TEXT("dependencies"), DependencyAdjacency);
+    }
+    GraphObj->SetArrayField(TEXT("matched"), MakeIndexArray(MatchedIndices));
+
+    ResultObj->SetObjectField(TEXT("graph"), GraphObj);
+    ResultObj->SetNumberField(TEXT("node_count"), Graph.Packages.Num());
+    ResultObj->SetNumberField(TEXT("matched_count"), MatchedIndices.Num());
+    ResultObj->SetNumberField(TEXT("max_depth"), MaxDepth);
+    ResultObj->SetBoolField(TEXT("truncated"), Graph.bTruncated);
     return ResultObj;
 }
 
@@ -1526,3 +2003,167 @@ TSharedPtr<FJsonObject> FSpirrowBridgeProjectCommands::HandleFindFunctionCallers
 
     return ResultObj;
 }
+
+// ===== Prefetch Assets =====
+TSharedPtr<FJsonObject> FSpirrowBridgeProjectCommands::HandlePrefetchAssets(const TSharedPtr<FJsonObject>& Params)
+{
+    FString FolderPath, ClassFilter;
+    bool bRecursive = true;
+    double PriorityValue = 0.0;
+    double MaxAssetsValue = 2000.0;
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("folder_path"), FolderPath, TEXT(""));
+    FSpirrowBridgeCommonUtils::GetOptionalString(Params, TEXT("class_filter"), ClassFilter, TEXT(""));
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("recursive"), bRecursive, true);
+    FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("priority"), PriorityValue, 0.0);
+    FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("max_assets"), MaxAssetsValue, 2000.0);
+    const int32 MaxAssets = FMath::Max(1, static_cast<int32>(MaxAssetsValue));
+
+    const TArray<TSharedPtr<FJsonValue>>* AssetPathsArray = nullptr;
+    Params->TryGetArrayField(TEXT("asset_paths"), AssetPathsArray);
+
+    if (FolderPath.IsEmpty() && (!AssetPathsArray || AssetPathsArray->Num() == 0))
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::MissingRequiredParam,
+            TEXT("Missing required parameter: asset_paths or folder_path"));
+    }
+
+    TArray<FName> PackageNames;
+    TSet<FName> SeenPackages;
+    auto AddPackage = [&PackageNames, &SeenPackages](FName PackageName)
+    {
+        bool bAlreadySeen = false;
+        SeenPackages.Add(PackageName, &bAlreadySeen);
+        if (!bAlreadySeen)
+        {
+            PackageNames.Add(PackageName);
+        }
+    };
+
+    if (AssetPathsArray)
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *AssetPathsArray)
+        {
+            const FString AssetPath = Value->AsString();
+            if (!AssetPath.IsEmpty())
+            {
+                AddPackage(FName(*FPackageName::ObjectPathToPackageName(AssetPath)));
+            }
+        }
+    }
+
+    bool bTruncated = false;
+    if (!FolderPath.IsEmpty())
+    {
+        FARFilter Filter;
+        Filter.PackagePaths.Add(FName(*FolderPath));
+        Filter.bRecursivePaths = bRecursive;
+        if (!ClassFilter.IsEmpty())
+        {
+            const FTopLevelAssetPath ClassPath = ResolveAssetClassPath(ClassFilter);
+            if (!ClassPath.IsValid())
+            {
+                return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+                    ESpirrowErrorCode::ClassNotFound,
+                    FString::Printf(TEXT("Asset class not found: %s"), *ClassFilter));
+            }
+            Filter.ClassPaths.Add(ClassPath);
+            Filter.bRecursiveClasses = true;
+        }
+
+        IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+        TArray<FAssetData> AssetList;
+        AssetRegistry.GetAssets(Filter, AssetList);
+        for (const FAssetData& Asset : AssetList)
+        {
+            AddPackage(Asset.PackageName);
+        }
+    }
+
+    if (PackageNames.Num() > MaxAssets)
+    {
+        PackageNames.SetNum(MaxAssets);
+        bTruncated = true;
+    }
+
+    FSpirrowBridgeAssetPrefetcher::FBatchStats Stats;
+    const int32 BatchId = FSpirrowBridgeAssetPrefetcher::Get().Prefetch(PackageNames, static_cast<int32>(PriorityValue), Stats);
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetNumberField(TEXT("batch_id"), BatchId);
+    ResultObj->SetNumberField(TEXT("package_count"), PackageNames.Num());
+    ResultObj->SetNumberField(TEXT("requested"), Stats.Requested);
+    ResultObj->SetNumberField(TEXT("already_resident"), Stats.AlreadyResident);
+    ResultObj->SetNumberField(TEXT("skipped_already_queued"), PackageNames.Num() - Stats.Requested);
+    ResultObj->SetBoolField(TEXT("truncated"), bTruncated);
+    return ResultObj;
+}
+
+// ===== Get Prefetch Status =====
+TSharedPtr<FJsonObject> FSpirrowBridgeProjectCommands::HandleGetPrefetchStatus(const TSharedPtr<FJsonObject>& Params)
+{
+    double BatchIdValue = -1.0;
+    bool bIncludeAssets = false;
+    bool bClearCompleted = false;
+    FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("batch_id"), BatchIdValue, -1.0);
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("include_assets"), bIncludeAssets, false);
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("clear_completed"), bClearCompleted, false);
+    const int32 BatchId = BatchIdValue < 0.0 ? INDEX_NONE : static_cast<int32>(BatchIdValue);
+
+    FSpirrowBridgeAssetPrefetcher& Prefetcher = FSpirrowBridgeAssetPrefetcher::Get();
+    const FSpirrowBridgeAssetPrefetcher::FBatchStats Stats = Prefetcher.GetStats(BatchId);
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    if (BatchId != INDEX_NONE)
+    {
+        ResultObj->SetNumberField(TEXT("batch_id"), BatchId);
+    }
+    ResultObj->SetNumberField(TEXT("total"), Stats.Requested);
+    ResultObj->SetNumberField(TEXT("pending"), Stats.Pending);
+    ResultObj->SetNumberField(TEXT("loaded"), Stats.Loaded);
+    ResultObj->SetNumberField(TEXT("failed"), Stats.Failed);
+    ResultObj->SetNumberField(TEXT("progress"), Stats.Requested > 0 ? static_cast<double>(Stats.Loaded + Stats.Failed) / Stats.Requested : 1.0);
+    ResultObj->SetBoolField(TEXT("complete"), Stats.Pending == 0);
+
+    if (bIncludeAssets)
+    {
+        const double Now = FPlatformTime::Seconds();
+        TArray<TSharedPtr<FJsonValue>> AssetsArray;
+        for (const TPair<FName, FSpirrowBridgeAssetPrefetcher::FPrefetchEntry>& Pair : Prefetcher.GetEntries())
+        {
+            if (BatchId != INDEX_NONE && Pair.Value.BatchId != BatchId)
+            {
+                continue;
+            }
+
+            const TCHAR* StateName = TEXT("pending");
+            if (Pair.Value.State == FSpirrowBridgeAssetPrefetcher::EPrefetchState::Loaded)
+            {
+                StateName = TEXT("loaded");
+            }
+            else if (Pair.Value.State == FSpirrowBridgeAssetPrefetcher::EPrefetchState::Failed)
+            {
+                StateName = TEXT("failed");
+            }
+
+            const double EndTime = Pair.Value.State == FSpirrowBridgeAssetPrefetcher::EPrefetchState::Pending ? Now : Pair.Value.CompleteTime;
+
+            TSharedPtr<FJsonObject> AssetObj = MakeShared<FJsonObject>();
+            AssetObj->SetStringField(TEXT("package"), Pair.Key.ToString());
+            AssetObj->SetStringField(TEXT("state"), StateName);
+            AssetObj->SetNumberField(TEXT("batch_id"), Pair.Value.BatchId);
+            AssetObj->SetNumberField(TEXT("elapsed_ms"), (EndTime - Pair.Value.RequestTime) * 1000.0);
+            AssetsArray.Add(MakeShared<FJsonValueObject>(AssetObj));
+        }
+        ResultObj->SetArrayField(TEXT("assets"), AssetsArray);
+    }
+
+    if (bClearCompleted)
+    {
+        ResultObj->SetNumberField(TEXT("cleared"), Prefetcher.ClearCompleted());
+    }
+
+    return ResultObj;
+}
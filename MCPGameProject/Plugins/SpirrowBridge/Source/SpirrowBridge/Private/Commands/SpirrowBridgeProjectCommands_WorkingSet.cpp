@@ -0,0 +1,163 @@
+#include "Commands/SpirrowBridgeProjectCommands.h"
+#include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeAssetWorkingSet.h"
+#include "UObject/Package.h"
+
+namespace
+{
+    TSharedPtr<FJsonObject> MakeWorkingSetSettingsJson(const FSpirrowBridgeAssetWorkingSet::FSettings& Settings)
+    {
+        TSharedPtr<FJsonObject> SettingsObj = MakeShared<FJsonObject>();
+        SettingsObj->SetBoolField(TEXT("enabled"), Settings.bEnabled);
+        SettingsObj->SetNumberField(TEXT("max_packages"), Settings.MaxPackages);
+        SettingsObj->SetNumberField(TEXT("memory_cap_mb"), Settings.MemoryCapMB);
+        SettingsObj->SetBoolField(TEXT("save_dirty"), Settings.bSaveDirty);
+        SettingsObj->SetNumberField(TEXT("gc_interval_commands"), Settings.GCIntervalCommands);
+        return SettingsObj;
+    }
+
+    TArray<TSharedPtr<FJsonValue>> NamesToJsonArray(const TArray<FName>& Names)
+    {
+        TArray<TSharedPtr<FJsonValue>> Array;
+        Array.Reserve(Names.Num());
+        for (const FName& Name : Names)
+        {
+            Array.Add(MakeShared<FJsonValueString>(Name.ToString()));
+        }
+        return Array;
+    }
+}
+
+// ===== Get Working Set =====
+TSharedPtr<FJsonObject> FSpirrowBridgeProjectCommands::HandleGetWorkingSet(const TSharedPtr<FJsonObject>& Params)
+{
+    bool bIncludePackages = false;
+    double LimitValue = 100.0;
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("include_packages"), bIncludePackages, false);
+    FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("limit"), LimitValue, 100.0);
+
+    const FSpirrowBridgeAssetWorkingSet& WorkingSet = FSpirrowBridgeAssetWorkingSet::Get();
+    const TMap<FName, FSpirrowBridgeAssetWorkingSet::FTrackedPackage>& Tracked = WorkingSet.GetTrackedPackages();
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetObjectField(TEXT("settings"), MakeWorkingSetSettingsJson(WorkingSet.GetSettings()));
+    ResultObj->SetNumberField(TEXT("tracked_count"), Tracked.Num());
+    ResultObj->SetNumberField(TEXT("tracked_disk_mb"), WorkingSet.GetTrackedDiskBytes() / (1024.0 * 1024.0));
+    ResultObj->SetNumberField(TEXT("used_physical_mb"), FSpirrowBridgeAssetWorkingSet::GetUsedPhysicalMB());
+    ResultObj->SetNumberField(TEXT("total_unloaded"), WorkingSet.GetTotalUnloaded());
+    ResultObj->SetNumberField(TEXT("trim_count"), WorkingSet.GetTrimCount());
+
+    if (bIncludePackages)
+    {
+        // Most recently used first
+        TArray<FName> PackageNames;
+        Tracked.GetKeys(PackageNames);
+        PackageNames.Sort([&Tracked](const FName& A, const FName& B)
+        {
+            return Tracked[A].LastUseSerial > Tracked[B].LastUseSerial;
+        });
+
+        const uint64 CurrentSerial = WorkingSet.GetCommandSerial();
+        const int32 Limit = LimitValue <= 0.0 ? PackageNames.Num() : FMath::Min(PackageNames.Num(), static_cast<int32>(LimitValue));
+
+        TArray<TSharedPtr<FJsonValue>> PackagesArray;
+        for (int32 Index = 0; Index < Limit; ++Index)
+        {
+            const FSpirrowBridgeAssetWorkingSet::FTrackedPackage& Entry = Tracked[PackageNames[Index]];
+            const UPackage* Package = Entry.Package.Get();
+
+            TSharedPtr<FJsonObject> PackageObj = MakeShared<FJsonObject>();
+            PackageObj->SetStringField(TEXT("package"), PackageNames[Index].ToString());
+            PackageObj->SetStringField(TEXT("loaded_by"), Entry.LoadedBy);
+            PackageObj->SetNumberField(TEXT("commands_since_use"), static_cast<double>(CurrentSerial - Entry.LastUseSerial));
+            PackageObj->SetNumberField(TEXT("disk_kb"), Entry.DiskSize / 1024.0);
+            PackageObj->SetBoolField(TEXT("dirty"), Package && Package->IsDirty());
+            PackagesArray.Add(MakeShared<FJsonValueObject>(PackageObj));
+        }
+        ResultObj->SetArrayField(TEXT("packages"), PackagesArray);
+        ResultObj->SetBoolField(TEXT("truncated"), Limit < PackageNames.Num());
+    }
+
+    return ResultObj;
+}
+
+// ===== Configure Working Set =====
+TSharedPtr<FJsonObject> FSpirrowBridgeProjectCommands::HandleConfigureWorkingSet(const TSharedPtr<FJsonObject>& Params)
+{
+    FSpirrowBridgeAssetWorkingSet& WorkingSet = FSpirrowBridgeAssetWorkingSet::Get();
+    FSpirrowBridgeAssetWorkingSet::FSettings Settings = WorkingSet.GetSettings();
+
+    double MaxPackages = Settings.MaxPackages;
+    double MemoryCapMB = Settings.MemoryCapMB;
+    double GCInterval = Settings.GCIntervalCommands;
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("enabled"), Settings.bEnabled, Settings.bEnabled);
+    FSpirrowBridgeCommonUtils::GetOptionalBool(Params, TEXT("save_dirty"), Settings.bSaveDirty, Settings.bSaveDirty);
+    FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("max_packages"), MaxPackages, MaxPackages);
+    FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("memory_cap_mb"), MemoryCapMB, MemoryCapMB);
+    FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("gc_interval_commands"), GCInterval, GCInterval);
+
+    if (MaxPackages < 0.0 || MemoryCapMB < 0.0 || GCInterval < 0.0)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::InvalidParamValue,
+            TEXT("max_packages, memory_cap_mb and gc_interval_commands must be >= 0"));
+    }
+
+    Settings.MaxPackages = static_cast<int32>(MaxPackages);
+    Settings.MemoryCapMB = static_cast<int32>(MemoryCapMB);
+    Settings.GCIntervalCommands = static_cast<int32>(GCInterval);
+    WorkingSet.SetSettings(Settings);
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetObjectField(TEXT("settings"), MakeWorkingSetSettingsJson(Settings));
+    ResultObj->SetNumberField(TEXT("tracked_count"), WorkingSet.GetTrackedPackages().Num());
+    return ResultObj;
+}
+
+// ===== Trim Working Set =====
+TSharedPtr<FJsonObject> FSpirrowBridgeProjectCommands::HandleTrimWorkingSet(const TSharedPtr<FJsonObject>& Params)
+{
+    FSpirrowBridgeAssetWorkingSet& WorkingSet = FSpirrowBridgeAssetWorkingSet::Get();
+
+    // Default: unload every eligible package
+    double TargetPackages = 0.0;
+    double FreeMB = 0.0;
+    FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("target_packages"), TargetPackages, 0.0);
+    FSpirrowBridgeCommonUtils::GetOptionalNumber(Params, TEXT("free_mb"), FreeMB, 0.0);
+
+    if (TargetPackages < 0.0 || FreeMB < 0.0)
+    {
+        return FSpirrowBridgeCommonUtils::CreateErrorResponse(
+            ESpirrowErrorCode::InvalidParamValue,
+            TEXT("target_packages and free_mb must be >= 0"));
+    }
+
+    const int32 TrackedBefore = WorkingSet.GetTrackedPackages().Num();
+    const int64 UsedBeforeMB = FSpirrowBridgeAssetWorkingSet::GetUsedPhysicalMB();
+
+    const FSpirrowBridgeAssetWorkingSet::FTrimResult Result = WorkingSet.Trim(
+        static_cast<int32>(TargetPackages),
+        static_cast<int64>(FreeMB * 1024.0 * 1024.0));
+
+    // A failed unload still reports what was saved and unloaded before it; success:false
+    // would make the wrapper drop those lists
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetBoolField(TEXT("unload_failed"), Result.bUnloadFailed);
+    if (Result.bUnloadFailed)
+    {
+        ResultObj->SetStringField(TEXT("error"), FString::Printf(TEXT("Failed to unload packages: %s"), *Result.ErrorMessage));
+    }
+    ResultObj->SetNumberField(TEXT("tracked_before"), TrackedBefore);
+    ResultObj->SetNumberField(TEXT("tracked_after"), WorkingSet.GetTrackedPackages().Num());
+    ResultObj->SetArrayField(TEXT("unloaded"), NamesToJsonArray(Result.Unloaded));
+    ResultObj->SetArrayField(TEXT("saved"), NamesToJsonArray(Result.Saved));
+    ResultObj->SetNumberField(TEXT("skipped_dirty"), Result.SkippedDirty);
+    ResultObj->SetNumberField(TEXT("skipped_open_in_editor"), Result.SkippedOpenInEditor);
+    ResultObj->SetNumberField(TEXT("estimated_freed_mb"), Result.EstimatedBytesFreed / (1024.0 * 1024.0));
+    ResultObj->SetNumberField(TEXT("used_physical_mb_before"), UsedBeforeMB);
+    ResultObj->SetNumberField(TEXT("used_physical_mb_after"), FSpirrowBridgeAssetWorkingSet::GetUsedPhysicalMB());
+    return ResultObj;
+}
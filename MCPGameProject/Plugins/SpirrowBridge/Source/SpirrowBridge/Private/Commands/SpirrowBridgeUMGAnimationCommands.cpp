@@ -1,5 +1,6 @@
 #include "Commands/SpirrowBridgeUMGAnimationCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeCompileQueue.h"
 #include "Editor.h"
 #include "EditorAssetLibrary.h"
 #include "Blueprint/UserWidget.h"
@@ -136,11 +137,12 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGAnimationCommands::HandleCreateWidgetAn
 
 	// Mark Blueprint as modified and compile
 	FBlueprintEditorUtils::MarkBlueprintAsModified(WidgetBP);
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 	// Create success response
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	ResultObj->SetStringField(TEXT("widget_name"), WidgetName);
 	ResultObj->SetStringField(TEXT("animation_name"), AnimationName);
 	ResultObj->SetStringField(TEXT("animation_id"), NewAnimation->GetPathName());
@@ -347,11 +349,12 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGAnimationCommands::HandleAddAnimationTr
 
 	// Save
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 	// Create response
 	TSharedPtr<FJsonObject> Response = MakeShareable(new FJsonObject());
 	Response->SetBoolField(TEXT("success"), true);
+	Response->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	Response->SetStringField(TEXT("widget_name"), WidgetName);
 	Response->SetStringField(TEXT("animation_name"), AnimationName);
 	Response->SetStringField(TEXT("target_widget"), TargetWidgetName);
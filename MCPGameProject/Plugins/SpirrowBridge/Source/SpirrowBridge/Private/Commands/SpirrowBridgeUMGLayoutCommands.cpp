@@ -1,5 +1,6 @@
 #include "Commands/SpirrowBridgeUMGLayoutCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeCompileQueue.h"
 #include "EditorAssetLibrary.h"
 #include "Blueprint/UserWidget.h"
 #include "Components/TextBlock.h"
@@ -582,10 +583,11 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGLayoutCommands::HandleSetWidgetSlotProp
 		// Successfully handled by a non-CanvasPanel branch above; finalize and return.
 		WidgetBP->Modify();
 		WidgetBP->MarkPackageDirty();
-		FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+		const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 		TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 		ResultObj->SetBoolField(TEXT("success"), true);
+		ResultObj->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 		ResultObj->SetStringField(TEXT("widget_name"), WidgetName);
 		ResultObj->SetStringField(TEXT("element_name"), ElementName);
 		ResultObj->SetStringField(TEXT("slot_type"), AppliedSlotType);
@@ -749,11 +751,12 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGLayoutCommands::HandleSetWidgetSlotProp
 	// Mark as modified and compile
 	WidgetBP->Modify();
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 	// Create success response
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	ResultObj->SetStringField(TEXT("widget_name"), WidgetName);
 	ResultObj->SetStringField(TEXT("element_name"), ElementName);
 	ResultObj->SetStringField(TEXT("slot_type"), AppliedSlotType);
@@ -1052,11 +1055,12 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGLayoutCommands::HandleSetWidgetElementP
 	// Mark as modified and compile
 	WidgetBP->Modify();
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 	// Create success response
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	ResultObj->SetStringField(TEXT("widget_name"), WidgetName);
 	ResultObj->SetStringField(TEXT("element_name"), ElementName);
 	ResultObj->SetStringField(TEXT("property_name"), PropertyName);
@@ -1184,11 +1188,12 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGLayoutCommands::HandleAddVerticalBoxToW
 	// Mark as modified and compile
 	WidgetBP->Modify();
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 	// Create success response
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	ResultObj->SetStringField(TEXT("widget_name"), WidgetName);
 	ResultObj->SetStringField(TEXT("box_name"), BoxName);
 	ResultObj->SetStringField(TEXT("parent"), Parent->GetName());
@@ -1311,10 +1316,11 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGLayoutCommands::HandleAddWidgetSwitcher
 
 	WidgetBP->Modify();
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	ResultObj->SetStringField(TEXT("widget_name"), WidgetName);
 	ResultObj->SetStringField(TEXT("switcher_name"), SwitcherName);
 	ResultObj->SetStringField(TEXT("parent"), Parent->GetName());
@@ -1443,11 +1449,12 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGLayoutCommands::HandleAddHorizontalBoxT
 	// Mark as modified and compile
 	WidgetBP->Modify();
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 	// Create success response
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	ResultObj->SetStringField(TEXT("widget_name"), WidgetName);
 	ResultObj->SetStringField(TEXT("box_name"), BoxName);
 	ResultObj->SetStringField(TEXT("parent"), Parent->GetName());
@@ -1598,10 +1605,11 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGLayoutCommands::HandleReparentWidgetEle
 	// tree on its own.
 	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(WidgetBP);
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	ResultObj->SetStringField(TEXT("widget_name"), WidgetName);
 	ResultObj->SetStringField(TEXT("element_name"), ElementName);
 	ResultObj->SetStringField(TEXT("old_parent"), OldParentName);
@@ -1690,7 +1698,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGLayoutCommands::HandleRemoveWidgetEleme
 
 	// Mark package dirty and recompile
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 	// Verify removal
 	UWidget* VerifyWidget = WidgetTree->FindWidget(FName(*ElementName));
@@ -1704,6 +1712,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGLayoutCommands::HandleRemoveWidgetEleme
 	// Create success response
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	ResultObj->SetStringField(TEXT("widget_name"), WidgetName);
 	ResultObj->SetStringField(TEXT("removed_element"), ElementName);
 	ResultObj->SetStringField(TEXT("former_parent"), ParentName);
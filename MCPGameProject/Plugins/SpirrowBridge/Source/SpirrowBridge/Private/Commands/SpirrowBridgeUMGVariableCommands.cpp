@@ -1,5 +1,6 @@
 #include "Commands/SpirrowBridgeUMGVariableCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeCompileQueue.h"
 #include "Editor.h"
 #include "EditorAssetLibrary.h"
 #include "Blueprint/UserWidget.h"
@@ -239,10 +240,11 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGVariableCommands::HandleAddWidgetVariab
 	}
 
 	FBlueprintEditorUtils::MarkBlueprintAsModified(WidgetBP);
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	ResultObj->SetStringField(TEXT("widget_name"), WidgetName);
 	ResultObj->SetStringField(TEXT("variable_name"), VariableName);
 	ResultObj->SetStringField(TEXT("variable_type"), VariableType);
@@ -298,10 +300,11 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGVariableCommands::HandleSetWidgetVariab
 	Variable->DefaultValue = DefaultValue;
 
 	FBlueprintEditorUtils::MarkBlueprintAsModified(WidgetBP);
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	ResultObj->SetStringField(TEXT("variable_name"), VariableName);
 	ResultObj->SetStringField(TEXT("default_value"), DefaultValue);
 	return ResultObj;
@@ -443,10 +446,11 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGVariableCommands::HandleAddWidgetFuncti
 	}
 
 	FBlueprintEditorUtils::MarkBlueprintAsModified(WidgetBP);
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	ResultObj->SetStringField(TEXT("function_name"), FunctionName);
 	ResultObj->SetStringField(TEXT("graph_id"), FuncGraph->GraphGuid.ToString());
 	return ResultObj;
@@ -526,10 +530,11 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGVariableCommands::HandleAddWidgetEvent(
 	}
 
 	FBlueprintEditorUtils::MarkBlueprintAsModified(WidgetBP);
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	ResultObj->SetStringField(TEXT("event_name"), EventName);
 	ResultObj->SetStringField(TEXT("node_id"), EventNode->NodeGuid.ToString());
 	return ResultObj;
@@ -681,10 +686,11 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGVariableCommands::HandleBindWidgetToVar
 	}
 
 	FBlueprintEditorUtils::MarkBlueprintAsModified(WidgetBP);
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	ResultObj->SetStringField(TEXT("binding_function"), FunctionName);
 	ResultObj->SetStringField(TEXT("note"), TEXT("Binding function created. Manual binding in UMG editor may be required."));
 	return ResultObj;
@@ -786,11 +792,12 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGVariableCommands::HandleBindWidgetEvent
 			TEXT("Failed to create event node"));
 	}
 
-	FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
-	UEditorAssetLibrary::SaveAsset(BlueprintPath, false);
+	// Saved after the compile, which may be deferred to flush_compile_queue
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBlueprint, /*bSaveAfterCompile=*/true);
 
 	TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
 	Response->SetBoolField(TEXT("success"), true);
+	Response->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	Response->SetStringField(TEXT("event_name"), EventName);
 	return Response;
 }
@@ -873,11 +880,12 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGVariableCommands::HandleSetTextBlockBin
 		}
 	}
 
-	FKismetEditorUtilities::CompileBlueprint(WidgetBlueprint);
-	UEditorAssetLibrary::SaveAsset(BlueprintPath, false);
+	// Saved after the compile, which may be deferred to flush_compile_queue
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBlueprint, /*bSaveAfterCompile=*/true);
 
 	TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
 	Response->SetBoolField(TEXT("success"), true);
+	Response->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	Response->SetStringField(TEXT("binding_name"), BindingName);
 	return Response;
 }
@@ -959,11 +967,12 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGVariableCommands::HandleAddWidgetArrayV
 	}
 
 	WidgetBP->NewVariables.Add(NewVar);
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 	WidgetBP->MarkPackageDirty();
 
 	TSharedPtr<FJsonObject> Response = MakeShareable(new FJsonObject());
 	Response->SetBoolField(TEXT("success"), true);
+	Response->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	Response->SetStringField(TEXT("widget_name"), WidgetName);
 	Response->SetStringField(TEXT("variable_name"), VariableName);
 	Response->SetStringField(TEXT("variable_type"), FString::Printf(TEXT("TArray<%s>"), *ElementType));
@@ -1170,10 +1179,11 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGVariableCommands::HandleBindWidgetCompo
 	}
 
 	FBlueprintEditorUtils::MarkBlueprintAsModified(WidgetBP);
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	ResultObj->SetStringField(TEXT("widget_name"), WidgetName);
 	ResultObj->SetStringField(TEXT("component_name"), ComponentName);
 	ResultObj->SetStringField(TEXT("event_type"), EventType);
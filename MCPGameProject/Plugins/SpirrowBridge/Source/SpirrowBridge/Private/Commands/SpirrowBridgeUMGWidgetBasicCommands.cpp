@@ -1,6 +1,7 @@
 #include "Commands/SpirrowBridgeUMGWidgetBasicCommands.h"
 #include "Commands/SpirrowBridgeUMGWidgetCoreCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeCompileQueue.h"
 #include "Editor.h"
 #include "EditorAssetLibrary.h"
 #include "Blueprint/UserWidget.h"
@@ -135,7 +136,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetBasicCommands::HandleAddTextToWid
 	// Mark as modified and compile
 	WidgetBP->Modify();
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 	// Create success response
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
@@ -145,6 +146,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetBasicCommands::HandleAddTextToWid
 	ResultObj->SetNumberField(TEXT("font_size"), FontSize);
 	ResultObj->SetStringField(TEXT("parent"), Parent->GetName());
 	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	return ResultObj;
 }
 
@@ -251,7 +253,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetBasicCommands::HandleAddImageToWi
 	// Mark as modified and compile
 	WidgetBP->Modify();
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 	// Create success response
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
@@ -260,6 +262,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetBasicCommands::HandleAddImageToWi
 	ResultObj->SetStringField(TEXT("texture_path"), TexturePath);
 	ResultObj->SetStringField(TEXT("parent"), Parent->GetName());
 	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	return ResultObj;
 }
 
@@ -364,7 +367,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetBasicCommands::HandleAddProgressB
 	// Mark as modified and compile
 	WidgetBP->Modify();
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 	// Create success response
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
@@ -373,6 +376,7 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetBasicCommands::HandleAddProgressB
 	ResultObj->SetNumberField(TEXT("percent"), Percent);
 	ResultObj->SetStringField(TEXT("parent"), Parent->GetName());
 	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	return ResultObj;
 }
 
@@ -508,10 +512,11 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetBasicCommands::HandleAddBorderToW
 
 	WidgetBP->Modify();
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	ResultObj->SetStringField(TEXT("widget"), WidgetName);
 	ResultObj->SetStringField(TEXT("border_name"), BorderName);
 	ResultObj->SetStringField(TEXT("parent"), Parent->GetName());
@@ -1,6 +1,7 @@
 #include "Commands/SpirrowBridgeUMGWidgetInteractiveCommands.h"
 #include "Commands/SpirrowBridgeUMGWidgetCoreCommands.h"
 #include "Commands/SpirrowBridgeCommonUtils.h"
+#include "Commands/SpirrowBridgeCompileQueue.h"
 #include "Editor.h"
 #include "EditorAssetLibrary.h"
 #include "Blueprint/UserWidget.h"
@@ -169,10 +170,11 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetInteractiveCommands::HandleAddBut
 
 	WidgetBP->Modify();
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	ResultObj->SetStringField(TEXT("widget_name"), WidgetName);
 	ResultObj->SetStringField(TEXT("button_name"), ButtonName);
 	ResultObj->SetStringField(TEXT("text"), Text);
@@ -276,10 +278,11 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetInteractiveCommands::HandleAddSli
 
 	WidgetBP->Modify();
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	ResultObj->SetStringField(TEXT("widget_name"), WidgetName);
 	ResultObj->SetStringField(TEXT("slider_name"), SliderName);
 	ResultObj->SetNumberField(TEXT("value"), Value);
@@ -379,10 +382,11 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetInteractiveCommands::HandleAddChe
 
 	WidgetBP->Modify();
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	ResultObj->SetStringField(TEXT("widget_name"), WidgetName);
 	ResultObj->SetStringField(TEXT("checkbox_name"), CheckBoxName);
 	ResultObj->SetBoolField(TEXT("is_checked"), bIsChecked);
@@ -484,10 +488,11 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetInteractiveCommands::HandleAddCom
 	}
 
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	ResultObj->SetStringField(TEXT("widget_name"), WidgetName);
 	ResultObj->SetStringField(TEXT("combobox_name"), ComboBoxName);
 	ResultObj->SetNumberField(TEXT("option_count"), Options.Num());
@@ -592,10 +597,11 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetInteractiveCommands::HandleAddEdi
 	}
 
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	ResultObj->SetStringField(TEXT("widget_name"), WidgetName);
 	ResultObj->SetStringField(TEXT("text_name"), TextName);
 	ResultObj->SetBoolField(TEXT("is_multiline"), bIsMultiline);
@@ -684,10 +690,11 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetInteractiveCommands::HandleAddSpi
 	}
 
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	ResultObj->SetStringField(TEXT("widget_name"), WidgetName);
 	ResultObj->SetStringField(TEXT("spinbox_name"), SpinBoxName);
 	ResultObj->SetNumberField(TEXT("value"), Value);
@@ -781,10 +788,11 @@ TSharedPtr<FJsonObject> FSpirrowBridgeUMGWidgetInteractiveCommands::HandleAddScr
 	}
 
 	WidgetBP->MarkPackageDirty();
-	FKismetEditorUtilities::CompileBlueprint(WidgetBP);
+	const bool bCompileDeferred = FSpirrowBridgeCompileQueue::Get().RequestCompile(WidgetBP);
 
 	TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
 	ResultObj->SetBoolField(TEXT("success"), true);
+	ResultObj->SetBoolField(TEXT("compile_deferred"), bCompileDeferred);
 	ResultObj->SetStringField(TEXT("widget_name"), WidgetName);
 	ResultObj->SetStringField(TEXT("scrollbox_name"), ScrollBoxName);
 	ResultObj->SetStringField(TEXT("orientation"), OrientationStr);
@@ -69,6 +69,17 @@
 #include "Commands/SpirrowBridgeEQSCommands.h"
 #include "Commands/SpirrowBridgeLevelCommands.h"
 #include "Commands/SpirrowBridgePIECommands.h"
+#include "Commands/SpirrowBridgeClassHierarchyCache.h"
+#include "Commands/SpirrowBridgeAssetPrefetcher.h"
+#include "Commands/SpirrowBridgeAssetWorkingSet.h"
+#include "Commands/SpirrowBridgeNodeIndex.h"
+#include "Commands/SpirrowBridgeCompileQueue.h"
+#include "Commands/SpirrowBridgeBlueprintSearchIndex.h"
+#include "Commands/SpirrowBridgeNodeTemplateCache.h"
+#include "Commands/SpirrowBridgeBTNodeIndex.h"
+#include "Commands/SpirrowBridgeBTAuditor.h"
+#include "Commands/SpirrowBridgeBlackboardKeyIndex.h"
+#include "Misc/ScopeExit.h"
 
 // Default settings
 #define MCP_SERVER_HOST "127.0.0.1"
@@ -126,6 +137,14 @@ void USpirrowBridge::Initialize(FSubsystemCollectionBase& Collection)
     Port = MCP_SERVER_PORT;
     FIPv4Address::Parse(MCP_SERVER_HOST, ServerAddress);
 
+    // Shared caches used by command handlers (built lazily on first use)
+    FSpirrowBridgeClassHierarchyCache::Get().Initialize();
+    FSpirrowBridgeAssetWorkingSet::Get().Initialize();
+    FSpirrowBridgeBlueprintSearchIndex::Get().Initialize();
+    FSpirrowBridgeNodeTemplateCache::Get().Initialize();
+    FSpirrowBridgeBTAuditor::Get().Initialize();
+    FSpirrowBridgeBlackboardKeyIndex::Get().Initialize();
+
     // Start the server automatically
     StartServer();
 }
@@ -135,6 +154,16 @@ void USpirrowBridge::Deinitialize()
 {
     UE_LOG(LogTemp, Display, TEXT("SpirrowBridge: Shutting down"));
     StopServer();
+    FSpirrowBridgeClassHierarchyCache::Get().Shutdown();
+    FSpirrowBridgeAssetWorkingSet::Get().Shutdown();
+    FSpirrowBridgeAssetPrefetcher::Get().Shutdown();
+    FSpirrowBridgeNodeIndex::Get().Shutdown();
+    FSpirrowBridgeCompileQueue::Get().Shutdown();
+    FSpirrowBridgeBlueprintSearchIndex::Get().Shutdown();
+    FSpirrowBridgeNodeTemplateCache::Get().Shutdown();
+    FSpirrowBridgeBTNodeIndex::Get().Shutdown();
+    FSpirrowBridgeBTAuditor::Get().Shutdown();
+    FSpirrowBridgeBlackboardKeyIndex::Get().Shutdown();
 }
 
 // Start the MCP server
@@ -257,6 +286,9 @@ FString USpirrowBridge::ExecuteCommand(const FString& CommandType, const TShared
             {
                 UE_LOG(LogTemp, Display, TEXT("SpirrowBridge: Executing import via FTSTicker: %s"), *CommandType);
 
+                FSpirrowBridgeAssetWorkingSet::Get().BeginCommand(CommandType);
+                ON_SCOPE_EXIT { FSpirrowBridgeAssetWorkingSet::Get().EndCommand(); };
+
                 TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
 
                 try
@@ -311,6 +343,10 @@ FString USpirrowBridge::ExecuteCommand(const FString& CommandType, const TShared
     // Queue execution on Game Thread (for non-import operations)
     AsyncTask(ENamedThreads::GameThread, [this, CommandType, Params, Promise = MoveTemp(Promise)]() mutable
     {
+        // Track packages loaded by this command; eviction/GC runs after the response is sent
+        FSpirrowBridgeAssetWorkingSet::Get().BeginCommand(CommandType);
+        ON_SCOPE_EXIT { FSpirrowBridgeAssetWorkingSet::Get().EndCommand(); };
+
         TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
         
         try
@@ -388,6 +424,12 @@ FString USpirrowBridge::ExecuteCommand(const FString& CommandType, const TShared
                      CommandType == TEXT("set_component_property") ||
                      CommandType == TEXT("set_physics_properties") ||
                      CommandType == TEXT("compile_blueprint") ||
+                     // Compile queue
+                     CommandType == TEXT("begin_compile_batch") ||
+                     CommandType == TEXT("cancel_compile_batch") ||
+                     CommandType == TEXT("flush_compile_queue") ||
+                     CommandType == TEXT("get_compile_queue") ||
+                     CommandType == TEXT("validate_blueprint") ||
                      CommandType == TEXT("set_blueprint_property") ||
                      CommandType == TEXT("set_static_mesh_properties") ||
                      CommandType == TEXT("set_pawn_properties") ||
@@ -414,6 +456,7 @@ FString USpirrowBridge::ExecuteCommand(const FString& CommandType, const TShared
                      CommandType == TEXT("add_blueprint_get_self_component_reference") ||
                      CommandType == TEXT("add_blueprint_self_reference") ||
                      CommandType == TEXT("find_blueprint_nodes") ||
+                     CommandType == TEXT("search_blueprint_nodes") ||
                      CommandType == TEXT("add_blueprint_event_node") ||
                      CommandType == TEXT("add_blueprint_input_action_node") ||
                      CommandType == TEXT("add_blueprint_function_node") ||
@@ -440,7 +483,12 @@ FString USpirrowBridge::ExecuteCommand(const FString& CommandType, const TShared
                      CommandType == TEXT("add_external_property_set_node") ||
                      CommandType == TEXT("add_external_property_get_node") ||
                      // Typed Get Subsystem node (K2Node_GetSubsystem with class baked in)
-                     CommandType == TEXT("add_get_subsystem_node"))
+                     CommandType == TEXT("add_get_subsystem_node") ||
+                     // Whole-graph declarative build / diff / patch
+                     CommandType == TEXT("apply_blueprint_graph") ||
+                     CommandType == TEXT("diff_blueprint_graph") ||
+                     CommandType == TEXT("patch_blueprint_graph") ||
+                     CommandType == TEXT("auto_layout_blueprint_graph"))
             {
                 ResultJson = BlueprintNodeCommands->HandleCommand(CommandType, Params);
             }
@@ -462,7 +510,14 @@ FString USpirrowBridge::ExecuteCommand(const FString& CommandType, const TShared
                      CommandType == TEXT("import_texture") ||
                      CommandType == TEXT("get_project_info") ||
                      CommandType == TEXT("find_asset_references") ||
-                     CommandType == TEXT("find_function_callers"))
+                     CommandType == TEXT("find_function_callers") ||
+                     // Asset prefetch hints
+                     CommandType == TEXT("prefetch_assets") ||
+                     CommandType == TEXT("get_prefetch_status") ||
+                     // Asset working set (memory pressure)
+                     CommandType == TEXT("get_working_set") ||
+                     CommandType == TEXT("configure_working_set") ||
+                     CommandType == TEXT("trim_working_set"))
             {
                 ResultJson = ProjectCommands->HandleCommand(CommandType, Params);
             }
@@ -545,6 +600,8 @@ FString USpirrowBridge::ExecuteCommand(const FString& CommandType, const TShared
                      CommandType == TEXT("add_blackboard_key") ||
                      CommandType == TEXT("remove_blackboard_key") ||
                      CommandType == TEXT("list_blackboard_keys") ||
+                     CommandType == TEXT("set_blackboard_keys") ||
+                     CommandType == TEXT("find_blackboard_key_usages") ||
                      CommandType == TEXT("create_behavior_tree") ||
                      CommandType == TEXT("set_behavior_tree_blackboard") ||
                      CommandType == TEXT("get_behavior_tree_structure") ||
@@ -556,6 +613,7 @@ FString USpirrowBridge::ExecuteCommand(const FString& CommandType, const TShared
                      CommandType == TEXT("add_bt_service_node") ||
                      CommandType == TEXT("connect_bt_nodes") ||
                      CommandType == TEXT("set_bt_node_property") ||
+                     CommandType == TEXT("set_bt_node_properties") ||
                      CommandType == TEXT("delete_bt_node") ||
                      CommandType == TEXT("list_bt_node_types") ||
                      // BT Node Position Commands
@@ -565,7 +623,13 @@ FString USpirrowBridge::ExecuteCommand(const FString& CommandType, const TShared
                      // BT Node Health Commands
                      CommandType == TEXT("detect_broken_bt_nodes") ||
                      CommandType == TEXT("delete_broken_bt_nodes") ||
-                     CommandType == TEXT("repair_broken_bt_nodes"))
+                     CommandType == TEXT("repair_broken_bt_nodes") ||
+                     CommandType == TEXT("audit_behavior_trees") ||
+                     // BT Batch Commands
+                     CommandType == TEXT("apply_behavior_tree") ||
+                     // BT Snapshot Commands
+                     CommandType == TEXT("get_bt_snapshot") ||
+                     CommandType == TEXT("diff_behavior_tree"))
             {
                 ResultJson = AICommands->HandleCommand(CommandType, Params);
             }
@@ -575,7 +639,8 @@ FString USpirrowBridge::ExecuteCommand(const FString& CommandType, const TShared
                      CommandType == TEXT("configure_hearing_sense") ||
                      CommandType == TEXT("configure_damage_sense") ||
                      CommandType == TEXT("set_perception_dominant_sense") ||
-                     CommandType == TEXT("add_perception_stimuli_source"))
+                     CommandType == TEXT("add_perception_stimuli_source") ||
+                     CommandType == TEXT("configure_perception_bulk"))
             {
                 ResultJson = AIPerceptionCommands->HandleCommand(CommandType, Params);
             }
@@ -584,7 +649,9 @@ FString USpirrowBridge::ExecuteCommand(const FString& CommandType, const TShared
                      CommandType == TEXT("add_eqs_generator") ||
                      CommandType == TEXT("add_eqs_test") ||
                      CommandType == TEXT("set_eqs_test_property") ||
-                     CommandType == TEXT("list_eqs_assets"))
+                     CommandType == TEXT("list_eqs_assets") ||
+                     CommandType == TEXT("run_eqs_query") ||
+                     CommandType == TEXT("analyze_eqs_query"))
             {
                 ResultJson = EQSCommands->HandleCommand(CommandType, Params);
             }
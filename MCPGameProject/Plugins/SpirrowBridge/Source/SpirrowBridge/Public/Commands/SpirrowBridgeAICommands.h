@@ -44,6 +44,19 @@ private:
 	 */
 	TSharedPtr<FJsonObject> HandleListBlackboardKeys(const TSharedPtr<FJsonObject>& Params);
 
+	// ===== Blackboard Batch Commands =====
+
+	/**
+	 * Add / remove / retype / rename many keys of one Blackboard: validate all, apply, save once.
+	 * Renames are propagated to the key selectors of every referencing BehaviorTree.
+	 */
+	TSharedPtr<FJsonObject> HandleSetBlackboardKeys(const TSharedPtr<FJsonObject>& Params);
+
+	/**
+	 * List the BehaviorTree nodes referencing each key of a Blackboard (project-wide key usage index).
+	 */
+	TSharedPtr<FJsonObject> HandleFindBlackboardKeyUsages(const TSharedPtr<FJsonObject>& Params);
+
 	// ===== BehaviorTree Commands =====
 
 	/**
@@ -85,6 +98,11 @@ private:
 	 */
 	UClass* GetBlackboardKeyTypeClass(const FString& TypeString);
 
+	/**
+	 * Resolve a base_class parameter for Object/Class keys (full path, or an Engine/CoreUObject class name).
+	 */
+	UClass* ResolveBlackboardBaseClass(const FString& ClassName);
+
 	/**
 	 * Convert a Blackboard key to JSON representation.
 	 */
@@ -122,6 +140,11 @@ private:
 	 */
 	TSharedPtr<FJsonObject> HandleSetBTNodeProperty(const TSharedPtr<FJsonObject>& Params);
 
+	/**
+	 * Set properties on many BT nodes ({node_id: {prop: value}}) with a single rebuild and save.
+	 */
+	TSharedPtr<FJsonObject> HandleSetBTNodeProperties(const TSharedPtr<FJsonObject>& Params);
+
 	/**
 	 * Delete a node from a BehaviorTree.
 	 */
@@ -138,7 +161,7 @@ private:
 	TSharedPtr<FJsonObject> HandleSetBTNodePosition(const TSharedPtr<FJsonObject>& Params);
 
 	/**
-	 * Automatically layout the entire BehaviorTree graph.
+	 * Automatically layout the entire BehaviorTree graph (tidy tree; only changed subtrees are recomputed and moved).
 	 */
 	TSharedPtr<FJsonObject> HandleAutoLayoutBT(const TSharedPtr<FJsonObject>& Params);
 
@@ -162,6 +185,31 @@ private:
 	 */
 	TSharedPtr<FJsonObject> HandleRepairBrokenBTNodes(const TSharedPtr<FJsonObject>& Params);
 
+	/**
+	 * Audit every BehaviorTree under a path (null instances, missing Blackboard keys,
+	 * orphaned / unreachable nodes, unloadable node classes). Reuses cached reports of unchanged assets.
+	 */
+	TSharedPtr<FJsonObject> HandleAuditBehaviorTrees(const TSharedPtr<FJsonObject>& Params);
+
+	// ===== BT Batch Commands =====
+
+	/**
+	 * Build a tree (or subtree) from a nested spec, then run UpdateAsset and save once.
+	 */
+	TSharedPtr<FJsonObject> HandleApplyBehaviorTree(const TSharedPtr<FJsonObject>& Params);
+
+	// ===== BT Snapshot Commands =====
+
+	/**
+	 * Export a compact canonical snapshot (flat node table keyed by node ID, with per-subtree hashes).
+	 */
+	TSharedPtr<FJsonObject> HandleGetBTSnapshot(const TSharedPtr<FJsonObject>& Params);
+
+	/**
+	 * Compare a snapshot with another snapshot or the live asset, skipping subtrees with equal hashes.
+	 */
+	TSharedPtr<FJsonObject> HandleDiffBehaviorTree(const TSharedPtr<FJsonObject>& Params);
+
 	// ===== BT Node Operation Helpers =====
 
 	/**
@@ -195,6 +243,13 @@ private:
 	 */
 	void RemoveNodeFromParent(class UBehaviorTree* BehaviorTree, class UBTNode* TargetNode);
 
+	/**
+	 * Set a property on a BT node instance.
+	 * FBlackboardKeySelector properties take a key name and are resolved against the tree's Blackboard.
+	 */
+	bool SetBTNodePropertyValue(class UBehaviorTree* BehaviorTree, class UBTNode* Node,
+		const FString& PropertyName, const TSharedPtr<FJsonValue>& Value, FString& OutError);
+
 	/**
 	 * Convert a BT node to JSON representation.
 	 */
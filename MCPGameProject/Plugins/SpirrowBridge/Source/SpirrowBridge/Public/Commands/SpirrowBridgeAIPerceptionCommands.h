@@ -52,6 +52,14 @@ private:
 	 */
 	TSharedPtr<FJsonObject> HandleAddPerceptionStimuliSource(const TSharedPtr<FJsonObject>& Params);
 
+	// ===== Bulk Configuration Commands =====
+
+	/**
+	 * Apply one sense config to many Blueprints (asset list or parent class filter),
+	 * then compile the changed Blueprints as one batch and save them together.
+	 */
+	TSharedPtr<FJsonObject> HandleConfigurePerceptionBulk(const TSharedPtr<FJsonObject>& Params);
+
 	// ===== Helper Functions =====
 
 	/**
@@ -69,4 +77,12 @@ private:
 	 */
 	void ParseDetectionAffiliation(const TSharedPtr<FJsonObject>& AffiliationJson,
 		bool& OutDetectEnemies, bool& OutDetectNeutrals, bool& OutDetectFriendlies);
+
+	/**
+	 * Apply sense parameters from JSON to a sense config and append {field, old, new} for every change.
+	 * New configs take the configure_*_sense defaults for missing parameters; existing configs only
+	 * change the parameters given. Nothing is written when bWrite is false.
+	 */
+	void ApplySenseParams(class UAISenseConfig* Config, const TSharedPtr<FJsonObject>& Params, bool bNewConfig, bool bWrite,
+		TArray<TSharedPtr<FJsonValue>>& OutChanges);
 };
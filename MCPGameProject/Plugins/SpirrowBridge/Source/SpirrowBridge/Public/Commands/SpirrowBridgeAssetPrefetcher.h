@@ -0,0 +1,75 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/UObjectGlobals.h"
+
+class UPackage;
+
+/**
+ * Background package preloader driven by client hints (prefetch_assets).
+ *
+ * Packages are requested through LoadPackageAsync so the loader thread does
+ * the work while the game thread keeps serving commands. Loaded packages are
+ * held with strong references until the client clears them, so a later
+ * LoadObject in any handler finds the asset already resident.
+ */
+class SPIRROWBRIDGE_API FSpirrowBridgeAssetPrefetcher
+{
+public:
+    enum class EPrefetchState : uint8
+    {
+        Pending,
+        Loaded,
+        Failed
+    };
+
+    struct FPrefetchEntry
+    {
+        EPrefetchState State = EPrefetchState::Pending;
+        int32 BatchId = 0;
+        int32 RequestId = INDEX_NONE;
+        double RequestTime = 0.0;
+        double CompleteTime = 0.0;
+        TStrongObjectPtr<UPackage> Package;
+    };
+
+    struct FBatchStats
+    {
+        int32 Requested = 0;
+        int32 Pending = 0;
+        int32 Loaded = 0;
+        int32 Failed = 0;
+        int32 AlreadyResident = 0;
+    };
+
+    static FSpirrowBridgeAssetPrefetcher& Get();
+
+    /** Release all retained packages. Called from USpirrowBridge::Deinitialize. */
+    void Shutdown();
+
+    /**
+     * Queue async loads for the given packages. Returns the batch ID.
+     * Packages that are already loaded or already queued are not requested again.
+     */
+    int32 Prefetch(const TArray<FName>& PackageNames, int32 Priority, FBatchStats& OutStats);
+
+    /** Aggregate stats for one batch, or for all entries when BatchId is INDEX_NONE */
+    FBatchStats GetStats(int32 BatchId = INDEX_NONE) const;
+
+    const TMap<FName, FPrefetchEntry>& GetEntries() const { return Entries; }
+
+    /** Drop finished entries (and their retained packages). Returns the number removed. */
+    int32 ClearCompleted();
+
+    /** Stop retaining a package; used when the working set hands ownership back */
+    void Release(FName PackageName);
+
+private:
+    FSpirrowBridgeAssetPrefetcher() = default;
+
+    void OnPackageLoaded(const FName& PackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result);
+
+    TMap<FName, FPrefetchEntry> Entries;
+    int32 NextBatchId = 1;
+};
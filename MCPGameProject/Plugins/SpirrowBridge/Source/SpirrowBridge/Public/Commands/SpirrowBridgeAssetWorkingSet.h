@@ -0,0 +1,116 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UPackage;
+
+/**
+ * Tracks packages loaded by bridge commands and keeps them under a cap.
+ *
+ * Packages are recorded when they finish loading while a command is running
+ * (or when prefetch_assets completes). Between commands, the least recently
+ * used clean packages are unloaded once the package count or process memory
+ * exceeds the configured limits. Both limits default to off, so nothing is
+ * evicted until configure_working_set sets one. Packages that are dirty,
+ * open in an asset editor, or part of a map are never unloaded; dirty ones
+ * are saved first only when bSaveDirty is enabled.
+ */
+class SPIRROWBRIDGE_API FSpirrowBridgeAssetWorkingSet
+{
+public:
+    struct FSettings
+    {
+        bool bEnabled = true;
+
+        /** Maximum tracked packages before LRU eviction (0 = unlimited, eviction is opt-in) */
+        int32 MaxPackages = 0;
+
+        /** Process physical memory cap in MB that triggers eviction (0 = off) */
+        int32 MemoryCapMB = 0;
+
+        /** Save dirty packages so they become eligible for unloading */
+        bool bSaveDirty = false;
+
+        /** Run a GC pass every N commands even without eviction (0 = off) */
+        int32 GCIntervalCommands = 0;
+    };
+
+    struct FTrackedPackage
+    {
+        TWeakObjectPtr<UPackage> Package;
+        uint64 LastUseSerial = 0;
+        double LoadTime = 0.0;
+        int64 DiskSize = 0;
+        FString LoadedBy;
+    };
+
+    struct FTrimResult
+    {
+        TArray<FName> Unloaded;
+        TArray<FName> Saved;
+        int32 SkippedDirty = 0;
+        int32 SkippedOpenInEditor = 0;
+        int64 EstimatedBytesFreed = 0;
+        bool bUnloadFailed = false;
+        FString ErrorMessage;
+    };
+
+    static FSpirrowBridgeAssetWorkingSet& Get();
+
+    /** Bind load/dirty delegates. Called from USpirrowBridge::Initialize. */
+    void Initialize();
+
+    /** Unbind delegates and forget tracked packages. Called from USpirrowBridge::Deinitialize. */
+    void Shutdown();
+
+    /** Mark the start of a bridge command; packages loaded until EndCommand are tracked */
+    void BeginCommand(const FString& CommandType);
+
+    /** Safe point between commands: evicts over-cap packages and runs periodic GC */
+    void EndCommand();
+
+    /** Record a package the bridge loaded outside a command (e.g. prefetch completion) */
+    void Track(UPackage* Package, const FString& LoadedBy);
+
+    /**
+     * Unload least recently used packages until at most TargetPackages remain
+     * and at least BytesToFree (estimated from on-disk size) have been released.
+     */
+    FTrimResult Trim(int32 TargetPackages, int64 BytesToFree);
+
+    const FSettings& GetSettings() const { return Settings; }
+    void SetSettings(const FSettings& InSettings) { Settings = InSettings; }
+
+    const TMap<FName, FTrackedPackage>& GetTrackedPackages() const { return Tracked; }
+
+    int64 GetTrackedDiskBytes() const;
+    int32 GetTotalUnloaded() const { return TotalUnloaded; }
+    int32 GetTrimCount() const { return TrimCount; }
+    uint64 GetCommandSerial() const { return CommandSerial; }
+
+    static int64 GetUsedPhysicalMB();
+
+private:
+    FSpirrowBridgeAssetWorkingSet() = default;
+
+    void OnAssetLoaded(UObject* Asset);
+    void OnPackageMarkedDirty(UPackage* Package, bool bWasDirty);
+    void PruneStale();
+
+    static bool ShouldTrack(const UPackage* Package);
+
+    FSettings Settings;
+    TMap<FName, FTrackedPackage> Tracked;
+
+    FString CurrentCommand;
+    bool bInCommand = false;
+    uint64 CommandSerial = 0;
+    int32 CommandsSinceGC = 0;
+    int32 TotalUnloaded = 0;
+    int32 TrimCount = 0;
+    bool bInitialized = false;
+
+    FDelegateHandle AssetLoadedHandle;
+    FDelegateHandle PackageDirtyHandle;
+};
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectSaveContext.h"
+
+class UBehaviorTree;
+class UPackage;
+struct FAssetData;
+
+/**
+ * Project-wide BehaviorTree health checks with a per-asset result cache.
+ *
+ * An audit finds every BehaviorTree under a path, loads the ones that need
+ * auditing asynchronously (all requests in flight at once), copies what the
+ * checks need out of each graph on the game thread, and then analyzes the
+ * plain-data snapshots on worker threads.
+ *
+ * Reports are cached per asset. A cached report is reused until the tree,
+ * its Blackboard (or a parent Blackboard) or a Blueprint node class it uses is
+ * saved, or while the tree's package is dirty, so repeated audits only
+ * re-analyze what changed. Removed and renamed assets are dropped.
+ */
+class SPIRROWBRIDGE_API FSpirrowBridgeBTAuditor
+{
+public:
+    struct FIssue
+    {
+        /** null_instance, class_load_failed, missing_blackboard_key, no_blackboard, orphaned_node, unreachable_subtree, no_graph */
+        FName Type;
+        bool bError = false;
+        FString NodeId;
+        FString NodeClass;
+        FString Message;
+    };
+
+    struct FAssetReport
+    {
+        FName PackageName;
+        FString ObjectPath;
+        FString AssetName;
+        int32 NodeCount = 0;
+        bool bLoadFailed = false;
+
+        /** Set on reports returned by Audit: reused from an earlier audit */
+        bool bFromCache = false;
+        TArray<FIssue> Issues;
+
+        /** Packages whose save invalidates this report (Blackboards, Blueprint node classes) */
+        TSet<FName> Dependencies;
+    };
+
+    struct FAuditStats
+    {
+        int32 NumAssets = 0;
+        int32 Audited = 0;
+        int32 FromCache = 0;
+        int32 Loaded = 0;
+        int32 LoadFailed = 0;
+        double LoadMs = 0.0;
+        double SnapshotMs = 0.0;
+        double AnalysisMs = 0.0;
+    };
+
+    static FSpirrowBridgeBTAuditor& Get();
+
+    /** Bind save/asset registry delegates. Called from USpirrowBridge::Initialize. */
+    void Initialize();
+
+    /** Unbind delegates and drop cached reports. Called from USpirrowBridge::Deinitialize. */
+    void Shutdown();
+
+    /**
+     * Audit every BehaviorTree under PathPrefix. Cached reports that are still
+     * valid are reused unless bForce. OutReports is ordered by object path.
+     */
+    void Audit(const FString& PathPrefix, bool bForce, TArray<FAssetReport>& OutReports, FAuditStats& OutStats);
+
+    /** Drop every cached report */
+    void Reset();
+
+private:
+    struct FNodeSnapshot;
+    struct FTreeSnapshot;
+
+    FSpirrowBridgeBTAuditor() = default;
+
+    static void SnapshotTree(UBehaviorTree* BehaviorTree, FTreeSnapshot& OutSnapshot);
+    static void AnalyzeTree(const FTreeSnapshot& Snapshot, FAssetReport& OutReport);
+
+    /** Drop the report of the tree in PackageName and every report depending on it */
+    void InvalidatePackage(FName PackageName);
+
+    void OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext);
+    void OnAssetRemoved(const FAssetData& AssetData);
+    void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+    /** Cached reports by tree package name */
+    TMap<FName, FAssetReport> Reports;
+
+    bool bInitialized = false;
+
+    FDelegateHandle PackageSavedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+};
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UBehaviorTree;
+class UBehaviorTreeGraphNode;
+
+/**
+ * Tidy-tree (Reingold-Tilford style) auto-layout for BehaviorTree graphs.
+ *
+ * Each subtree is laid out once into relative child offsets plus its left
+ * and right contours (as steps over height, since node heights differ);
+ * siblings are packed as close as their contours allow and parents are
+ * centered over their children. Node sizes are estimated from the title,
+ * description and the decorator/service stacks drawn inside the node.
+ *
+ * Subtree layouts are cached per tree and keyed by a shape signature (sizes
+ * and child order), so after a local edit only the subtrees on the path from
+ * the edited node to Root are laid out again. Positions are only written,
+ * and the asset only marked dirty, for nodes that actually move.
+ */
+class SPIRROWBRIDGE_API FSpirrowBridgeBTLayout
+{
+public:
+    struct FSettings
+    {
+        /** Gap between sibling subtrees */
+        int32 HorizontalSpacing = 40;
+
+        /** Gap between a node and its children */
+        int32 VerticalSpacing = 60;
+
+        /** Ignore cached subtree layouts */
+        bool bFullRelayout = false;
+    };
+
+    struct FResult
+    {
+        /** Tree nodes under Root, decorators and services included */
+        int32 NumNodes = 0;
+        int32 NumMoved = 0;
+        int32 NumSubtreesReused = 0;
+        int32 NumSubtreesLaidOut = 0;
+        FIntPoint Size = FIntPoint::ZeroValue;
+        double TimeMs = 0.0;
+    };
+
+    /** Lay out everything connected to the Root node; Root keeps its position. Returns false if the tree has no Root. */
+    static bool Layout(UBehaviorTree* BehaviorTree, const FSettings& Settings, FResult& OutResult);
+
+    /** Approximate rendered size of a tree node including its decorators and services */
+    static FIntPoint EstimateNodeSize(const UBehaviorTreeGraphNode* Node);
+
+    static void ResetCache();
+};
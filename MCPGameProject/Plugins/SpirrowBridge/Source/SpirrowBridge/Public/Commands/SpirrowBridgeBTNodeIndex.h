@@ -0,0 +1,84 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UBehaviorTree;
+class UBehaviorTreeGraph;
+class UBehaviorTreeGraphNode;
+class UBTNode;
+struct FEdGraphEditAction;
+
+/**
+ * Node ID -> node lookup for BehaviorTree graphs.
+ *
+ * BT node IDs are the names of the runtime node instances. Each tree's
+ * index maps every ID (composites, tasks, decorators and services) to its
+ * graph node, runtime node and parent graph node. It is built on first
+ * lookup and rebuilt lazily after the graph changes: any graph-changed
+ * notification (sent before every UpdateAsset) or an explicit Invalidate
+ * marks it dirty. Entries are validated on lookup, so IDs of deleted or
+ * replaced nodes resolve to a clean "not found" instead of a stale node.
+ */
+class SPIRROWBRIDGE_API FSpirrowBridgeBTNodeIndex
+{
+public:
+    struct FEntry
+    {
+        UBehaviorTreeGraphNode* GraphNode = nullptr;
+        UBTNode* RuntimeNode = nullptr;
+
+        /** Owning graph node: the Root/composite above a tree node, or the node a decorator/service is attached to */
+        UBehaviorTreeGraphNode* ParentGraphNode = nullptr;
+    };
+
+    static FSpirrowBridgeBTNodeIndex& Get();
+
+    /** Remove graph handlers and drop all indices. Called from USpirrowBridge::Deinitialize. */
+    void Shutdown();
+
+    /** Find a node by ID. Returns false if the tree has no graph or the ID is unknown. */
+    bool Find(UBehaviorTree* BehaviorTree, const FString& NodeId, FEntry& OutEntry);
+
+    /** Graph node for an ID, or nullptr */
+    UBehaviorTreeGraphNode* FindGraphNode(UBehaviorTree* BehaviorTree, const FString& NodeId);
+
+    /**
+     * Resolve NodeId against the tree.
+     * Returns nullptr on success (OutEntry set), or an error JSON object.
+     * Label prefixes the error message (e.g. "Parent node").
+     */
+    TSharedPtr<FJsonObject> ResolveNode(UBehaviorTree* BehaviorTree, const FString& NodeId, FEntry& OutEntry, const TCHAR* Label = TEXT("Node"));
+
+    /** Force a rebuild on next lookup (called after UpdateAsset) */
+    void Invalidate(UBehaviorTree* BehaviorTree);
+
+private:
+    struct FStoredEntry
+    {
+        TWeakObjectPtr<UBehaviorTreeGraphNode> GraphNode;
+        TWeakObjectPtr<UBTNode> RuntimeNode;
+        TWeakObjectPtr<UBehaviorTreeGraphNode> ParentGraphNode;
+    };
+
+    struct FTreeIndex
+    {
+        TWeakObjectPtr<UBehaviorTree> BehaviorTree;
+        TWeakObjectPtr<UBehaviorTreeGraph> Graph;
+        TMap<FName, FStoredEntry> Nodes;
+        FDelegateHandle GraphChangedHandle;
+        bool bDirty = true;
+    };
+
+    FSpirrowBridgeBTNodeIndex() = default;
+
+    FTreeIndex& FindOrAddIndex(UBehaviorTree* BehaviorTree);
+    void Rebuild(FTreeIndex& Index);
+    void UnbindGraph(FTreeIndex& Index);
+    bool ResolveEntry(const FStoredEntry& Stored, FName NodeId, FEntry& OutEntry) const;
+    void OnGraphChanged(const FEdGraphEditAction& Action, FObjectKey TreeKey);
+
+    TMap<FObjectKey, FTreeIndex> Indices;
+};
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/SoftObjectPath.h"
+
+class UBehaviorTree;
+class UBlackboardData;
+class UBTNode;
+class UPackage;
+struct FAssetData;
+struct FBlackboardKeySelector;
+
+/**
+ * (Blackboard, key name) -> referencing BehaviorTree nodes, project-wide.
+ *
+ * Every FBlackboardKeySelector on a tree's node instances is recorded,
+ * including selectors nested in structs and arrays (e.g. the EQS query
+ * parameters of Run EQS tasks and services). References are stored by key
+ * name together with the tree's Blackboard and are resolved to the
+ * declaring Blackboard (the tree's Blackboard or one of its parents) when
+ * queried, so Blackboard edits never invalidate the index.
+ *
+ * The first Update loads every tree that is not in memory (all requests in
+ * flight at once). After that a tree is re-indexed from memory when it is
+ * saved, and Update only picks up new, renamed or dirty trees, so usage
+ * queries do not reload the project.
+ */
+class SPIRROWBRIDGE_API FSpirrowBridgeBlackboardKeyIndex
+{
+public:
+    struct FUsage
+    {
+        FName KeyName;
+        FString TreePath;
+        FString TreeName;
+        FString NodeId;
+        FString NodeClass;
+
+        /** Property path on the node instance, e.g. BlackboardKey or EQSRequest.QueryConfig[0].BBKey */
+        FString Property;
+
+        /** Key type classes the selector accepts; empty when unfiltered */
+        TArray<FName> AllowedTypes;
+    };
+
+    struct FUpdateStats
+    {
+        int32 NumTrees = 0;
+        int32 Indexed = 0;
+        int32 Loaded = 0;
+        int32 LoadFailed = 0;
+        double TimeMs = 0.0;
+    };
+
+    static FSpirrowBridgeBlackboardKeyIndex& Get();
+
+    /** Bind save/asset registry delegates. Called from USpirrowBridge::Initialize. */
+    void Initialize();
+
+    /** Unbind delegates and drop the index. Called from USpirrowBridge::Deinitialize. */
+    void Shutdown();
+
+    /** Index trees that are new, renamed, dirty or not indexed yet; drop trees that no longer exist */
+    void Update(FUpdateStats& OutStats);
+
+    /**
+     * Usages of keys declared by Blackboard itself (not by its parents).
+     * KeyNames limits the keys looked up; nullptr returns usages of every key.
+     * Call Update first. OutUsages is ordered by tree path.
+     */
+    void FindUsages(const UBlackboardData* Blackboard, const TSet<FName>* KeyNames, TArray<FUsage>& OutUsages) const;
+
+    /** (Re)build the entry of one tree from memory */
+    void IndexTree(UBehaviorTree* BehaviorTree);
+
+    /** Drop the whole index; the next Update rebuilds it */
+    void Reset();
+
+    /** Call Visitor for every node instance of the tree's graph, decorators and services included */
+    static void ForEachNodeInstance(UBehaviorTree* BehaviorTree, TFunctionRef<void(UBTNode*)> Visitor);
+
+    /** Call Visitor for every key selector on the node, including selectors nested in structs and arrays */
+    static void ForEachKeySelector(UBTNode* Node, TFunctionRef<void(FBlackboardKeySelector&, const FString&)> Visitor);
+
+    /** Blackboard in the chain starting at Blackboard that declares KeyName (own keys first, then parents) */
+    static const UBlackboardData* FindDeclaringBlackboard(const UBlackboardData* Blackboard, FName KeyName);
+
+private:
+    struct FKeyRef
+    {
+        FName KeyName;
+        FString NodeId;
+        FString NodeClass;
+        FString Property;
+        TArray<FName> AllowedTypes;
+    };
+
+    struct FTreeEntry
+    {
+        FString ObjectPath;
+        FString AssetName;
+        FSoftObjectPath Blackboard;
+        TArray<FKeyRef> Refs;
+    };
+
+    FSpirrowBridgeBlackboardKeyIndex() = default;
+
+    void RemoveTree(FName PackageName);
+
+    void OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext);
+    void OnAssetRemoved(const FAssetData& AssetData);
+    void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+    /** Entries by tree package name */
+    TMap<FName, FTreeEntry> Trees;
+
+    /** Tree packages referencing each key name (any Blackboard) */
+    TMap<FName, TSet<FName>> TreesByKey;
+
+    bool bInitialized = false;
+
+    FDelegateHandle PackageSavedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+};
@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "Json.h"
 
+class UBlueprint;
+
 /**
  * Handler class for core Blueprint commands (creation, compilation, spawn, properties)
  */
@@ -22,4 +24,16 @@ private:
     TSharedPtr<FJsonObject> HandleSetBlueprintProperty(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleDuplicateBlueprint(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleGetBlueprintGraph(const TSharedPtr<FJsonObject>& Params);
+
+    // Interned-string / integer-array graph export (SpirrowBridgeBlueprintCoreCommands_GraphExport.cpp)
+    static TSharedPtr<FJsonObject> BuildCompactGraphExport(UBlueprint* Blueprint, bool bSummary);
+
+    // Compile queue (SpirrowBridgeBlueprintCoreCommands_CompileQueue.cpp)
+    TSharedPtr<FJsonObject> HandleBeginCompileBatch(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleCancelCompileBatch(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleFlushCompileQueue(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleGetCompileQueue(const TSharedPtr<FJsonObject>& Params);
+
+    // Skeleton-only validation (SpirrowBridgeBlueprintCoreCommands_Validate.cpp)
+    TSharedPtr<FJsonObject> HandleValidateBlueprint(const TSharedPtr<FJsonObject>& Params);
 };
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+/**
+ * Handler class for whole-graph Blueprint commands (declarative build, diff, patch and layout)
+ */
+class SPIRROWBRIDGE_API FSpirrowBridgeBlueprintNodeGraphCommands
+{
+public:
+    FSpirrowBridgeBlueprintNodeGraphCommands();
+
+    // Handle blueprint graph commands
+    TSharedPtr<FJsonObject> HandleCommand(const FString& CommandType, const TSharedPtr<FJsonObject>& Params);
+
+private:
+    // Create all nodes and edges of a graph description in one pass
+    TSharedPtr<FJsonObject> HandleApplyBlueprintGraph(const TSharedPtr<FJsonObject>& Params);
+
+    // Compare a desired graph description with the live graph
+    TSharedPtr<FJsonObject> HandleDiffBlueprintGraph(const TSharedPtr<FJsonObject>& Params);
+
+    // Apply only the delta between a desired description and the live graph
+    TSharedPtr<FJsonObject> HandlePatchBlueprintGraph(const TSharedPtr<FJsonObject>& Params);
+
+    // Layered layout of a whole graph or a subset of its nodes
+    TSharedPtr<FJsonObject> HandleAutoLayoutBlueprintGraph(const TSharedPtr<FJsonObject>& Params);
+};
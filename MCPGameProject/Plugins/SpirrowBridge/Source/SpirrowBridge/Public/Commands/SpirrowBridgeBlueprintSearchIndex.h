@@ -0,0 +1,126 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectSaveContext.h"
+
+class UBlueprint;
+class UEdGraphNode;
+class UPackage;
+struct FAssetData;
+
+/**
+ * Project-wide inverted index of Blueprint graph nodes.
+ *
+ * Every indexed node produces a handful of terms ("kind:VariableSet",
+ * "variable:Health", "function:Delay", "graph:EventGraph", "class:K2Node_CallFunction")
+ * and each term maps to the set of node records containing it, so a query is
+ * a set intersection instead of a walk over every graph of every asset.
+ *
+ * Assets are indexed the first time a query covers their folder. Afterwards a
+ * Blueprint is re-indexed from memory when it is saved, marked stale when it
+ * is compiled (re-indexed by the next query), and dropped on asset removal or
+ * rename.
+ */
+class SPIRROWBRIDGE_API FSpirrowBridgeBlueprintSearchIndex
+{
+public:
+    struct FNodeRecord
+    {
+        int32 AssetId = INDEX_NONE;
+        FName Graph;
+        FGuid NodeGuid;
+        FName Kind;
+        FName Member;
+        FName NodeClass;
+    };
+
+    struct FAssetEntry
+    {
+        FName ObjectPath;
+        FName AssetName;
+        TArray<int32> Records;
+        bool bStale = false;
+    };
+
+    /** Conjunction of clauses; each clause matches if the node has any of its terms */
+    struct FQuery
+    {
+        TArray<TArray<FName>> Clauses;
+        TArray<FName> Excluded;
+        FString PathPrefix;
+        int32 Offset = 0;
+        int32 Limit = 100;
+    };
+
+    struct FQueryResult
+    {
+        /** Record IDs of the requested page, ordered by asset path */
+        TArray<int32> Records;
+        int32 TotalMatches = 0;
+        int32 NumAssetsMatched = 0;
+    };
+
+    static FSpirrowBridgeBlueprintSearchIndex& Get();
+
+    /** Bind save/compile/asset registry delegates. Called from USpirrowBridge::Initialize. */
+    void Initialize();
+
+    /** Unbind delegates and drop the index. Called from USpirrowBridge::Deinitialize. */
+    void Shutdown();
+
+    /**
+     * Index every Blueprint asset under PathPrefix that is not indexed yet or is
+     * stale. Loads unindexed assets. Returns the number of assets (re)indexed.
+     */
+    int32 EnsureIndexed(const FString& PathPrefix, bool bForceReindex = false);
+
+    FQueryResult Query(const FQuery& InQuery) const;
+
+    /** "function" + "Delay" -> "function:Delay". Terms are case-insensitive. */
+    static FName MakeTerm(const TCHAR* Field, FName Value);
+
+    /** "variable:Health" is used as is; a bare "Health" becomes "name:Health" */
+    static FName ParseTerm(const FString& Text);
+
+    /**
+     * Node kind (Event, Function, VariableGet, VariableSet, Branch, Sequence,
+     * Macro, InputAction, Self, Other) and the member it refers to, if any.
+     * Shared with find_blueprint_nodes.
+     */
+    static void ClassifyNode(const UEdGraphNode* Node, FName& OutKind, FName& OutMember);
+
+    const FNodeRecord& GetRecord(int32 RecordId) const { return Records[RecordId]; }
+    const FAssetEntry& GetAsset(int32 AssetId) const { return Assets[AssetId]; }
+
+    int32 GetNumAssets() const { return AssetByPath.Num(); }
+    int32 GetNumRecords() const { return Records.Num(); }
+    int32 GetNumTerms() const { return Postings.Num(); }
+
+private:
+    FSpirrowBridgeBlueprintSearchIndex() = default;
+
+    void IndexBlueprint(UBlueprint* Blueprint);
+    void RemoveRecords(FAssetEntry& Entry);
+    void RemoveAsset(FName ObjectPath);
+
+    static void GatherTerms(const FNodeRecord& Record, TArray<FName, TInlineAllocator<6>>& OutTerms);
+
+    void OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext);
+    void OnBlueprintPreCompile(UBlueprint* Blueprint);
+    void OnAssetRemoved(const FAssetData& AssetData);
+    void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+    TArray<FAssetEntry> Assets;
+    TArray<int32> FreeAssetIds;
+    TMap<FName, int32> AssetByPath;
+
+    TSparseArray<FNodeRecord> Records;
+    TMap<FName, TSet<int32>> Postings;
+
+    bool bInitialized = false;
+
+    FDelegateHandle PackageSavedHandle;
+    FDelegateHandle BlueprintPreCompileHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+};
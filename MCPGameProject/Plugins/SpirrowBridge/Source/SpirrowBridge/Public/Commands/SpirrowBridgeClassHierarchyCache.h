@@ -0,0 +1,116 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+
+struct FAssetData;
+
+/**
+ * Cached parent/child tree of native classes and Blueprint assets.
+ *
+ * Nodes are stored in pre-order, so every subtree is the contiguous ID range
+ * (Id, SubtreeEnd). scan_project_classes walks these ranges and filters on
+ * integer IDs instead of re-iterating UClass objects and comparing path strings.
+ *
+ * The tree is built lazily on first use and invalidated on module load,
+ * Blueprint compile and Blueprint asset add/remove/rename.
+ */
+class SPIRROWBRIDGE_API FSpirrowBridgeClassHierarchyCache
+{
+public:
+    struct FClassEntry
+    {
+        /** Short class name (native) or generated class name (Blueprint, e.g. BP_Foo_C) */
+        FName Name;
+
+        /** Native class path (/Script/Module.Class) or Blueprint object path */
+        FString Path;
+
+        /** Blueprint asset name (NAME_None for native classes) */
+        FName AssetName;
+
+        int32 ParentId = INDEX_NONE;
+
+        /** Exclusive end of this node's subtree in pre-order */
+        int32 SubtreeEnd = 0;
+
+        /** Interned module ID (native classes only) */
+        int32 ModuleId = INDEX_NONE;
+
+        bool bIsBlueprint = false;
+
+        /** Blueprint lives under /Game */
+        bool bIsGameContent = false;
+    };
+
+    static FSpirrowBridgeClassHierarchyCache& Get();
+
+    /** Bind invalidation delegates. Called from USpirrowBridge::Initialize. */
+    void Initialize();
+
+    /** Unbind invalidation delegates. Called from USpirrowBridge::Deinitialize. */
+    void Shutdown();
+
+    /** Rebuild the tree if it has been invalidated since the last build */
+    void EnsureBuilt();
+
+    void Invalidate() { bDirty = true; }
+
+    const TArray<FClassEntry>& GetEntries() const { return Entries; }
+
+    /** Resolve a class by short name, generated class name, asset name or path. INDEX_NONE if unknown. */
+    int32 FindClassId(const FString& NameOrPath) const;
+
+    /** Resolve a native class to its node ID */
+    int32 FindClassId(const UClass* Class) const;
+
+    int32 FindModuleId(FName ModuleName) const;
+    FName GetModuleName(int32 ModuleId) const;
+
+    /** Module is one of the engine modules hidden by default in scan_project_classes */
+    bool IsEngineModule(int32 ModuleId) const;
+
+    /** True if Id is a strict descendant of AncestorId */
+    bool IsDescendantOf(int32 Id, int32 AncestorId) const
+    {
+        return AncestorId != INDEX_NONE && Id > AncestorId && Id < Entries[AncestorId].SubtreeEnd;
+    }
+
+    FName GetParentName(int32 Id) const
+    {
+        const int32 ParentId = Entries[Id].ParentId;
+        return ParentId != INDEX_NONE ? Entries[ParentId].Name : NAME_None;
+    }
+
+    int32 GetBuildCount() const { return BuildCount; }
+    double GetLastBuildTimeMs() const { return LastBuildTimeMs; }
+
+private:
+    FSpirrowBridgeClassHierarchyCache() = default;
+
+    void Rebuild();
+
+    void OnModulesChanged(FName ModuleName, EModuleChangeReason Reason);
+    void OnBlueprintCompiled();
+    void OnAssetChanged(const FAssetData& AssetData);
+    void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+    TArray<FClassEntry> Entries;
+    TMap<FName, int32> NameToId;
+    TMap<FName, int32> PathToId;
+
+    TArray<FName> Modules;
+    TMap<FName, int32> ModuleToId;
+    TBitArray<> EngineModules;
+
+    bool bDirty = true;
+    bool bInitialized = false;
+    int32 BuildCount = 0;
+    double LastBuildTimeMs = 0.0;
+
+    FDelegateHandle ModulesChangedHandle;
+    FDelegateHandle BlueprintCompiledHandle;
+    FDelegateHandle AssetAddedHandle;
+    FDelegateHandle AssetRemovedHandle;
+    FDelegateHandle AssetRenamedHandle;
+};
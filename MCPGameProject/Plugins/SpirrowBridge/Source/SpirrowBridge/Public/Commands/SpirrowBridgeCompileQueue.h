@@ -0,0 +1,95 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UBlueprint;
+
+/**
+ * Collects Blueprints that need a compile and compiles each of them once,
+ * parents and dependencies first.
+ *
+ * SafeCompileBlueprint queues already-compiled Blueprints it only marks
+ * dirty. Handlers that compile right after an edit go through
+ * RequestCompile, which compiles immediately unless a batch has been opened
+ * with BeginBatch; inside a batch the request is queued. Flush compiles the
+ * queue either one Blueprint at a time in dependency order (per-Blueprint
+ * timings and messages) or as a single FBlueprintCompilationManager batch.
+ */
+class SPIRROWBRIDGE_API FSpirrowBridgeCompileQueue
+{
+public:
+    enum class EFlushMode : uint8
+    {
+        /** One CompileBlueprint per entry in dependency order, timed individually */
+        Ordered,
+        /** QueueForCompilation + one FlushCompilationQueueAndReinstance */
+        Batch
+    };
+
+    struct FCompileEntryResult
+    {
+        FString Name;
+        FString Path;
+        FString Status;
+        double TimeMs = 0.0;
+        int32 NumWarnings = 0;
+        TArray<FString> Errors;
+    };
+
+    struct FFlushResult
+    {
+        TArray<FCompileEntryResult> Entries;
+        double TotalTimeMs = 0.0;
+        int32 NumCompiled = 0;
+        int32 NumFailed = 0;
+        int32 NumSaved = 0;
+    };
+
+    static FSpirrowBridgeCompileQueue& Get();
+
+    /** Drop queued entries and close any open batch. Called from USpirrowBridge::Deinitialize. */
+    void Shutdown();
+
+    /** Queue a Blueprint for the next Flush */
+    void Enqueue(UBlueprint* Blueprint);
+
+    /**
+     * Compile now, or queue when a batch is open. With bSaveAfterCompile the
+     * asset is saved once its compile has run, i.e. after Flush when deferred.
+     * Returns true when the compile was deferred.
+     */
+    bool RequestCompile(UBlueprint* Blueprint, bool bSaveAfterCompile = false);
+
+    /** Defer RequestCompile calls until Flush */
+    void BeginBatch() { bBatchOpen = true; }
+    bool IsBatchOpen() const { return bBatchOpen; }
+
+    /**
+     * Close an open batch without compiling. Queued Blueprints (and their
+     * pending saves) stay queued for the next Flush unless bDiscardPending is
+     * set. Returns how many were dropped.
+     */
+    int32 CancelBatch(bool bDiscardPending);
+
+    /** Compile every queued Blueprint once and close the batch */
+    FFlushResult Flush(EFlushMode Mode);
+
+    /** Queued Blueprints that are still loaded, in queue order */
+    TArray<UBlueprint*> GetPending() const;
+
+private:
+    FSpirrowBridgeCompileQueue() = default;
+
+    /** Parents and dependencies before dependents; cycles fall back to hierarchy depth */
+    static TArray<UBlueprint*> SortByDependency(const TArray<UBlueprint*>& Blueprints);
+
+    static void CollectNodeErrors(UBlueprint* Blueprint, FCompileEntryResult& OutEntry);
+    static FString StatusToString(const UBlueprint* Blueprint);
+
+    TArray<TWeakObjectPtr<UBlueprint>> Pending;
+
+    /** Deferred RequestCompile(..., bSaveAfterCompile=true) calls, saved at the end of Flush */
+    TArray<TWeakObjectPtr<UBlueprint>> PendingSaves;
+    bool bBatchOpen = false;
+};
@@ -48,6 +48,20 @@ private:
 	 */
 	TSharedPtr<FJsonObject> HandleListEQSAssets(const TSharedPtr<FJsonObject>& Params);
 
+	// ===== EQS Profiling Commands =====
+
+	/**
+	 * Run an EQS Query against a querier in the editor or PIE world.
+	 * Returns the scored items plus timing and item counts for the generator and each test.
+	 */
+	TSharedPtr<FJsonObject> HandleRunEQSQuery(const TSharedPtr<FJsonObject>& Params);
+
+	/**
+	 * Estimate generator item counts and per-test cost from the asset, flag expensive tests
+	 * placed before cheaper filters, and optionally reorder tests without changing scores.
+	 */
+	TSharedPtr<FJsonObject> HandleAnalyzeEQSQuery(const TSharedPtr<FJsonObject>& Params);
+
 	// ===== Helper Functions =====
 
 	/**
@@ -75,6 +89,16 @@ private:
 	 */
 	EEnvTestPurpose::Type GetTestPurpose(const FString& PurposeString);
 
+	/**
+	 * Get string for a test purpose enum (inverse of GetTestPurpose).
+	 */
+	FString GetTestPurposeString(EEnvTestPurpose::Type Purpose);
+
+	/**
+	 * Get string for a test cost class (Low, Medium, High).
+	 */
+	FString GetTestCostString(EEnvTestCost::Type Cost);
+
 	/**
 	 * Convert an EQS Query to JSON representation.
 	 */
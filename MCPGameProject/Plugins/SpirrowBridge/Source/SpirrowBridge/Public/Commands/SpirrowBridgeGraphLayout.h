@@ -0,0 +1,60 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UEdGraphNode;
+
+/**
+ * Layered (Sugiyama-style) auto-layout for Blueprint graphs.
+ *
+ * Exec and data links are both treated as left-to-right edges: cycles are
+ * broken by reversing DFS back edges, nodes are assigned to layers by longest
+ * path (pure nodes are pulled right next to their first consumer), layer
+ * order is refined with barycenter sweeps, and Y positions follow the
+ * average of already placed neighbours. Disconnected chains (one per event,
+ * typically) are stacked vertically.
+ *
+ * Node sizes are estimated from title and pin names, since no Slate widget
+ * exists for nodes of a graph that is not open, and cached per node class,
+ * member and pin count.
+ */
+class SPIRROWBRIDGE_API FSpirrowBridgeGraphLayout
+{
+public:
+    struct FSettings
+    {
+        int32 HorizontalSpacing = 80;
+        int32 VerticalSpacing = 32;
+
+        /** Gap between disconnected chains */
+        int32 ComponentSpacing = 160;
+
+        /** Barycenter ordering passes (each is one down and one up sweep) */
+        int32 OrderingSweeps = 4;
+
+        /** Top-left of the layout; defaults to the top-left of the nodes' current bounds */
+        bool bUseOrigin = false;
+        FIntPoint Origin = FIntPoint::ZeroValue;
+    };
+
+    struct FResult
+    {
+        int32 NumNodes = 0;
+        /** Nodes whose position actually changed */
+        int32 NumMoved = 0;
+        int32 NumLayers = 0;
+        int32 NumComponents = 0;
+        int32 NumReversedEdges = 0;
+        int32 NumSizeCacheHits = 0;
+        FIntPoint Size = FIntPoint::ZeroValue;
+        double TimeMs = 0.0;
+    };
+
+    /** Position the given nodes. Links to nodes outside the set are ignored; comment nodes are skipped. */
+    static FResult Layout(const TArray<UEdGraphNode*>& Nodes, const FSettings& Settings);
+
+    /** Approximate rendered size of a node */
+    static FIntPoint EstimateNodeSize(const UEdGraphNode* Node, bool* bOutCacheHit = nullptr);
+
+    static void ResetSizeCache();
+};
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UBlueprint;
+class UEdGraph;
+class UEdGraphNode;
+struct FEdGraphEditAction;
+
+/**
+ * GUID -> node lookup spanning every graph of a Blueprint (ubergraph pages,
+ * functions, macros, delegate signatures and collapsed subgraphs).
+ *
+ * Each Blueprint's index is built on first lookup and kept current through
+ * UEdGraph graph-changed notifications: removals are applied directly, added
+ * nodes are queued and indexed on the next lookup (their GUID is assigned
+ * after the notification fires), and any other change marks the index for a
+ * rebuild. A lookup miss also triggers one rebuild so edits that bypass the
+ * notifications (e.g. newly added graphs) are picked up.
+ */
+class SPIRROWBRIDGE_API FSpirrowBridgeNodeIndex
+{
+public:
+    static FSpirrowBridgeNodeIndex& Get();
+
+    /** Remove graph handlers and drop all indices. Called from USpirrowBridge::Deinitialize. */
+    void Shutdown();
+
+    /** Find a node by GUID in any graph of the Blueprint */
+    UEdGraphNode* FindNode(UBlueprint* Blueprint, const FGuid& NodeGuid);
+
+    /**
+     * Parse NodeId and resolve it against the Blueprint.
+     * Returns nullptr on success (OutNode set), or an error JSON object.
+     * Label prefixes the error message (e.g. "Source node").
+     */
+    TSharedPtr<FJsonObject> ResolveNode(UBlueprint* Blueprint, const FString& NodeId, UEdGraphNode*& OutNode, const TCHAR* Label = TEXT("Node"));
+
+    /** Force a rebuild on next lookup (e.g. after bulk graph replacement) */
+    void Invalidate(UBlueprint* Blueprint);
+
+private:
+    struct FBlueprintIndex
+    {
+        TWeakObjectPtr<UBlueprint> Blueprint;
+        TMap<FGuid, TWeakObjectPtr<UEdGraphNode>> Nodes;
+        TArray<TWeakObjectPtr<UEdGraphNode>> PendingAdds;
+        TArray<TPair<TWeakObjectPtr<UEdGraph>, FDelegateHandle>> GraphHandles;
+        FDelegateHandle BlueprintChangedHandle;
+        bool bDirty = true;
+    };
+
+    FSpirrowBridgeNodeIndex() = default;
+
+    FBlueprintIndex& FindOrAddIndex(UBlueprint* Blueprint);
+    void Rebuild(FBlueprintIndex& Index);
+    void FlushPendingAdds(FBlueprintIndex& Index);
+    void UnbindGraphs(FBlueprintIndex& Index);
+    void OnGraphChanged(const FEdGraphEditAction& Action, FObjectKey BlueprintKey);
+    void OnBlueprintChanged(UBlueprint* Blueprint);
+
+    TMap<FObjectKey, FBlueprintIndex> Indices;
+};
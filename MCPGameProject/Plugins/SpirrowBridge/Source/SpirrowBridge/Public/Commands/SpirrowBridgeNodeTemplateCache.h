@@ -0,0 +1,79 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "UObject/FieldPath.h"
+#include "Modules/ModuleManager.h"
+
+class UClass;
+class UFunction;
+class UStruct;
+class FProperty;
+
+/**
+ * Session cache of the reflection lookups done when spawning nodes.
+ *
+ * Class names resolved by FindClassByNameAnywhere (which may walk every
+ * loaded UClass), functions resolved by name (including the case-insensitive
+ * field scan used as a fallback) and properties are remembered per owner and
+ * name, so spawning the Nth PrintString or GetActorLocation node in a batch
+ * is a map lookup.
+ *
+ * Functions and properties are only cached for native owners: members of
+ * Blueprint-generated classes change on every compile. Class names are
+ * cached for Blueprint classes too; such an entry is dropped once the class
+ * is replaced by a recompile (CLASS_NewerVersionExists). All entries are weak
+ * and dropped when their owner is garbage collected or a module is (re)loaded.
+ */
+class SPIRROWBRIDGE_API FSpirrowBridgeNodeTemplateCache
+{
+public:
+    static FSpirrowBridgeNodeTemplateCache& Get();
+
+    /** Bind invalidation delegates. Called from USpirrowBridge::Initialize. */
+    void Initialize();
+
+    /** Unbind delegates and drop all entries. Called from USpirrowBridge::Deinitialize. */
+    void Shutdown();
+
+    void Reset();
+
+    /** Cached FSpirrowBridgeCommonUtils::FindClassByNameAnywhere */
+    UClass* FindClass(const FString& ClassName);
+
+    /** FindFunctionByName (including supers), falling back to a case-insensitive scan */
+    UFunction* FindFunction(UClass* Class, const FString& FunctionName);
+
+    /** FindFProperty on Owner (including supers) */
+    FProperty* FindProperty(UStruct* Owner, FName PropertyName);
+
+private:
+    FSpirrowBridgeNodeTemplateCache() = default;
+
+    struct FMemberKey
+    {
+        TWeakObjectPtr<UStruct> Owner;
+        FName Name;
+
+        bool operator==(const FMemberKey& Other) const
+        {
+            return Owner == Other.Owner && Name == Other.Name;
+        }
+
+        friend uint32 GetTypeHash(const FMemberKey& Key)
+        {
+            return HashCombine(GetTypeHash(Key.Owner), GetTypeHash(Key.Name));
+        }
+    };
+
+    static bool IsCacheable(const UStruct* Owner);
+
+    void OnModulesChanged(FName ModuleName, EModuleChangeReason Reason);
+
+    TMap<FString, TWeakObjectPtr<UClass>> Classes;
+    TMap<FMemberKey, TWeakObjectPtr<UFunction>> Functions;
+    TMap<FMemberKey, TFieldPath<FProperty>> Properties;
+
+    bool bInitialized = false;
+    FDelegateHandle ModulesChangedHandle;
+};
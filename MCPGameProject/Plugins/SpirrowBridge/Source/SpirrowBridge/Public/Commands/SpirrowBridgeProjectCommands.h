@@ -41,4 +41,13 @@ private:
     TSharedPtr<FJsonObject> HandleGetProjectInfo(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleFindAssetReferences(const TSharedPtr<FJsonObject>& Params);
     TSharedPtr<FJsonObject> HandleFindFunctionCallers(const TSharedPtr<FJsonObject>& Params);
+
+    // Asset prefetch handlers
+    TSharedPtr<FJsonObject> HandlePrefetchAssets(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleGetPrefetchStatus(const TSharedPtr<FJsonObject>& Params);
+
+    // Asset working set handlers (SpirrowBridgeProjectCommands_WorkingSet.cpp)
+    TSharedPtr<FJsonObject> HandleGetWorkingSet(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleConfigureWorkingSet(const TSharedPtr<FJsonObject>& Params);
+    TSharedPtr<FJsonObject> HandleTrimWorkingSet(const TSharedPtr<FJsonObject>& Params);
 }; 
\ No newline at end of file
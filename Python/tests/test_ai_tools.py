@@ -227,6 +227,172 @@ class TestBlackboard:
             "asset_path": f"/Game/Test/AI/Blackboards/{bb_name}"
         })
 
+    def test_set_blackboard_keys_batch(self, test_suite, unique_name):
+        """Blackboardキー一括編集テスト（add + rename + retype）"""
+        bb_name = unique_name("BB_BatchKeys")
+
+        test_suite.run_command("create_blackboard", {
+            "name": bb_name,
+            "path": "/Game/Test/AI/Blackboards"
+        })
+        for key_name in ("OldName", "Retyped"):
+            test_suite.run_command("add_blackboard_key", {
+                "blackboard_name": bb_name,
+                "key_name": key_name,
+                "key_type": "Bool",
+                "path": "/Game/Test/AI/Blackboards"
+            })
+
+        # 1回の呼び出しで追加・リネーム・型変更
+        result = test_suite.run_command("set_blackboard_keys", {
+            "blackboard_name": bb_name,
+            "operations": [
+                {"op": "add", "key_name": "NewKey", "key_type": "Vector"},
+                {"op": "rename", "key_name": "OldName", "new_name": "RenamedKey"},
+                {"op": "retype", "key_name": "Retyped", "key_type": "Int"}
+            ],
+            "path": "/Game/Test/AI/Blackboards"
+        })
+
+        assert_success(result, "キー一括編集")
+        assert_response_has(result, "applied", True)
+        assert_response_has(result, "failed_count", 0)
+        assert_response_has(result, "total_keys", 3)
+
+        # 変更後のキーを確認
+        result = test_suite.run_command("list_blackboard_keys", {
+            "blackboard_name": bb_name,
+            "path": "/Game/Test/AI/Blackboards"
+        })
+        assert_success(result, "キー一覧取得")
+        key_types = {key["name"]: key["type"] for key in result.response["result"]["keys"]}
+        assert key_types == {"RenamedKey": "Bool", "Retyped": "Int", "NewKey": "Vector"}
+
+        test_suite.add_cleanup("delete_asset", {
+            "asset_path": f"/Game/Test/AI/Blackboards/{bb_name}"
+        })
+
+    def test_set_blackboard_keys_rejected_batch(self, test_suite, unique_name):
+        """Blackboardキー一括編集テスト（1件でも失敗すれば何も変更しない）"""
+        bb_name = unique_name("BB_RejectKeys")
+
+        test_suite.run_command("create_blackboard", {
+            "name": bb_name,
+            "path": "/Game/Test/AI/Blackboards"
+        })
+        test_suite.run_command("add_blackboard_key", {
+            "blackboard_name": bb_name,
+            "key_name": "Existing",
+            "key_type": "Bool",
+            "path": "/Game/Test/AI/Blackboards"
+        })
+
+        # 2件目が存在しないキーの削除なのでバッチ全体が拒否される
+        result = test_suite.run_command("set_blackboard_keys", {
+            "blackboard_name": bb_name,
+            "operations": [
+                {"op": "add", "key_name": "Valid", "key_type": "Bool"},
+                {"op": "remove", "key_name": "Missing"}
+            ],
+            "path": "/Game/Test/AI/Blackboards"
+        })
+
+        # 検証エラーでも success=true、applied=false と操作ごとの結果が返る
+        assert_success(result, "キー一括編集（拒否）")
+        assert_response_has(result, "applied", False)
+        assert_response_has(result, "failed_count", 1)
+        op_results = result.response["result"]["results"]
+        assert op_results[0]["success"] is True
+        assert op_results[1]["success"] is False
+        assert "error" in op_results[1]
+
+        # アセットは変更されていない
+        result = test_suite.run_command("list_blackboard_keys", {
+            "blackboard_name": bb_name,
+            "path": "/Game/Test/AI/Blackboards"
+        })
+        assert_success(result, "キー一覧取得")
+        assert_response_has(result, "count", 1)
+
+        test_suite.add_cleanup("delete_asset", {
+            "asset_path": f"/Game/Test/AI/Blackboards/{bb_name}"
+        })
+
+    def test_rename_blackboard_key_propagates_to_bt(self, test_suite, unique_name):
+        """キーのリネームがBTのキーセレクタに伝播するテスト（find_blackboard_key_usages で確認）"""
+        bb_name = unique_name("BB_Propagate")
+        bt_name = unique_name("BT_Propagate")
+
+        test_suite.run_command("create_blackboard", {
+            "name": bb_name,
+            "path": "/Game/Test/AI/Blackboards"
+        })
+        test_suite.run_command("add_blackboard_key", {
+            "blackboard_name": bb_name,
+            "key_name": "TargetLocation",
+            "key_type": "Vector",
+            "path": "/Game/Test/AI/Blackboards"
+        })
+        test_suite.run_command("create_behavior_tree", {
+            "name": bt_name,
+            "path": "/Game/Test/AI/BehaviorTrees",
+            "blackboard_name": bb_name,
+            "blackboard_path": "/Game/Test/AI/Blackboards"
+        })
+
+        # MoveTo の BlackboardKey で TargetLocation を参照
+        result = test_suite.run_command("apply_behavior_tree", {
+            "behavior_tree_name": bt_name,
+            "tree": {
+                "type": "Sequence",
+                "children": [
+                    {"type": "BTTask_MoveTo", "properties": {"BlackboardKey": "TargetLocation"}}
+                ]
+            },
+            "blackboard_name": bb_name,
+            "blackboard_path": "/Game/Test/AI/Blackboards",
+            "path": "/Game/Test/AI/BehaviorTrees"
+        })
+        assert_success(result, "BT構築")
+        assert_response_has(result, "applied", True)
+
+        result = test_suite.run_command("find_blackboard_key_usages", {
+            "blackboard_name": bb_name,
+            "key_name": "TargetLocation",
+            "path": "/Game/Test/AI/Blackboards"
+        })
+        assert_success(result, "キー参照検索（リネーム前）")
+        assert result.response["result"]["keys"][0]["usage_count"] == 1
+
+        # リネームして参照BTのセレクタを更新
+        result = test_suite.run_command("set_blackboard_keys", {
+            "blackboard_name": bb_name,
+            "operations": [
+                {"op": "rename", "key_name": "TargetLocation", "new_name": "MoveGoal"}
+            ],
+            "path": "/Game/Test/AI/Blackboards"
+        })
+        assert_success(result, "キーリネーム")
+        assert_response_has(result, "applied", True)
+        assert result.response["result"]["propagation"]["selectors_updated"] == 1
+
+        result = test_suite.run_command("find_blackboard_key_usages", {
+            "blackboard_name": bb_name,
+            "key_name": "MoveGoal",
+            "path": "/Game/Test/AI/Blackboards"
+        })
+        assert_success(result, "キー参照検索（リネーム後）")
+        key_usages = result.response["result"]["keys"][0]
+        assert key_usages["usage_count"] == 1
+        assert key_usages["usages"][0]["node_class"] == "BTTask_MoveTo"
+
+        test_suite.add_cleanup("delete_asset", {
+            "asset_path": f"/Game/Test/AI/BehaviorTrees/{bt_name}"
+        })
+        test_suite.add_cleanup("delete_asset", {
+            "asset_path": f"/Game/Test/AI/Blackboards/{bb_name}"
+        })
+
 
 @pytest.mark.ai
 class TestBehaviorTree:
@@ -368,6 +534,145 @@ class TestBehaviorTree:
             "asset_path": f"/Game/Test/AI/Blackboards/{bb_name}"
         })
 
+    def test_apply_behavior_tree(self, test_suite, unique_name):
+        """ネスト仕様からのBT一括構築テスト"""
+        bt_name = unique_name("BT_Apply")
+
+        test_suite.run_command("create_behavior_tree", {
+            "name": bt_name,
+            "path": "/Game/Test/AI/BehaviorTrees"
+        })
+
+        result = test_suite.run_command("apply_behavior_tree", {
+            "behavior_tree_name": bt_name,
+            "tree": {
+                "type": "Selector",
+                "id": "root",
+                "children": [
+                    {"type": "Sequence", "id": "patrol", "children": [
+                        {"type": "BTTask_Wait", "id": "wait", "properties": {"WaitTime": 2.0}}
+                    ]},
+                    {"type": "BTTask_Wait", "properties": {"WaitTime": 0.5}}
+                ]
+            },
+            "path": "/Game/Test/AI/BehaviorTrees"
+        })
+
+        assert_success(result, "BT一括構築")
+        assert_response_has(result, "applied", True)
+        assert_response_has(result, "created_count", 4)
+        assert_response_has(result, "saved", True)
+        node_ids = result.response["result"]["node_ids"]
+        assert set(node_ids) == {"root", "patrol", "wait"}
+
+        test_suite.add_cleanup("delete_asset", {
+            "asset_path": f"/Game/Test/AI/BehaviorTrees/{bt_name}"
+        })
+
+    def test_apply_behavior_tree_invalid_spec(self, test_suite, unique_name):
+        """不正な仕様のBT構築テスト（何も変更せずエラー一覧を返す）"""
+        bt_name = unique_name("BT_ApplyInvalid")
+
+        test_suite.run_command("create_behavior_tree", {
+            "name": bt_name,
+            "path": "/Game/Test/AI/BehaviorTrees"
+        })
+
+        result = test_suite.run_command("apply_behavior_tree", {
+            "behavior_tree_name": bt_name,
+            "tree": {
+                "type": "Sequence",
+                "children": [
+                    {"type": "BTTask_DoesNotExist"},
+                    {"kind": "task"}
+                ]
+            },
+            "path": "/Game/Test/AI/BehaviorTrees"
+        })
+
+        # 検証エラーでも success=true、applied=false とエラー一覧が返る
+        assert_success(result, "BT一括構築（不正仕様）")
+        assert_response_has(result, "applied", False)
+        assert_response_has(result, "failed_count", 2)
+        assert len(result.response["result"]["errors"]) == 2
+
+        # ツリーは変更されていない
+        result = test_suite.run_command("get_behavior_tree_structure", {
+            "name": bt_name,
+            "path": "/Game/Test/AI/BehaviorTrees"
+        })
+        assert_success(result, "BT構造取得")
+        assert_response_has(result, "has_root_node", False)
+
+        test_suite.add_cleanup("delete_asset", {
+            "asset_path": f"/Game/Test/AI/BehaviorTrees/{bt_name}"
+        })
+
+    def test_bt_snapshot_and_diff(self, test_suite, unique_name):
+        """BTスナップショット取得と差分テスト"""
+        bt_name = unique_name("BT_Snapshot")
+
+        test_suite.run_command("create_behavior_tree", {
+            "name": bt_name,
+            "path": "/Game/Test/AI/BehaviorTrees"
+        })
+        result = test_suite.run_command("apply_behavior_tree", {
+            "behavior_tree_name": bt_name,
+            "tree": {
+                "type": "Sequence",
+                "id": "seq",
+                "children": [
+                    {"type": "BTTask_Wait", "properties": {"WaitTime": 1.0}}
+                ]
+            },
+            "path": "/Game/Test/AI/BehaviorTrees"
+        })
+        assert_success(result, "BT構築")
+        sequence_id = result.response["result"]["node_ids"]["seq"]
+
+        # スナップショット取得
+        result = test_suite.run_command("get_bt_snapshot", {
+            "behavior_tree_name": bt_name,
+            "path": "/Game/Test/AI/BehaviorTrees"
+        })
+        assert_success(result, "スナップショット取得")
+        snapshot = result.response["result"]["snapshot"]
+        assert sequence_id in snapshot["nodes"]
+
+        # 変更前はライブアセットと一致する
+        result = test_suite.run_command("diff_behavior_tree", {
+            "before": snapshot,
+            "behavior_tree_name": bt_name,
+            "path": "/Game/Test/AI/BehaviorTrees"
+        })
+        assert_success(result, "差分（変更なし）")
+        assert_response_has(result, "identical", True)
+
+        # Sequence の下にタスクを1つ追加して差分を取る
+        result = test_suite.run_command("apply_behavior_tree", {
+            "behavior_tree_name": bt_name,
+            "tree": {"type": "BTTask_Wait", "kind": "task"},
+            "parent_node_id": sequence_id,
+            "path": "/Game/Test/AI/BehaviorTrees"
+        })
+        assert_success(result, "タスク追加")
+
+        result = test_suite.run_command("diff_behavior_tree", {
+            "before": snapshot,
+            "behavior_tree_name": bt_name,
+            "path": "/Game/Test/AI/BehaviorTrees"
+        })
+        assert_success(result, "差分（タスク追加後）")
+        assert_response_has(result, "identical", False)
+        added = result.response["result"]["added"]
+        assert len(added) == 1
+        assert added[0]["parent"] == sequence_id
+        assert result.response["result"]["removed"] == []
+
+        test_suite.add_cleanup("delete_asset", {
+            "asset_path": f"/Game/Test/AI/BehaviorTrees/{bt_name}"
+        })
+
 
 @pytest.mark.ai
 class TestAIUtility:
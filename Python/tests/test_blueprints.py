@@ -216,6 +216,52 @@ class TestBlueprintNode:
         test_suite.add_cleanup("delete_asset", {
             "asset_path": f"/Game/Test/{self.bp_name}"
         })
+    
+    def test_disconnect_by_ref_param_pin(self, test_suite):
+        """参照渡しパラメータのピン名解決テスト（入力ピンが優先される）"""
+        # Vector_Normalize の A は UPARAM(ref): 同名の入力ピンと出力ピンを持つ
+        result = test_suite.run_command("add_blueprint_function_node", {
+            "blueprint_name": self.bp_name,
+            "target": "KismetMathLibrary",
+            "function_name": "Vector_Normalize",
+            "path": "/Game/Test"
+        })
+        assert_success(result, "Vector_Normalizeノード追加")
+        normalize_id = result.response["result"]["node_id"]
+
+        result = test_suite.run_command("add_blueprint_function_node", {
+            "blueprint_name": self.bp_name,
+            "target": "KismetMathLibrary",
+            "function_name": "MakeVector",
+            "node_position": [-300, 0],
+            "path": "/Game/Test"
+        })
+        assert_success(result, "MakeVectorノード追加")
+        make_id = result.response["result"]["node_id"]
+
+        result = test_suite.run_command("connect_blueprint_nodes", {
+            "blueprint_name": self.bp_name,
+            "source_node_id": make_id,
+            "source_pin": "ReturnValue",
+            "target_node_id": normalize_id,
+            "target_pin": "A",
+            "path": "/Game/Test"
+        })
+        assert_success(result, "参照渡しピンへの接続")
+
+        # 方向指定なしの名前解決は最初のピン（入力 A）を返す必要がある
+        result = test_suite.run_command("disconnect_blueprint_nodes", {
+            "blueprint_name": self.bp_name,
+            "node_id": normalize_id,
+            "pin_name": "A",
+            "path": "/Game/Test"
+        })
+        assert_success(result, "参照渡しピンの切断")
+        assert_response_has(result, "disconnected_count", 1)
+
+        test_suite.add_cleanup("delete_asset", {
+            "asset_path": f"/Game/Test/{self.bp_name}"
+        })
 
 
 @pytest.mark.blueprint
@@ -11,6 +11,8 @@ COMMANDS = {
     "add_blackboard_key": "add_blackboard_key",
     "remove_blackboard_key": "remove_blackboard_key",
     "list_blackboard_keys": "list_blackboard_keys",
+    "set_blackboard_keys": "set_blackboard_keys",
+    "find_blackboard_key_usages": "find_blackboard_key_usages",
     "create_behavior_tree": "create_behavior_tree",
     "set_behavior_tree_blackboard": "set_behavior_tree_blackboard",
     "get_behavior_tree_structure": "get_behavior_tree_structure",
@@ -20,6 +22,7 @@ COMMANDS = {
     "add_bt_service_node": "add_bt_service_node",
     "connect_bt_nodes": "connect_bt_nodes",
     "set_bt_node_property": "set_bt_node_property",
+    "set_bt_node_properties": "set_bt_node_properties",
     "delete_bt_node": "delete_bt_node",
     "list_bt_node_types": "list_bt_node_types",
     "set_bt_node_position": "set_bt_node_position",
@@ -29,6 +32,10 @@ COMMANDS = {
     "detect_broken_bt_nodes": "detect_broken_bt_nodes",
     "fix_broken_bt_nodes": "delete_broken_bt_nodes",
     "repair_broken_bt_nodes": "repair_broken_bt_nodes",
+    "audit_behavior_trees": "audit_behavior_trees",
+    "apply_behavior_tree": "apply_behavior_tree",
+    "get_bt_snapshot": "get_bt_snapshot",
+    "diff_behavior_tree": "diff_behavior_tree",
 }
 
 
@@ -39,12 +46,25 @@ def register_ai_meta_tool(mcp: FastMCP):
     def ai(ctx: Context, command: str, params: Dict[str, Any] = {}) -> Dict[str, Any]:
         """AI: blackboards, behavior trees, BT nodes, AI asset management.
         Commands: create_blackboard, add_blackboard_key, remove_blackboard_key,
-        list_blackboard_keys, create_behavior_tree, set_behavior_tree_blackboard,
+        list_blackboard_keys, set_blackboard_keys, find_blackboard_key_usages,
+        create_behavior_tree, set_behavior_tree_blackboard,
         get_behavior_tree_structure, add_bt_composite_node, add_bt_task_node,
         add_bt_decorator_node, add_bt_service_node, connect_bt_nodes,
-        set_bt_node_property, delete_bt_node, list_bt_node_types,
+        set_bt_node_property, set_bt_node_properties, delete_bt_node, list_bt_node_types,
         set_bt_node_position, auto_layout_bt, list_bt_nodes, list_ai_assets,
-        detect_broken_bt_nodes, fix_broken_bt_nodes, repair_broken_bt_nodes
+        detect_broken_bt_nodes, fix_broken_bt_nodes, repair_broken_bt_nodes,
+        audit_behavior_trees, apply_behavior_tree, get_bt_snapshot, diff_behavior_tree
+        apply_behavior_tree builds a whole tree from one nested spec
+        ({type, id, name, position, properties, decorators, services, children})
+        with a single asset rebuild and save; prefer it over many add_bt_* calls.
+        set_bt_node_properties takes {node_id: {prop: value}} and rebuilds once.
+        To verify an edit, take get_bt_snapshot before it and pass the snapshot
+        as diff_behavior_tree(before=...) afterwards instead of diffing
+        get_behavior_tree_structure output yourself.
+        audit_behavior_trees checks every BT under a path; unchanged assets
+        are answered from cache, so it is cheap to re-run after edits.
+        set_blackboard_keys applies add/remove/retype/rename ops all-or-nothing
+        and renames the key in every BT that uses it; use dry_run to check first.
         Use help("ai", "command_name") for params.
         """
         from tools.meta_utils import execute_command
@@ -28,6 +28,11 @@ COMMANDS = {
     "get_data_asset_properties": "get_data_asset_properties",
     "batch_set_properties": "batch_set_properties",
     "find_cpp_function_in_blueprints": "find_function_callers",
+    "begin_compile_batch": "begin_compile_batch",
+    "cancel_compile_batch": "cancel_compile_batch",
+    "flush_compile_queue": "flush_compile_queue",
+    "get_compile_queue": "get_compile_queue",
+    "validate_blueprint": "validate_blueprint",
 }
 
 RATIONALE_COMMANDS = {
@@ -49,13 +54,33 @@ def register_blueprint_meta_tool(mcp: FastMCP):
         scan_project_classes, set_blueprint_class_array, set_struct_array_property,
         create_data_asset, set_class_property, set_object_property,
         get_blueprint_properties, set_struct_property, set_data_asset_property,
-        get_data_asset_properties, batch_set_properties, find_cpp_function_in_blueprints
+        get_data_asset_properties, batch_set_properties, find_cpp_function_in_blueprints,
+        begin_compile_batch, cancel_compile_batch, flush_compile_queue,
+        get_compile_queue, validate_blueprint
 
         Level Blueprint support: compile_blueprint and get_blueprint_graph accept
         target_type="level_blueprint" to operate on the current level's Level
         Script Blueprint instead of a regular asset. Optional level_path (e.g.
         "/Game/Maps/MyMap") selects a specific level; omit for the current one.
 
+        Large graphs: get_blueprint_graph format="compact" returns every
+        graph (event, function, macro) with strings interned into "strings"
+        and nodes/pins/edges as flat integer rows whose column names are in
+        "schema"; format="summary" drops pins for an overview.
+
+        Compile queue: already-compiled Blueprints are only marked dirty by
+        edit commands and queued. begin_compile_batch also defers the UMG
+        compiles; flush_compile_queue then compiles every queued Blueprint
+        once, parents/dependencies first, and reports per-Blueprint time and
+        errors. Use it after editing a parent and its children.
+        cancel_compile_batch closes a batch without compiling (the queue is
+        kept for the next flush unless discard_pending=true).
+
+        validate_blueprint regenerates only the skeleton class and checks every
+        node (member resolution, link compatibility, orphaned pins, node
+        validation) without generating bytecode. Use it between edits in an
+        iterative loop and compile once at the end.
+
         Use help("blueprint", "command_name") for params.
         """
         from tools.meta_utils import execute_command
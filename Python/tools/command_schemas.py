@@ -165,7 +165,7 @@ COMMAND_SCHEMAS = {
     },
 
     # =========================================================================
-    # BLUEPRINT (21 commands)
+    # BLUEPRINT (26 commands)
     # =========================================================================
     "blueprint": {
         "create_blueprint": {
@@ -233,6 +233,39 @@ COMMAND_SCHEMAS = {
                 "level_path": {"type": "str", "desc": "Level asset path (e.g. /Game/Maps/MyMap). Omit for the currently edited level. Only used when target_type=level_blueprint"},
             },
         },
+        "begin_compile_batch": {
+            "brief": "Defer compiles (UMG edits, compile requests) into the compile queue until flush_compile_queue. Deferred UMG responses carry compile_deferred=true; bind_widget_event/set_text_block_binding save after the flush",
+            "params": {},
+        },
+        "cancel_compile_batch": {
+            "brief": "Close an open compile batch without compiling; later compile requests run immediately again",
+            "params": {
+                "discard_pending": {"type": "bool", "default": False, "desc": "Also drop queued Blueprints instead of keeping them for the next flush_compile_queue"},
+            },
+        },
+        "flush_compile_queue": {
+            "brief": "Compile every queued Blueprint once in dependency order and close the batch. Returns per-Blueprint status, time and errors",
+            "params": {
+                "mode": {"type": "str", "default": "ordered", "desc": "'ordered' (one compile per Blueprint, timed individually) or 'batch' (single FBlueprintCompilationManager flush, total time only)"},
+                "blueprints": {"type": "list[str]", "desc": "Additional Blueprint names to compile with the queue"},
+                "path": {"type": "str", "default": "/Game/Blueprints", "desc": "Content path for 'blueprints'"},
+            },
+        },
+        "get_compile_queue": {
+            "brief": "List Blueprints waiting in the compile queue and whether a batch is open",
+            "params": {},
+        },
+        "validate_blueprint": {
+            "brief": "Regenerate the skeleton class only and validate nodes and connections. Returns node-level diagnostics, much cheaper than compile_blueprint",
+            "params": {
+                "blueprint_name": {"type": "str", "required": False, "desc": "Blueprint name (required unless target_type=level_blueprint)"},
+                "path": {"type": "str", "default": "/Game/Blueprints", "desc": "Content path"},
+                "target_type": {"type": "str", "default": "blueprint", "desc": "'blueprint' (default) or 'level_blueprint'"},
+                "level_path": {"type": "str", "desc": "Level asset path. Only used when target_type=level_blueprint"},
+                "include_warnings": {"type": "bool", "default": True, "desc": "Include warnings (e.g. unconnected exec input) in diagnostics"},
+                "max_diagnostics": {"type": "int", "default": 200, "desc": "Maximum diagnostics returned (counts are always complete)"},
+            },
+        },
         "set_blueprint_property": {
             "brief": "Set a property on Blueprint class defaults",
             "params": {
@@ -258,17 +291,18 @@ COMMAND_SCHEMAS = {
                 "path": {"type": "str", "default": "/Game/Blueprints", "desc": "Content path"},
                 "target_type": {"type": "str", "default": "blueprint", "desc": "'blueprint' (default) or 'level_blueprint'"},
                 "level_path": {"type": "str", "desc": "Level asset path. Omit for current level. Only used when target_type=level_blueprint"},
+                "format": {"type": "str", "default": "full", "desc": "'full' (event graphs, one object per node/pin), 'compact' (all graphs incl. functions/macros as a string table plus flat integer rows described by 'schema') or 'summary' (compact without pins; edges are node pairs)"},
             },
         },
         "scan_project_classes": {
-            "brief": "Scan project for C++ classes and Blueprint assets",
+            "brief": "Scan project for C++ classes and Blueprint assets (served from a cached class tree)",
             "params": {
                 "class_type": {"type": "str", "default": "all", "desc": "Type: cpp, blueprint, or all"},
                 "parent_class": {"type": "str", "desc": "Filter by parent class"},
                 "module_filter": {"type": "str", "desc": "Filter by module name"},
                 "path_filter": {"type": "str", "desc": "Filter by content path"},
                 "include_engine": {"type": "bool", "default": False, "desc": "Include engine classes"},
-                "exclude_reinst": {"type": "bool", "default": True, "desc": "Exclude REINST classes"},
+                "exclude_reinst": {"type": "bool", "default": True, "desc": "Deprecated: REINST/transient classes are always excluded by the cached class tree"},
                 "blueprint_type": {"type": "str", "desc": "Filter: actor/widget/anim/controlrig/interface/gamemode/controller/character/pawn"},
             },
         },
@@ -375,7 +409,7 @@ COMMAND_SCHEMAS = {
     },
 
     # =========================================================================
-    # BLUEPRINT_NODE (21 commands)
+    # BLUEPRINT_NODE (29 commands)
     #
     # All commands in this section accept two optional params (not shown in
     # every schema entry for brevity):
@@ -473,6 +507,22 @@ COMMAND_SCHEMAS = {
                 "level_path": {"type": "str", "desc": "Level asset path. Omit for current level. Only used when target_type=level_blueprint"},
             },
         },
+        "search_blueprint_nodes": {
+            "brief": "Search nodes across all Blueprints under a folder via an inverted index. Boolean term filters and pagination",
+            "params": {
+                "all": {"type": "list[str]", "desc": "Terms that must all match, e.g. [\"kind:VariableSet\", \"variable:Health\"]. Fields: kind, function, variable, event, macro, input_action, graph, class, name"},
+                "any": {"type": "list[str]", "desc": "At least one of these terms must match"},
+                "none": {"type": "list[str]", "desc": "Exclude nodes matching any of these terms"},
+                "node_type": {"type": "str", "desc": "Shorthand for kind: Event, Function, VariableGet, VariableSet, Variable, Branch, Sequence, Macro, InputAction, Self, Other"},
+                "function_name": {"type": "str", "desc": "Shorthand for function:<name>"},
+                "variable_name": {"type": "str", "desc": "Shorthand for variable:<name>"},
+                "event_name": {"type": "str", "desc": "Shorthand for event:<name>"},
+                "path": {"type": "str", "default": "/Game", "desc": "Folder to search (recursive)"},
+                "offset": {"type": "int", "default": 0, "desc": "Index of the first result"},
+                "limit": {"type": "int", "default": 100, "desc": "Maximum results (0 = all)"},
+                "rebuild": {"type": "bool", "default": False, "desc": "Re-index every Blueprint under path before querying"},
+            },
+        },
         "set_node_pin_value": {
             "brief": "Set a default value on a node pin. Handles primitive, struct, Class, SoftClass, Object, SoftObject and Interface pins (regular BP or LSB)",
             "params": {
@@ -625,6 +675,70 @@ COMMAND_SCHEMAS = {
                 "level_path": {"type": "str", "desc": "Level asset path. Omit for current level. Only used when target_type=level_blueprint"},
             },
         },
+        "apply_blueprint_graph": {
+            "brief": "Build nodes and connections from a declarative description in one pass (one structural update, one compile). Returns temp id -> node GUID map",
+            "params": {
+                "blueprint_name": {"type": "str", "required": False, "desc": "Blueprint name (required unless target_type=level_blueprint)"},
+                "nodes": {
+                    "type": "list[dict]",
+                    "required": True,
+                    "desc": "[{id, type, position:[x,y], ...type fields, pin_values:{pin: value}}]. "
+                            "Types: event(event_name), custom_event(event_name), function(function_name, target, params), "
+                            "variable_get/variable_set(variable_name), component(component_name), self, branch, "
+                            "sequence(num_outputs), delay(duration), print_string(message), "
+                            "for_loop_with_break(first_index, last_index), math/comparison(operation, value_type)",
+                },
+                "edges": {"type": "list[dict]", "desc": "[{source, source_pin, target, target_pin}]. source/target are temp ids or GUIDs of existing nodes in the same graph"},
+                "graph_name": {"type": "str", "default": "EventGraph", "desc": "Target graph (EventGraph, function or macro graph name)"},
+                "compile": {"type": "bool", "default": True, "desc": "Compile once after all nodes and edges are applied"},
+                "continue_on_error": {"type": "bool", "default": False, "desc": "Keep successfully created nodes/edges when some entries fail (default: roll back everything and return success=true with applied=false, failed_count and errors)"},
+                "auto_layout": {"type": "any", "default": False, "desc": "Layered auto-layout after building: true/'new' = only created nodes (placed below existing content), 'all' = whole graph. Omit positions in the spec when using it"},
+                "path": {"type": "str", "default": "/Game/Blueprints", "desc": "Content path"},
+                "target_type": {"type": "str", "default": "blueprint", "desc": "'blueprint' or 'level_blueprint'"},
+                "level_path": {"type": "str", "desc": "Level asset path. Omit for current level. Only used when target_type=level_blueprint"},
+            },
+        },
+        "diff_blueprint_graph": {
+            "brief": "Structural diff between a desired graph description and the live graph (added/removed/changed nodes, pin defaults, links). Read-only",
+            "params": {
+                "blueprint_name": {"type": "str", "required": False, "desc": "Blueprint name (required unless target_type=level_blueprint)"},
+                "nodes": {"type": "list[dict]", "required": True, "desc": "Desired nodes, same format as apply_blueprint_graph. Optional 'guid' pins a spec to an existing node; otherwise nodes match by semantic key (event/function/variable/...) and nearest position"},
+                "edges": {"type": "list[dict]", "desc": "Desired links [{source, source_pin, target, target_pin}] between spec ids or existing node GUIDs"},
+                "graph_name": {"type": "str", "default": "EventGraph", "desc": "Target graph (EventGraph, function or macro graph name)"},
+                "remove_unmatched": {"type": "bool", "default": True, "desc": "Treat live nodes, and links between described nodes, that are not in the description as removed (comment nodes are never removed). False = additive, nothing is unlinked"},
+                "path": {"type": "str", "default": "/Game/Blueprints", "desc": "Content path"},
+                "target_type": {"type": "str", "default": "blueprint", "desc": "'blueprint' or 'level_blueprint'"},
+                "level_path": {"type": "str", "desc": "Level asset path. Omit for current level. Only used when target_type=level_blueprint"},
+            },
+        },
+        "patch_blueprint_graph": {
+            "brief": "Apply only the delta between a desired graph description and the live graph. Compiles only when something other than positions changed. On any error nothing is kept and the result has success=true, applied=false, failed_count and errors",
+            "params": {
+                "blueprint_name": {"type": "str", "required": False, "desc": "Blueprint name (required unless target_type=level_blueprint)"},
+                "nodes": {"type": "list[dict]", "required": True, "desc": "Desired nodes, same format as apply_blueprint_graph. Optional 'guid' pins a spec to an existing node; otherwise nodes match by semantic key (event/function/variable/...) and nearest position"},
+                "edges": {"type": "list[dict]", "desc": "Desired links [{source, source_pin, target, target_pin}] between spec ids or existing node GUIDs"},
+                "graph_name": {"type": "str", "default": "EventGraph", "desc": "Target graph (EventGraph, function or macro graph name)"},
+                "remove_unmatched": {"type": "bool", "default": True, "desc": "Treat live nodes, and links between described nodes, that are not in the description as removed (comment nodes are never removed). False = additive, nothing is unlinked"},
+                "compile": {"type": "bool", "default": True, "desc": "Compile after structural or pin-default changes"},
+                "auto_layout": {"type": "any", "default": False, "desc": "Layered auto-layout after building: true/'new' = only created nodes (placed below existing content), 'all' = whole graph. Omit positions in the spec when using it"},
+                "path": {"type": "str", "default": "/Game/Blueprints", "desc": "Content path"},
+                "target_type": {"type": "str", "default": "blueprint", "desc": "'blueprint' or 'level_blueprint'"},
+                "level_path": {"type": "str", "desc": "Level asset path. Omit for current level. Only used when target_type=level_blueprint"},
+            },
+        },
+        "auto_layout_blueprint_graph": {
+            "brief": "Layered (left-to-right) auto-layout of a Blueprint graph following exec and data links. Positions only, no compile",
+            "params": {
+                "blueprint_name": {"type": "str", "required": False, "desc": "Blueprint name (required unless target_type=level_blueprint)"},
+                "graph_name": {"type": "str", "default": "EventGraph", "desc": "Target graph (EventGraph, function or macro graph name)"},
+                "node_ids": {"type": "list[str]", "desc": "Only lay out these node GUIDs (default: every node except comments)"},
+                "horizontal_spacing": {"type": "int", "default": 80, "desc": "Gap between layers (columns)"},
+                "vertical_spacing": {"type": "int", "default": 32, "desc": "Gap between nodes in a layer"},
+                "path": {"type": "str", "default": "/Game/Blueprints", "desc": "Content path"},
+                "target_type": {"type": "str", "default": "blueprint", "desc": "'blueprint' or 'level_blueprint'"},
+                "level_path": {"type": "str", "desc": "Level asset path. Omit for current level. Only used when target_type=level_blueprint"},
+            },
+        },
     },
 
     # =========================================================================
@@ -1085,7 +1199,7 @@ COMMAND_SCHEMAS = {
     },
 
     # =========================================================================
-    # PROJECT (13 commands)
+    # PROJECT (18 commands)
     # =========================================================================
     "project": {
         "create_input_mapping": {
@@ -1162,11 +1276,16 @@ COMMAND_SCHEMAS = {
             },
         },
         "list_assets_in_folder": {
-            "brief": "List assets in a folder",
+            "brief": "List assets in a folder (filters run inside the asset registry query)",
             "params": {
                 "folder_path": {"type": "str", "required": True, "desc": "Folder path"},
-                "class_filter": {"type": "str", "desc": "Filter by asset class"},
+                "class_filter": {"type": "str", "desc": "Asset class name or path (e.g. WidgetBlueprint). Unknown names fall back to substring match"},
+                "class_paths": {"type": "list[str]", "desc": "Additional asset class names/paths (OR)"},
+                "include_subclasses": {"type": "bool", "default": True, "desc": "Also match subclasses of the given classes"},
                 "recursive": {"type": "bool", "default": False, "desc": "Search recursively"},
+                "tags": {"type": "dict", "desc": "Asset registry tag predicates, e.g. {\"ParentClass\": \"UserWidget\"}. Value may be str, list[str] (OR) or null (tag present)"},
+                "with_package_flags": {"type": "list[str]", "desc": "Require package flags (EditorOnly, UncookedOnly, ContainsMap, ContainsMapData, Cooked, CompiledIn, RuntimeGenerated, NewlyCreated)"},
+                "without_package_flags": {"type": "list[str]", "desc": "Exclude packages with these flags"},
             },
         },
         "import_texture": {
@@ -1186,15 +1305,65 @@ COMMAND_SCHEMAS = {
             "params": {},
         },
         "find_asset_references": {
-            "brief": "Find all references to an asset",
+            "brief": "Find package references/dependencies of an asset (optionally transitive, as a compact adjacency list). Only the Package dependency category is reported (no Manage/SearchableName entries) and /Script native packages are excluded unless include_script_packages=true",
             "params": {
                 "asset_path": {"type": "str", "required": True, "desc": "Asset path to search references for"},
+                "max_depth": {"type": "int", "default": 1, "desc": "Traversal depth (1 = direct only, 0 = unlimited). >1 adds a 'graph' adjacency list"},
+                "direction": {"type": "str", "default": "both", "desc": "referencers / dependencies / both (both = two separate walks; a referencer's own dependencies are not followed)"},
+                "include_hard": {"type": "bool", "default": True, "desc": "Follow hard package references"},
+                "include_soft": {"type": "bool", "default": True, "desc": "Follow soft package references"},
+                "class_filter": {"type": "list[str]", "desc": "Asset class names to report (e.g. ['Blueprint', 'WidgetBlueprint']); traversal still passes through other classes"},
+                "include_script_packages": {"type": "bool", "default": False, "desc": "Include /Script/ native packages"},
+                "max_nodes": {"type": "int", "default": 5000, "desc": "Node cap; sets 'truncated' when hit"},
+            },
+        },
+        "prefetch_assets": {
+            "brief": "Queue background async loads for assets you are about to edit; returns immediately",
+            "params": {
+                "asset_paths": {"type": "list[str]", "desc": "Asset paths to preload (e.g. /Game/UI/WBP_HUD)"},
+                "folder_path": {"type": "str", "desc": "Preload every asset under this folder"},
+                "recursive": {"type": "bool", "default": True, "desc": "Include subfolders of folder_path"},
+                "class_filter": {"type": "str", "desc": "Only preload this asset class (and subclasses) from folder_path"},
+                "priority": {"type": "int", "default": 0, "desc": "Async load priority"},
+                "max_assets": {"type": "int", "default": 2000, "desc": "Cap on packages queued by this call"},
+            },
+        },
+        "get_prefetch_status": {
+            "brief": "Report progress of prefetch_assets batches",
+            "params": {
+                "batch_id": {"type": "int", "desc": "Batch returned by prefetch_assets (omit for all batches)"},
+                "include_assets": {"type": "bool", "default": False, "desc": "Include per-package state and elapsed time"},
+                "clear_completed": {"type": "bool", "default": False, "desc": "Forget finished entries and release their retained packages"},
+            },
+        },
+        "get_working_set": {
+            "brief": "Show packages loaded by bridge commands and the eviction settings",
+            "params": {
+                "include_packages": {"type": "bool", "default": False, "desc": "List tracked packages, most recently used first"},
+                "limit": {"type": "int", "default": 100, "desc": "Max packages listed (0 = all)"},
+            },
+        },
+        "configure_working_set": {
+            "brief": "Set LRU caps for bridge-loaded packages; eviction and GC run between commands",
+            "params": {
+                "enabled": {"type": "bool", "desc": "Track and evict packages (default on)"},
+                "max_packages": {"type": "int", "desc": "Tracked package cap, 0 = unlimited (default 0, eviction off)"},
+                "memory_cap_mb": {"type": "int", "desc": "Editor physical memory cap in MB, 0 = off (default 0)"},
+                "save_dirty": {"type": "bool", "desc": "Save dirty packages so they can be unloaded (default false)"},
+                "gc_interval_commands": {"type": "int", "desc": "Run GC every N commands, 0 = off (default 0)"},
+            },
+        },
+        "trim_working_set": {
+            "brief": "Unload least recently used clean packages now. If unloading fails the result keeps unloaded/saved and adds unload_failed=true with error",
+            "params": {
+                "target_packages": {"type": "int", "default": 0, "desc": "Keep at most this many tracked packages"},
+                "free_mb": {"type": "float", "default": 0, "desc": "Keep unloading until this much (on-disk estimate) is freed"},
             },
         },
     },
 
     # =========================================================================
-    # AI (21 commands)
+    # AI (29 commands)
     # =========================================================================
     "ai": {
         "create_blackboard": {
@@ -1230,6 +1399,25 @@ COMMAND_SCHEMAS = {
                 "path": {"type": "str", "default": "/Game/AI/Blackboards", "desc": "Content path"},
             },
         },
+        "set_blackboard_keys": {
+            "brief": "Add/remove/retype/rename many Blackboard keys in one all-or-nothing edit; renames propagate to every BT. Validation failures return success=true with applied=false, failed_count and per-op errors",
+            "params": {
+                "blackboard_name": {"type": "str", "required": True, "desc": "Blackboard name"},
+                "operations": {"type": "list", "required": True, "desc": "Ops applied in order: {op: add|remove|retype|rename, key_name, key_type (add/retype), base_class, instance_synced, new_name (rename)}"},
+                "path": {"type": "str", "default": "/Game/AI/Blackboards", "desc": "Content path"},
+                "propagate": {"type": "bool", "default": True, "desc": "Update key selectors of referencing BehaviorTrees on rename"},
+                "force": {"type": "bool", "default": False, "desc": "Apply even if BT key selectors would be left pointing at a removed or incompatible key"},
+                "dry_run": {"type": "bool", "default": False, "desc": "Validate and report references without changing anything"},
+            },
+        },
+        "find_blackboard_key_usages": {
+            "brief": "List BT nodes referencing each key of a Blackboard (project-wide, incrementally indexed)",
+            "params": {
+                "blackboard_name": {"type": "str", "required": True, "desc": "Blackboard name"},
+                "key_name": {"type": "str", "desc": "Only this key (default: every key the Blackboard declares)"},
+                "path": {"type": "str", "default": "/Game/AI/Blackboards", "desc": "Content path"},
+            },
+        },
         "create_behavior_tree": {
             "brief": "Create a Behavior Tree",
             "params": {
@@ -1319,6 +1507,14 @@ COMMAND_SCHEMAS = {
                 "path": {"type": "str", "default": "/Game/AI/BehaviorTrees", "desc": "Content path"},
             },
         },
+        "set_bt_node_properties": {
+            "brief": "Set properties on many BT nodes with one rebuild and save. Partial failures keep success=true; check failed_count and per-entry results",
+            "params": {
+                "behavior_tree_name": {"type": "str", "required": True, "desc": "BehaviorTree name"},
+                "nodes": {"type": "dict", "required": True, "desc": "{node_id: {property_name: value}}; blackboard key selectors take a key name"},
+                "path": {"type": "str", "default": "/Game/AI/BehaviorTrees", "desc": "Content path"},
+            },
+        },
         "delete_bt_node": {
             "brief": "Delete a BT node",
             "params": {
@@ -1343,12 +1539,13 @@ COMMAND_SCHEMAS = {
             },
         },
         "auto_layout_bt": {
-            "brief": "Auto-layout BehaviorTree nodes",
+            "brief": "Auto-layout BehaviorTree nodes (tidy tree sized by decorator/service stacks; only moved nodes are written)",
             "params": {
                 "behavior_tree_name": {"type": "str", "required": True, "desc": "BehaviorTree name"},
                 "path": {"type": "str", "default": "/Game/AI/BehaviorTrees", "desc": "Content path"},
-                "horizontal_spacing": {"type": "int", "default": 300, "desc": "Horizontal spacing between nodes"},
-                "vertical_spacing": {"type": "int", "default": 150, "desc": "Vertical spacing between nodes"},
+                "horizontal_spacing": {"type": "int", "default": 40, "desc": "Gap between sibling subtrees"},
+                "vertical_spacing": {"type": "int", "default": 60, "desc": "Gap between a node and its children"},
+                "full": {"type": "bool", "default": False, "desc": "Recompute every subtree instead of reusing unchanged ones"},
             },
         },
         "list_bt_nodes": {
@@ -1386,10 +1583,48 @@ COMMAND_SCHEMAS = {
                 "path": {"type": "str", "default": "/Game/AI/BehaviorTrees", "desc": "Content path"},
             },
         },
+        "audit_behavior_trees": {
+            "brief": "Audit all BTs under a path (null instances, missing BB keys, orphaned/unreachable nodes, unloadable classes)",
+            "params": {
+                "path": {"type": "str", "default": "/Game", "desc": "Content path searched recursively"},
+                "force": {"type": "bool", "default": False, "desc": "Re-audit every asset instead of reusing cached reports of unchanged ones"},
+                "include_clean": {"type": "bool", "default": False, "desc": "Also list trees without issues"},
+                "max_issues": {"type": "int", "default": 500, "desc": "Maximum issues listed across all assets (counts are always complete)"},
+            },
+        },
+        "apply_behavior_tree": {
+            "brief": "Build a BT from a nested spec with one rebuild and one save. An invalid spec changes nothing and returns success=true with applied=false, failed_count and errors",
+            "params": {
+                "behavior_tree_name": {"type": "str", "required": True, "desc": "BehaviorTree name"},
+                "tree": {"type": "dict", "required": True, "desc": "Node spec: {type, kind?(composite/task), id?, name?, position?[x,y], properties?{prop: value}, decorators?[spec], services?[spec], children?[spec]}"},
+                "parent_node_id": {"type": "str", "default": "Root", "desc": "Attach under Root or an existing composite node ID"},
+                "clear_existing": {"type": "bool", "default": False, "desc": "Remove all existing nodes first (Root only)"},
+                "blackboard_name": {"type": "str", "desc": "Blackboard to assign before resolving key properties"},
+                "blackboard_path": {"type": "str", "default": "/Game/AI/Blackboards", "desc": "Blackboard content path"},
+                "path": {"type": "str", "default": "/Game/AI/BehaviorTrees", "desc": "Content path"},
+            },
+        },
+        "get_bt_snapshot": {
+            "brief": "Export a compact canonical BT snapshot (node table keyed by ID with per-subtree hashes). Nodes whose class failed to load appear as kind=\"broken\" with their stored class",
+            "params": {
+                "behavior_tree_name": {"type": "str", "required": True, "desc": "BehaviorTree name"},
+                "path": {"type": "str", "default": "/Game/AI/BehaviorTrees", "desc": "Content path"},
+            },
+        },
+        "diff_behavior_tree": {
+            "brief": "Diff a BT snapshot against another snapshot or the live asset (unchanged subtrees skipped by hash)",
+            "params": {
+                "before": {"type": "dict", "required": True, "desc": "Snapshot from get_bt_snapshot"},
+                "after": {"type": "dict", "desc": "Second snapshot; omit to compare against the live asset"},
+                "behavior_tree_name": {"type": "str", "desc": "Live asset to compare against (default: the asset recorded in 'before')"},
+                "path": {"type": "str", "default": "/Game/AI/BehaviorTrees", "desc": "Content path"},
+                "include_snapshot": {"type": "bool", "default": False, "desc": "Also return the 'after' snapshot, e.g. as the next baseline"},
+            },
+        },
     },
 
     # =========================================================================
-    # PERCEPTION (6 commands)
+    # PERCEPTION (7 commands)
     # =========================================================================
     "perception": {
         "add_ai_perception_component": {
@@ -1453,10 +1688,30 @@ COMMAND_SCHEMAS = {
                 "path": {"type": "str", "default": "/Game/Blueprints", "desc": "Content path"},
             },
         },
+        "configure_perception_bulk": {
+            "brief": "Apply one sense config to many Blueprints, then compile and save them as one batch (inside begin_compile_batch both wait for the flush); per-Blueprint results (check failed_count, success stays true)",
+            "params": {
+                "sense_type": {"type": "str", "required": True, "desc": "Sense type (Sight/Hearing/Damage)"},
+                "blueprints": {"type": "list[str]", "desc": "Blueprint names (under 'path') or asset paths"},
+                "parent_class": {"type": "str", "desc": "Also target every Blueprint deriving from this class (and the class itself if a Blueprint)"},
+                "path_filter": {"type": "str", "default": "/Game", "desc": "Content root for parent_class matches"},
+                "component_name": {"type": "str", "default": "AIPerceptionComponent", "desc": "Perception component name"},
+                "sight_radius": {"type": "float", "desc": "Sight radius"},
+                "lose_sight_radius": {"type": "float", "desc": "Lose sight radius"},
+                "peripheral_vision_angle": {"type": "float", "desc": "Peripheral vision half-angle in degrees"},
+                "auto_success_range": {"type": "float", "desc": "Auto success range within this distance"},
+                "hearing_range": {"type": "float", "desc": "Hearing range"},
+                "max_age": {"type": "float", "desc": "Max stimulus age in seconds"},
+                "detection_by_affiliation": {"type": "dict", "desc": "Detection by affiliation settings"},
+                "inherited": {"type": "str", "default": "skip", "desc": "Component inherited from a parent Blueprint: skip, or override in the child"},
+                "dry_run": {"type": "bool", "default": False, "desc": "Report changes without editing"},
+                "path": {"type": "str", "default": "/Game/Blueprints", "desc": "Content path for Blueprint names"},
+            },
+        },
     },
 
     # =========================================================================
-    # EQS (5 commands)
+    # EQS (7 commands)
     # =========================================================================
     "eqs": {
         "create_eqs_query": {
@@ -1515,6 +1770,30 @@ COMMAND_SCHEMAS = {
                 "path_filter": {"type": "str", "desc": "Filter by content path"},
             },
         },
+        "run_eqs_query": {
+            "brief": "Run an EQS query in the editor/PIE world; returns scored items plus per-generator/test timing and item counts",
+            "params": {
+                "query_name": {"type": "str", "required": True, "desc": "EQS Query name"},
+                "path": {"type": "str", "default": "/Game/AI/EQS", "desc": "Content path"},
+                "target": {"type": "str", "default": "auto", "desc": "World: auto (PIE if running, else editor), editor, pie"},
+                "querier": {"type": "str", "desc": "Querier actor name or label (default: temporary actor at 'location')"},
+                "location": {"type": "list[float]", "desc": "[X, Y, Z] of the temporary querier"},
+                "run_mode": {"type": "str", "default": "AllMatching", "desc": "AllMatching, SingleResult, RandomBest5Pct, RandomBest25Pct"},
+                "query_params": {"type": "dict", "desc": "Named float query params {name: value}"},
+                "iterations": {"type": "int", "default": 1, "desc": "Runs to average timings over (max 100)"},
+                "max_items": {"type": "int", "default": 20, "desc": "Max scored items returned"},
+            },
+        },
+        "analyze_eqs_query": {
+            "brief": "Estimate generator item counts and test costs in the engine's execution order (cost, then filters first, then TestOrder). Flags filters the engine's sort moves across order-dependent scoring tests and unfiltered High-cost tests",
+            "params": {
+                "query_name": {"type": "str", "required": True, "desc": "EQS Query name"},
+                "path": {"type": "str", "default": "/Game/AI/EQS", "desc": "Content path"},
+                "apply": {"type": "bool", "default": False, "desc": "Rewrite the tests and TestOrder to execution_order and save; the run order is unchanged"},
+                "filter_pass_rate": {"type": "float", "default": 0.5, "desc": "Assumed fraction of items each filter keeps, for estimated_cost_units"},
+                "large_item_count": {"type": "int", "default": 500, "desc": "Item count above which unfiltered High-cost tests are flagged"},
+            },
+        },
     },
 
     # =========================================================================
@@ -12,6 +12,8 @@ COMMANDS = {
     "add_eqs_test": "add_eqs_test",
     "set_eqs_test_property": "set_eqs_test_property",
     "list_eqs_assets": "list_eqs_assets",
+    "run_eqs_query": "run_eqs_query",
+    "analyze_eqs_query": "analyze_eqs_query",
 }
 
 
@@ -20,9 +22,13 @@ def register_eqs_meta_tool(mcp: FastMCP):
 
     @mcp.tool()
     def eqs(ctx: Context, command: str, params: Dict[str, Any] = {}) -> Dict[str, Any]:
-        """EQS: create queries, add generators and tests.
+        """EQS: create queries, add generators and tests, run and profile them.
         Commands: create_eqs_query, add_eqs_generator, add_eqs_test,
-        set_eqs_test_property, list_eqs_assets
+        set_eqs_test_property, list_eqs_assets, run_eqs_query, analyze_eqs_query
+        run_eqs_query executes a query in the editor/PIE world and reports the
+        scored items plus per-step timing and surviving item counts.
+        analyze_eqs_query estimates item counts and test costs from the asset,
+        flags expensive tests before cheaper filters and can reorder them (apply).
         Use help("eqs", "command_name") for params.
         """
         from tools.meta_utils import execute_command
@@ -15,6 +15,7 @@ COMMANDS = {
     "add_blueprint_get_self_component_reference": "add_blueprint_get_self_component_reference",
     "add_blueprint_self_reference": "add_blueprint_self_reference",
     "find_blueprint_nodes": "find_blueprint_nodes",
+    "search_blueprint_nodes": "search_blueprint_nodes",
     "set_node_pin_value": "set_node_pin_value",
     "add_variable_get_node": "add_variable_get_node",
     "add_variable_set_node": "add_variable_set_node",
@@ -31,6 +32,10 @@ COMMANDS = {
     "add_external_property_set_node": "add_external_property_set_node",
     "add_external_property_get_node": "add_external_property_get_node",
     "add_get_subsystem_node": "add_get_subsystem_node",
+    "apply_blueprint_graph": "apply_blueprint_graph",
+    "diff_blueprint_graph": "diff_blueprint_graph",
+    "patch_blueprint_graph": "patch_blueprint_graph",
+    "auto_layout_blueprint_graph": "auto_layout_blueprint_graph",
 }
 
 RATIONALE_COMMANDS = {
@@ -49,13 +54,15 @@ def register_node_meta_tool(mcp: FastMCP):
         Commands: add_blueprint_event_node, add_blueprint_input_action_node,
         add_blueprint_function_node, connect_blueprint_nodes, add_blueprint_variable,
         add_blueprint_get_self_component_reference, add_blueprint_self_reference,
-        find_blueprint_nodes, set_node_pin_value, add_variable_get_node,
+        find_blueprint_nodes, search_blueprint_nodes, set_node_pin_value,
+        add_variable_get_node,
         add_variable_set_node, add_branch_node, delete_blueprint_node,
         move_blueprint_node, add_sequence_node, add_delay_node,
         add_forloop_with_break_node, add_print_string_node,
         add_math_node, add_comparison_node,
         add_external_property_set_node, add_external_property_get_node,
-        add_get_subsystem_node
+        add_get_subsystem_node, apply_blueprint_graph, diff_blueprint_graph,
+        patch_blueprint_graph, auto_layout_blueprint_graph
 
         Level Blueprint support: every command in this tool accepts optional
         target_type="level_blueprint" to edit the current level's Level Script
@@ -84,6 +91,30 @@ def register_node_meta_tool(mcp: FastMCP):
         uses K2Schema->TrySetDefaultObject and reconstructs the node so
         downstream pin types are narrowed correctly.
 
+        Batch graph build: apply_blueprint_graph takes nodes with client-side
+        temp ids plus edges between them, creates and wires everything in one
+        pass, compiles once, and returns node_map (temp id -> GUID). Prefer it
+        over chains of add_*_node + connect_blueprint_nodes calls.
+
+        Incremental edits: diff_blueprint_graph / patch_blueprint_graph take
+        the same description and match it against the live graph (by "guid"
+        or semantic key), so only added/removed/changed nodes, pin defaults
+        and links are touched. Edit a graph by re-sending its description
+        with the tweak rather than rebuilding it.
+
+        Layout: pass auto_layout=true (new nodes) or "all" (whole graph) to
+        apply/patch_blueprint_graph, or call auto_layout_blueprint_graph,
+        instead of positioning nodes with move_blueprint_node one by one.
+
+        Project-wide search: search_blueprint_nodes queries an index of every
+        Blueprint under "path" (default /Game) by terms such as
+        "kind:VariableSet", "variable:Health", "function:Delay", "event:ReceiveBeginPlay",
+        "graph:EventGraph" or "class:K2Node_CallFunction" (a bare word matches
+        any member name). all = AND, any = OR, none = NOT; results are paged
+        with offset/limit. The first query over a folder loads and indexes it;
+        later queries only re-index Blueprints saved or compiled since.
+        target_type does not apply to this command.
+
         Use help("blueprint_node", "command_name") for params.
         """
         # Handle deprecated command
@@ -13,6 +13,7 @@ COMMANDS = {
     "configure_damage_sense": "configure_damage_sense",
     "set_perception_dominant_sense": "set_perception_dominant_sense",
     "add_perception_stimuli_source": "add_perception_stimuli_source",
+    "configure_perception_bulk": "configure_perception_bulk",
 }
 
 
@@ -24,7 +25,10 @@ def register_perception_meta_tool(mcp: FastMCP):
         """AI Perception: sight, hearing, damage senses, stimuli sources.
         Commands: add_ai_perception_component, configure_sight_sense,
         configure_hearing_sense, configure_damage_sense,
-        set_perception_dominant_sense, add_perception_stimuli_source
+        set_perception_dominant_sense, add_perception_stimuli_source,
+        configure_perception_bulk
+        configure_perception_bulk applies one sense config to many Blueprints
+        (list or parent_class) and compiles/saves them as one batch.
         Use help("perception", "command_name") for params.
         """
         from tools.meta_utils import execute_command
@@ -20,6 +20,11 @@ COMMANDS = {
     "import_texture": "import_texture",
     "get_project_info": "get_project_info",
     "find_asset_references": "find_asset_references",
+    "prefetch_assets": "prefetch_assets",
+    "get_prefetch_status": "get_prefetch_status",
+    "get_working_set": "get_working_set",
+    "configure_working_set": "configure_working_set",
+    "trim_working_set": "trim_working_set",
 }
 
 
@@ -28,13 +33,14 @@ def register_project_meta_tool(mcp: FastMCP):
 
     @mcp.tool()
     def project(ctx: Context, command: str, params: Dict[str, Any] = {}) -> Dict[str, Any]:
-        """Project: input mapping, assets, folders, textures, project info.
+        """Project: input mapping, assets, folders, textures, project info, prefetch, working set.
         Commands: create_input_mapping, create_input_action,
         create_input_mapping_context, add_action_to_mapping_context,
         delete_asset, add_mapping_context_to_blueprint,
         set_default_mapping_context, asset_exists, create_content_folder,
         list_assets_in_folder, import_texture, get_project_info,
-        find_asset_references
+        find_asset_references, prefetch_assets, get_prefetch_status,
+        get_working_set, configure_working_set, trim_working_set
         Use help("project", "command_name") for params.
         """
         from tools.meta_utils import execute_command